@@ -0,0 +1,942 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : bench.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 链表容器各操作的基准测试，按存储方式、元素个数与数据宽度
+ 				   组合逐项计时，输出CSV或JSON，便于不同提交之间对比
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 用法：bench [--format csv|json] [--suite matrix|extra|all]
+ 				   [--storage node|pool|cursor|unrolled|skip|vector|all]
+ 				   [--max-size N] [--max-width N] [--budget N] [--threads N]；
+ 				   matrix为各存储方式的基本操作矩阵，其中cursor为启用
+ 				   CursorCache、以普通写更新游标的节点存储；extra为并行排序与遍历的线程扩展性、
+ 				   哈希索引查找、批量遍历、compact前后遍历、保存加载、持久化
+ 				   链表、并发栈、分片链表与读多写少模式的吞吐；每行输出op、
+ 				   storage、size、width、ops、ns_per_op、allocs_per_op、
+ 				   frees_per_op、peak_bytes、rss_kb、gb_per_s(只有savelist/
+ 				   loadlist读写的快照字节数计入，其余为0)；分配次数与堆占用经由
+ 				   InitCountingAllocator统计；时间复杂度为O(n)的按位置操作只
+ 				   执行约budget/size次，避免大容量时耗时过长
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+ * 2.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 输出savelist/loadlist的吞吐gb_per_s
+
+********************************************************************************/
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include "time.h"
+#include "unistd.h"
+
+#define BENCH_DEFAULT_MAX_SIZE 10000000U
+#define BENCH_DEFAULT_MAX_WIDTH 4096U
+#define BENCH_DEFAULT_BUDGET 20000000ULL
+#define BENCH_MAX_BYTES ( 1ULL << 30 )
+#define BENCH_MAX_REPS 100000U
+#define BENCH_EXTRA_SIZE 1000000U
+#define BENCH_EXTRA_WIDTH 16U
+
+typedef struct bench_config
+{
+	const char* pStorage;
+	const char* pSuite;
+	unsigned int MaxSize;
+	unsigned int MaxWidth;
+	unsigned long long Budget;
+	unsigned int Threads;
+	int Json;
+}bench_config_t;
+
+typedef struct bench_run
+{
+	const bench_config_t* pConfig;
+	const char* pStorage;
+	unsigned int Size;
+	unsigned int Width;
+	list_alloc_stats_t Stats;
+	list_allocator_t Allocator;
+	unsigned long long StartAllocs;
+	unsigned long long StartReleases;
+	double StartTime;
+	unsigned long long Bytes;
+	char* pPayload;
+	unsigned int Seed;
+	unsigned int Rows;
+}bench_run_t;
+
+static unsigned long long Sink;
+
+static double Now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static long ResidentKb(void)
+{
+	long pages = 0;
+	long resident = 0;
+	FILE* pFile = fopen("/proc/self/statm", "r");
+
+	if( NULL == pFile )
+	{
+		return 0;
+	}
+
+	if( 2 != fscanf(pFile, "%ld %ld", &pages, &resident) )
+	{
+		resident = 0;
+	}
+
+	fclose(pFile);
+
+	return resident * ( sysconf(_SC_PAGESIZE) / 1024 );
+}
+
+static unsigned int NextRandom(bench_run_t* pRun)
+{
+	pRun->Seed ^= pRun->Seed << 13;
+	pRun->Seed ^= pRun->Seed >> 17;
+	pRun->Seed ^= pRun->Seed << 5;
+
+	return pRun->Seed;
+}
+
+static const void* NextPayload(bench_run_t* pRun)
+{
+	unsigned int key = NextRandom(pRun);
+
+	memcpy(pRun->pPayload, &key, sizeof(key));
+
+	return pRun->pPayload;
+}
+
+static unsigned int KeyGreater(const void* pData1, const void* pData2)
+{
+	unsigned int key1 = 0;
+	unsigned int key2 = 0;
+
+	memcpy(&key1, pData1, sizeof(key1));
+	memcpy(&key2, pData2, sizeof(key2));
+
+	return ( key1 > key2 ) ? OPERATE_TRUE : OPERATE_FALSE;
+}
+
+static unsigned int KeyEqual(const void* pData, const void* pRef)
+{
+	return ( 0 == memcmp(pData, pRef, sizeof(unsigned int)) ) ? OPERATE_TRUE : OPERATE_FALSE;
+}
+
+static void Touch(void* pData)
+{
+	Sink += *(unsigned char*)pData;
+}
+
+/* 按--budget限制O(n)操作的执行次数，至少执行一次，至多BENCH_MAX_REPS次 */
+static unsigned int LinearReps(const bench_run_t* pRun, unsigned int limit)
+{
+	unsigned long long reps = pRun->pConfig->Budget / ( pRun->Size + 1ULL );
+
+	if( reps > limit )
+	{
+		reps = limit;
+	}
+
+	if( reps > BENCH_MAX_REPS )
+	{
+		reps = BENCH_MAX_REPS;
+	}
+
+	return ( 0 == reps ) ? 1 : (unsigned int)reps;
+}
+
+static void Begin(bench_run_t* pRun)
+{
+	pRun->StartAllocs = pRun->Stats.Allocs;
+	pRun->StartReleases = pRun->Stats.Releases;
+	pRun->Bytes = 0;
+	pRun->StartTime = Now();
+}
+
+static void Report(bench_run_t* pRun, const char* pOp, unsigned int ops)
+{
+	double elapsed = Now() - pRun->StartTime;
+	double count = ( 0 == ops ) ? 1.0 : (double)ops;
+	const char* pFormat = pRun->pConfig->Json
+		? "%s{\"op\":\"%s\",\"storage\":\"%s\",\"size\":%u,\"width\":%u,\"ops\":%u,\"ns_per_op\":%.2f,"
+		  "\"allocs_per_op\":%.4f,\"frees_per_op\":%.4f,\"peak_bytes\":%llu,\"rss_kb\":%ld,\"gb_per_s\":%.3f}\n"
+		: "%s%s,%s,%u,%u,%u,%.2f,%.4f,%.4f,%llu,%ld,%.3f\n";
+
+	printf(pFormat, ( pRun->pConfig->Json && 0 != pRun->Rows++ ) ? "," : "",
+		pOp, pRun->pStorage, pRun->Size, pRun->Width, ops, elapsed / count,
+		(double)( pRun->Stats.Allocs - pRun->StartAllocs ) / count,
+		(double)( pRun->Stats.Releases - pRun->StartReleases ) / count,
+		pRun->Stats.PeakBytes, ResidentKb(),
+		( elapsed > 0.0 ) ? (double)pRun->Bytes / elapsed : 0.0);
+	fflush(stdout);
+}
+
+static list_t* CreateBenchList(bench_run_t* pRun)
+{
+	list_attr_t attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &pRun->Allocator;
+
+	if( 0 == strcmp(pRun->pStorage, "pool") )
+	{
+		attr.PoolNodesPerSlab = 256;
+	}
+	else if( 0 == strcmp(pRun->pStorage, "cursor") )
+	{
+		attr.CursorCache = 1;
+	}
+	else if( 0 == strcmp(pRun->pStorage, "unrolled") )
+	{
+		attr.Storage = LIST_STORAGE_UNROLLED;
+	}
+	else if( 0 == strcmp(pRun->pStorage, "skip") )
+	{
+		attr.SkipIndex = 1;
+	}
+	else if( 0 == strcmp(pRun->pStorage, "vector") )
+	{
+		attr.Storage = LIST_STORAGE_VECTOR;
+	}
+
+	return CreateListEx(pRun->Size + BENCH_MAX_REPS, pRun->Width, &attr);
+}
+
+static int Fill(bench_run_t* pRun, list_t* pList, unsigned int count)
+{
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		if( OPERATE_FAIL == pList->pushback(pList, NextPayload(pRun)) )
+		{
+			return OPERATE_FAIL;
+		}
+	}
+
+	return OPERATE_SUCC;
+}
+
+/* 依次测量一种存储方式、元素个数与数据宽度组合下的全部操作 */
+static int RunCase(bench_run_t* pRun)
+{
+	list_t* pList = NULL;
+	unsigned int size = pRun->Size;
+	unsigned int reps = 0;
+	unsigned int counter = 0;
+	unsigned int miss = 0;
+
+	InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+	pList = CreateBenchList(pRun);
+
+	if( NULL == pList )
+	{
+		return OPERATE_FAIL;
+	}
+
+	Begin(pRun);
+	if( OPERATE_FAIL == Fill(pRun, pList, size) )
+	{
+		pList->destroy(&pList);
+		return OPERATE_FAIL;
+	}
+	Report(pRun, "pushback", size);
+
+	reps = LinearReps(pRun, size);
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		Touch(pList->get(pList, counter));
+	}
+	Report(pRun, "get_seq", reps);
+
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		Touch(pList->get(pList, NextRandom(pRun) % size));
+	}
+	Report(pRun, "get_random", reps);
+
+	reps = LinearReps(pRun, 100);
+	miss = 0xFFFFFFFFU;
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		Sink += ( NULL != pList->findif2(pList, KeyEqual, &miss) );
+	}
+	Report(pRun, "findif2", reps);
+
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		pList->insert(pList, NextRandom(pRun) % size, NextPayload(pRun));
+	}
+	Report(pRun, "insert", reps);
+
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		pList->remove(pList, NextRandom(pRun) % size);
+	}
+	Report(pRun, "remove", reps);
+
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		pList->swap(pList, NextRandom(pRun) % size, NextRandom(pRun) % size);
+	}
+	Report(pRun, "swap", reps);
+
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		pList->popback(pList);
+	}
+	Report(pRun, "popback", reps);
+	Fill(pRun, pList, reps);
+
+	reps = LinearReps(pRun, BENCH_MAX_REPS);
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		pList->pushfront(pList, NextPayload(pRun));
+	}
+	Report(pRun, "pushfront", reps);
+
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		pList->popfront(pList);
+	}
+	Report(pRun, "popfront", reps);
+
+	Begin(pRun);
+	pList->foreach(pList, Touch);
+	Report(pRun, "foreach", size);
+
+	Begin(pRun);
+	pList->sortif(pList, KeyGreater);
+	Report(pRun, "sortif", size);
+
+	pList->clear(pList);
+	Fill(pRun, pList, size);
+	Begin(pRun);
+	pList->sortbykey(pList, 0, sizeof(unsigned int));
+	Report(pRun, "sortbykey", size);
+
+	Begin(pRun);
+	pList->clear(pList);
+	Report(pRun, "clear", size);
+
+	Fill(pRun, pList, size);
+	Begin(pRun);
+	pList->destroy(&pList);
+	Report(pRun, "destroy", size);
+
+	return ( 0 == pRun->Stats.LiveBytes ) ? OPERATE_SUCC : OPERATE_FAIL;
+}
+
+static void TouchContext(void* pData, void* pContext)
+{
+	*(unsigned long long*)pContext += *(unsigned char*)pData;
+}
+
+static void TouchBatch(void** ppItems, unsigned int count, void* pContext)
+{
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		*(unsigned long long*)pContext += *(unsigned char*)ppItems[counter];
+	}
+}
+
+static unsigned int KeyOdd(const void* pData, const void* pRef)
+{
+	(void)pRef;
+
+	return *(const unsigned char*)pData & 1;
+}
+
+static list_t* CreateFilled(bench_run_t* pRun, const list_attr_t* pAttr)
+{
+	list_t* pList = CreateListEx(pRun->Size + BENCH_MAX_REPS, pRun->Width, pAttr);
+
+	if( NULL != pList && OPERATE_FAIL == Fill(pRun, pList, pRun->Size) )
+	{
+		pList->destroy(&pList);
+	}
+
+	return pList;
+}
+
+/* 并行排序、并行遍历相对单线程的扩展性 */
+static void RunParallelExtras(bench_run_t* pRun, unsigned int max_threads)
+{
+	list_attr_t attr;
+	list_t* pList = NULL;
+	char label[32];
+	unsigned int threads = 0;
+	unsigned long long sum = 0;
+	unsigned int found = 0;
+	void* results[16];
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &pRun->Allocator;
+
+	for( threads = 1; threads <= max_threads; threads *= 2 )
+	{
+		InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+		pList = CreateFilled(pRun, &attr);
+		if( NULL == pList )
+		{
+			return;
+		}
+
+		sprintf(label, "threads=%u", threads);
+		pRun->pStorage = label;
+
+		Begin(pRun);
+		pList->parallelsortif(pList, KeyGreater, threads, 0);
+		Report(pRun, "parallelsortif", pRun->Size);
+
+		Begin(pRun);
+		pList->parallelforeach(pList, TouchContext, &sum, threads);
+		Report(pRun, "parallelforeach", pRun->Size);
+
+		Begin(pRun);
+		found = pList->countif(pList, KeyOdd, NULL, threads);
+		Report(pRun, "countif", pRun->Size);
+
+		Begin(pRun);
+		found += pList->findall(pList, KeyOdd, NULL, results, 16, threads);
+		Report(pRun, "findall", pRun->Size);
+
+		Sink += sum + found;
+		pList->destroy(&pList);
+	}
+}
+
+/* 哈希索引查找与findif2对比、批量遍历与逐个回调对比、compact前后的遍历 */
+static void RunLookupExtras(bench_run_t* pRun)
+{
+	list_attr_t attr;
+	list_t* pList = NULL;
+	unsigned int reps = 0;
+	unsigned int counter = 0;
+	unsigned int key = 0;
+	unsigned long long sum = 0;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &pRun->Allocator;
+	pRun->pStorage = "node";
+
+	InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+	pList = CreateFilled(pRun, &attr);
+	if( NULL == pList )
+	{
+		return;
+	}
+
+	reps = LinearReps(pRun, 100);
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		key = NextRandom(pRun);
+		Sink += ( NULL != pList->findif2(pList, KeyEqual, &key) );
+	}
+	Report(pRun, "findif2", reps);
+
+	Begin(pRun);
+	pList->foreach2(pList, TouchContext, &sum);
+	Report(pRun, "foreach2", pRun->Size);
+
+	Begin(pRun);
+	pList->foreachbatch(pList, TouchBatch, &sum);
+	Report(pRun, "foreachbatch", pRun->Size);
+
+	/* 按随机键排序后节点的链接顺序与地址顺序无关，再对比compact前后的遍历 */
+	pList->sortif(pList, KeyGreater);
+
+	Begin(pRun);
+	pList->foreach2(pList, TouchContext, &sum);
+	Report(pRun, "foreach_before_compact", pRun->Size);
+
+	Begin(pRun);
+	pList->compact(pList);
+	Report(pRun, "compact", pRun->Size);
+
+	Begin(pRun);
+	pList->foreach2(pList, TouchContext, &sum);
+	Report(pRun, "foreach_after_compact", pRun->Size);
+	pList->destroy(&pList);
+
+	attr.HashIndex = 1;
+	attr.HashKeyWidth = sizeof(unsigned int);
+	pRun->pStorage = "hash";
+
+	InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+	Begin(pRun);
+	pList = CreateFilled(pRun, &attr);
+	if( NULL == pList )
+	{
+		return;
+	}
+	Report(pRun, "pushback", pRun->Size);
+
+	reps = LinearReps(pRun, BENCH_MAX_REPS) * 100;
+	Begin(pRun);
+	for( counter = 0; counter < reps; counter++ )
+	{
+		key = NextRandom(pRun);
+		Sink += ( NULL != pList->findbykey(pList, &key) );
+	}
+	Report(pRun, "findbykey", reps);
+
+	pList->destroy(&pList);
+	Sink += sum;
+}
+
+/* savelist/loadlist与持久化链表的写入、flush和重新打开 */
+static void RunStorageExtras(bench_run_t* pRun)
+{
+	list_attr_t attr;
+	list_t* pList = NULL;
+	FILE* pFile = tmpfile();
+	char path[64];
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &pRun->Allocator;
+	pRun->pStorage = "node";
+
+	InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+	pList = CreateFilled(pRun, &attr);
+	if( NULL != pList && NULL != pFile )
+	{
+		Begin(pRun);
+		pList->savelist(pList, pFile);
+		fflush(pFile);
+		pRun->Bytes = (unsigned long long)ftell(pFile);
+		Report(pRun, "savelist", pRun->Size);
+
+		rewind(pFile);
+		pList->clear(pList);
+		Begin(pRun);
+		pList->loadlist(pList, pFile);
+		pRun->Bytes = (unsigned long long)ftell(pFile);
+		Report(pRun, "loadlist", pRun->Size);
+	}
+
+	if( NULL != pList )
+	{
+		pList->destroy(&pList);
+	}
+
+	if( NULL != pFile )
+	{
+		fclose(pFile);
+	}
+
+#if LIST_USE_MMAP
+	sprintf(path, "/tmp/forwardlist_bench_%ld.dat", (long)getpid());
+	remove(path);
+	pRun->pStorage = "persist";
+	InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+
+	Begin(pRun);
+	pList = OpenPersistList(path, pRun->Size + BENCH_MAX_REPS, pRun->Width);
+	if( NULL == pList )
+	{
+		return;
+	}
+	Fill(pRun, pList, pRun->Size);
+	Report(pRun, "pushback", pRun->Size);
+
+	Begin(pRun);
+	pList->flush(pList);
+	Report(pRun, "flush", pRun->Size);
+
+	Begin(pRun);
+	pList->foreach(pList, Touch);
+	Report(pRun, "foreach", pRun->Size);
+
+	pList->destroy(&pList);
+	Begin(pRun);
+	pList = OpenPersistList(path, pRun->Size + BENCH_MAX_REPS, pRun->Width);
+	Report(pRun, "reopen", 1);
+
+	if( NULL != pList )
+	{
+		pList->destroy(&pList);
+	}
+	remove(path);
+#else
+	(void)path;
+#endif
+}
+
+#if LIST_USE_PTHREAD
+typedef struct bench_worker
+{
+	bench_run_t* pRun;
+	list_t* pList;
+	shard_list_t* pShardList;
+	pthread_mutex_t* pMutex;
+	unsigned int Ops;
+	unsigned int Reader;
+	volatile int* pStop;
+	unsigned long long Done;
+}bench_worker_t;
+
+/* 每轮push一个再pop一个；pMutex非NULL时以互斥锁保护普通链表作为对照 */
+static void* StackWorker(void* pArg)
+{
+	bench_worker_t* pWorker = (bench_worker_t*)pArg;
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < pWorker->Ops; counter++ )
+	{
+		if( NULL != pWorker->pMutex )
+		{
+			pthread_mutex_lock(pWorker->pMutex);
+		}
+
+		pWorker->pList->pushfront(pWorker->pList, &counter);
+		pWorker->pList->popfront(pWorker->pList);
+
+		if( NULL != pWorker->pMutex )
+		{
+			pthread_mutex_unlock(pWorker->pMutex);
+		}
+	}
+
+	return NULL;
+}
+
+static void* WriterWorker(void* pArg)
+{
+	bench_worker_t* pWorker = (bench_worker_t*)pArg;
+
+	StackWorker(pArg);
+	*pWorker->pStop = 1;
+
+	return NULL;
+}
+
+static void* ShardWorker(void* pArg)
+{
+	bench_worker_t* pWorker = (bench_worker_t*)pArg;
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < pWorker->Ops; counter++ )
+	{
+		if( NULL != pWorker->pShardList )
+		{
+			pWorker->pShardList->push(pWorker->pShardList, &counter);
+		}
+		else
+		{
+			pthread_mutex_lock(pWorker->pMutex);
+			pWorker->pList->pushback(pWorker->pList, &counter);
+			pthread_mutex_unlock(pWorker->pMutex);
+		}
+	}
+
+	return NULL;
+}
+
+/* 读多写少模式下的读者：反复进入临界区做一次随机get */
+static void* ReaderWorker(void* pArg)
+{
+	bench_worker_t* pWorker = (bench_worker_t*)pArg;
+	list_t* pList = pWorker->pList;
+	unsigned int seed = 12345U + pWorker->Reader;
+	unsigned int slot = 0;
+	unsigned int size = 0;
+	void* pData = NULL;
+
+	while( 0 == *pWorker->pStop )
+	{
+		seed = seed * 1103515245U + 12345U;
+		slot = pList->readbegin(pList);
+		size = pList->size(pList);
+		pData = ( 0 == size ) ? NULL : pList->get(pList, ( seed >> 8 ) % ( size < 64 ? size : 64 ));
+		if( NULL != pData )
+		{
+			pWorker->Done += *(unsigned char*)pData;
+		}
+		pList->readend(pList, slot);
+		pWorker->Ops++;
+	}
+
+	return NULL;
+}
+
+static void RunThreads(bench_worker_t* pWorkers, unsigned int count, void* (*entry)(void*))
+{
+	pthread_t threads[64];
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		pthread_create(&threads[counter], NULL, entry, &pWorkers[counter]);
+	}
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		pthread_join(threads[counter], NULL);
+	}
+}
+
+/* 并发栈、分片链表与读多写少模式的多线程吞吐 */
+static void RunConcurrentExtras(bench_run_t* pRun, unsigned int max_threads)
+{
+	bench_worker_t workers[64];
+	pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+	pthread_t writer;
+	volatile int stop = 0;
+	list_t* pList = NULL;
+	shard_list_t* pShardList = NULL;
+	char label[32];
+	unsigned int threads = 0;
+	unsigned int counter = 0;
+	unsigned int ops = ( pRun->Size < 100000 ) ? pRun->Size : 100000;
+	unsigned int total = 0;
+
+	InitCountingAllocator(&pRun->Allocator, &pRun->Stats, NULL);
+
+	for( threads = 1; threads <= max_threads && threads <= 32; threads *= 2 )
+	{
+		sprintf(label, "threads=%u", threads);
+		pRun->pStorage = label;
+		memset(workers, 0, sizeof(workers));
+
+		pList = CreateList(threads + 1, sizeof(unsigned int));
+		for( counter = 0; counter < threads; counter++ )
+		{
+			workers[counter].pList = pList;
+			workers[counter].pMutex = &mutex;
+			workers[counter].Ops = ops;
+		}
+		Begin(pRun);
+		RunThreads(workers, threads, StackWorker);
+		Report(pRun, "stack_mutex", ops * threads);
+
+		pList->setconcurrent(pList, 1);
+		for( counter = 0; counter < threads; counter++ )
+		{
+			workers[counter].pMutex = NULL;
+		}
+		Begin(pRun);
+		RunThreads(workers, threads, StackWorker);
+		Report(pRun, "stack_lockfree", ops * threads);
+		pList->setconcurrent(pList, 0);
+		pList->destroy(&pList);
+
+		pList = CreateList(ops * threads, sizeof(unsigned int));
+		for( counter = 0; counter < threads; counter++ )
+		{
+			workers[counter].pList = pList;
+			workers[counter].pMutex = &mutex;
+		}
+		Begin(pRun);
+		RunThreads(workers, threads, ShardWorker);
+		Report(pRun, "push_mutex", ops * threads);
+		pList->destroy(&pList);
+
+		pShardList = CreateShardList(ops * threads, sizeof(unsigned int), 0, NULL, NULL);
+		for( counter = 0; counter < threads; counter++ )
+		{
+			workers[counter].pShardList = pShardList;
+		}
+		Begin(pRun);
+		RunThreads(workers, threads, ShardWorker);
+		Report(pRun, "push_shard", ops * threads);
+		pShardList->destroy(&pShardList);
+
+		/* threads个读者与一个反复pushfront/popfront的写者并发 */
+		pList = CreateList(ops + 1, sizeof(unsigned int));
+		Fill(pRun, pList, 64);
+		pList->setreadmostly(pList, 1);
+		memset(workers, 0, sizeof(workers));
+		stop = 0;
+		for( counter = 0; counter <= threads; counter++ )
+		{
+			workers[counter].pList = pList;
+			workers[counter].Reader = counter;
+			workers[counter].pStop = &stop;
+		}
+		workers[threads].Ops = ops;
+		Begin(pRun);
+		pthread_create(&writer, NULL, WriterWorker, &workers[threads]);
+		RunThreads(workers, threads, ReaderWorker);
+		pthread_join(writer, NULL);
+		total = 0;
+		for( counter = 0; counter < threads; counter++ )
+		{
+			total += workers[counter].Ops;
+			Sink += workers[counter].Done;
+		}
+		Report(pRun, "readmostly_get", total);
+		pList->setreadmostly(pList, 0);
+		pList->destroy(&pList);
+	}
+}
+#endif
+
+static int ParseArgs(bench_config_t* pConfig, int argc, char** argv)
+{
+	int counter = 0;
+
+	pConfig->pStorage = "all";
+	pConfig->pSuite = "all";
+	pConfig->MaxSize = BENCH_DEFAULT_MAX_SIZE;
+	pConfig->MaxWidth = BENCH_DEFAULT_MAX_WIDTH;
+	pConfig->Budget = BENCH_DEFAULT_BUDGET;
+	pConfig->Threads = ( sysconf(_SC_NPROCESSORS_ONLN) > 1 ) ? (unsigned int)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	pConfig->Json = 0;
+
+	for( counter = 1; counter + 1 < argc; counter += 2 )
+	{
+		if( 0 == strcmp(argv[counter], "--format") )
+		{
+			pConfig->Json = ( 0 == strcmp(argv[counter + 1], "json") );
+		}
+		else if( 0 == strcmp(argv[counter], "--storage") )
+		{
+			pConfig->pStorage = argv[counter + 1];
+		}
+		else if( 0 == strcmp(argv[counter], "--suite") )
+		{
+			pConfig->pSuite = argv[counter + 1];
+		}
+		else if( 0 == strcmp(argv[counter], "--threads") )
+		{
+			pConfig->Threads = (unsigned int)strtoul(argv[counter + 1], NULL, 10);
+		}
+		else if( 0 == strcmp(argv[counter], "--max-size") )
+		{
+			pConfig->MaxSize = (unsigned int)strtoul(argv[counter + 1], NULL, 10);
+		}
+		else if( 0 == strcmp(argv[counter], "--max-width") )
+		{
+			pConfig->MaxWidth = (unsigned int)strtoul(argv[counter + 1], NULL, 10);
+		}
+		else if( 0 == strcmp(argv[counter], "--budget") )
+		{
+			pConfig->Budget = strtoull(argv[counter + 1], NULL, 10);
+		}
+		else
+		{
+			return OPERATE_FAIL;
+		}
+	}
+
+	return ( counter == argc ) ? OPERATE_SUCC : OPERATE_FAIL;
+}
+
+int main(int argc, char** argv)
+{
+	static const char* storages[] = { "node", "pool", "cursor", "unrolled", "skip", "vector" };
+	static const unsigned int sizes[] = { 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+	static const unsigned int widths[] = { 4, 64, 512, 4096 };
+	bench_config_t config;
+	bench_run_t run;
+	unsigned int storage = 0;
+	unsigned int size = 0;
+	unsigned int width = 0;
+	int result = 0;
+
+	if( OPERATE_FAIL == ParseArgs(&config, argc, argv) )
+	{
+		fprintf(stderr, "usage: %s [--format csv|json] [--suite matrix|extra|all]"
+			" [--storage node|pool|cursor|unrolled|skip|vector|all] [--max-size N] [--max-width N]"
+			" [--budget N] [--threads N]\n", argv[0]);
+		return 2;
+	}
+
+	memset(&run, 0, sizeof(run));
+	run.pConfig = &config;
+	run.Seed = 2463534242U;
+	run.pPayload = (char*)calloc(1, BENCH_DEFAULT_MAX_WIDTH > config.MaxWidth ? BENCH_DEFAULT_MAX_WIDTH : config.MaxWidth);
+
+	if( NULL == run.pPayload )
+	{
+		return 1;
+	}
+
+	printf( config.Json ? "[\n" : "op,storage,size,width,ops,ns_per_op,allocs_per_op,frees_per_op,peak_bytes,rss_kb,gb_per_s\n" );
+
+	for( storage = 0; storage < sizeof(storages) / sizeof(storages[0]) && 0 != strcmp(config.pSuite, "extra"); storage++ )
+	{
+		if( 0 != strcmp(config.pStorage, "all") && 0 != strcmp(config.pStorage, storages[storage]) )
+		{
+			continue;
+		}
+
+		for( width = 0; width < sizeof(widths) / sizeof(widths[0]) && widths[width] <= config.MaxWidth; width++ )
+		{
+			for( size = 0; size < sizeof(sizes) / sizeof(sizes[0]) && sizes[size] <= config.MaxSize; size++ )
+			{
+				if( (unsigned long long)sizes[size] * widths[width] > BENCH_MAX_BYTES )
+				{
+					continue;
+				}
+
+				run.pStorage = storages[storage];
+				run.Size = sizes[size];
+				run.Width = widths[width];
+
+				if( OPERATE_FAIL == RunCase(&run) )
+				{
+					fprintf(stderr, "%s size %u width %u failed\n", run.pStorage, run.Size, run.Width);
+					result = 1;
+				}
+			}
+		}
+	}
+
+	if( 0 != strcmp(config.pSuite, "matrix") )
+	{
+		run.Size = ( config.MaxSize < BENCH_EXTRA_SIZE ) ? config.MaxSize : BENCH_EXTRA_SIZE;
+		run.Width = BENCH_EXTRA_WIDTH;
+		RunParallelExtras(&run, ( 0 == config.Threads ) ? 1 : config.Threads);
+		RunLookupExtras(&run);
+		RunStorageExtras(&run);
+#if LIST_USE_PTHREAD
+		RunConcurrentExtras(&run, ( 0 == config.Threads ) ? 1 : config.Threads);
+#endif
+	}
+
+	if( config.Json )
+	{
+		printf("]\n");
+	}
+
+	free(run.pPayload);
+
+	return result;
+}
@@ -0,0 +1,177 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : bench_cpp.cpp
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 对同一组int数据分别用C接口list_t与模板forwardlist<int>
+ 				   执行相同操作，输出两者的ns/op对比
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 用法：bench_cpp [元素个数]，默认1000000；两者结果不一致时
+ 				   返回非0
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "forwardlist.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+static long long Sink;
+
+static double Now()
+{
+	timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static unsigned int IntGreater(const void* pData1, const void* pData2)
+{
+	return ( *(const int*)pData1 > *(const int*)pData2 ) ? OPERATE_TRUE : OPERATE_FALSE;
+}
+
+static unsigned int IntEqual(const void* pData, const void* pRef)
+{
+	return ( *(const int*)pData == *(const int*)pRef ) ? OPERATE_TRUE : OPERATE_FALSE;
+}
+
+static void IntAdd(void* pData)
+{
+	Sink += *(int*)pData;
+}
+
+static void Report(const char* pOp, double c_ns, double cpp_ns, double ops)
+{
+	printf("%-10s C %10.2f  C++ %10.2f ns/op\n", pOp, c_ns / ops, cpp_ns / ops);
+}
+
+int main(int argc, char** argv)
+{
+	unsigned int count = ( argc > 1 ) ? (unsigned int)strtoul(argv[1], NULL, 10) : 1000000U;
+	unsigned int reps = ( count < 2000 ) ? count : 2000;
+	unsigned int counter = 0;
+	int miss = -1;
+	double start = 0;
+	double c_ns = 0;
+	std::vector<int> values(count);
+	list_t* pList = CreateList(count, sizeof(int));
+	forwardlist<int> list(count);
+
+	if( NULL == pList || 0 == count )
+	{
+		return 1;
+	}
+
+	srand(1);
+	for( counter = 0; counter < count; counter++ )
+	{
+		values[counter] = rand();
+	}
+
+	start = Now();
+	for( counter = 0; counter < count; counter++ )
+	{
+		pList->pushback(pList, &values[counter]);
+	}
+	c_ns = Now() - start;
+	start = Now();
+	for( counter = 0; counter < count; counter++ )
+	{
+		list.pushback(values[counter]);
+	}
+	Report("pushback", c_ns, Now() - start, count);
+
+	start = Now();
+	for( counter = 0; counter < reps; counter++ )
+	{
+		Sink += *(int*)pList->get(pList, counter);
+	}
+	c_ns = Now() - start;
+	start = Now();
+	for( counter = 0; counter < reps; counter++ )
+	{
+		Sink += *list.get(counter);
+	}
+	Report("get(seq)", c_ns, Now() - start, reps);
+
+	start = Now();
+	pList->foreach(pList, IntAdd);
+	c_ns = Now() - start;
+	start = Now();
+	list.foreach([](int value) { Sink += value; });
+	Report("foreach", c_ns, Now() - start, count);
+
+	start = Now();
+	Sink += ( NULL != pList->findif2(pList, IntEqual, &miss) );
+	c_ns = Now() - start;
+	start = Now();
+	Sink += ( NULL != list.findif2([](int value, int ref) { return value == ref; }, miss) );
+	Report("findif2", c_ns, Now() - start, count);
+
+	start = Now();
+	pList->sortif(pList, IntGreater);
+	c_ns = Now() - start;
+	start = Now();
+	list.sortif(std::greater<int>());
+	Report("sortif", c_ns, Now() - start, count);
+
+	counter = 0;
+	for( forwardlist<int>::iterator it = list.begin(); it != list.end() && counter < reps; ++it, ++counter )
+	{
+		if( *it != *(int*)pList->get(pList, counter) )
+		{
+			fprintf(stderr, "mismatch at %u\n", counter);
+			return 1;
+		}
+	}
+
+	start = Now();
+	for( counter = 0; counter < count; counter++ )
+	{
+		pList->popfront(pList);
+	}
+	c_ns = Now() - start;
+	start = Now();
+	for( counter = 0; counter < count; counter++ )
+	{
+		list.popfront();
+	}
+	Report("popfront", c_ns, Now() - start, count);
+
+	start = Now();
+	for( counter = 0; counter < count; counter++ )
+	{
+		pList->pushfront(pList, &values[counter]);
+	}
+	c_ns = Now() - start;
+	start = Now();
+	for( counter = 0; counter < count; counter++ )
+	{
+		list.pushfront(values[counter]);
+	}
+	Report("pushfront", c_ns, Now() - start, count);
+
+	start = Now();
+	pList->clear(pList);
+	c_ns = Now() - start;
+	start = Now();
+	list.clear();
+	Report("clear", c_ns, Now() - start, count);
+
+	pList->destroy(&pList);
+	printf("checksum %lld\n", Sink % 7);
+
+	return 0;
+}
@@ -11,17 +11,404 @@
  * Function List :
  * 
  * Record        :
- * Others        : 某些操作(e.g. pushback)对于单向链表来说时间复杂度为O(n)，
+ * Others        : 某些操作(e.g. popback)对于单向链表来说时间复杂度为O(n)，
  				   请视数据容量考量某方法的使用与否
  * 1.Date        : 2017-03-21
  *   Author      : bingshuizhilian@yeah.net
  *   Modification: Created file
+ * 2.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加尾指针pTail，pushback/back的时间复杂度降为O(1)
+ * 3.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 元素位置按需计算，插入删除不再重排后续节点的序号
+ * 4.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加定位游标，顺序get(i)均摊O(1)
+ * 5.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加CreateListEx，支持自定义分配器与节点池
+ * 6.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: sortif改为重连节点的稳定自底向上归并排序
+ * 7.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加sortbykey，按整数键字段的稳定LSD基数排序
+ * 8.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加parallelsortif，基于pthread的并行归并排序
+ * 9.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加展开链表存储LIST_STORAGE_UNROLLED
+ * 10.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加可选的跳表索引，按位置访问O(log n)
+ * 11.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加pushfrontn/pushbackn/insertrange/toarray批量接口
+ * 12.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加splice/spliceafter/concat
+ * 13.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加节点迭代器及O(1)的iterinsertafter/itereraseafter
+ * 14.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加单趟遍历的removeif
+ * 15.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加可选的哈希索引与findbykey
+ * 16.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加foreach2/foreachbatch/findifbatch
+ * 17.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加parallelforeach/countif/findall及每个链表的工作线程池
+ * 18.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加无锁并发栈模式setconcurrent
+ * 19.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加基于epoch回收的读多写少模式setreadmostly
+ * 20.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加分片容器CreateShardList
+ * 21.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加savelist/loadlist二进制快照
+ * 22.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加基于mmap的持久化链表OpenPersistList
+ * 23.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加compact/locality
+ * 24.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加连续存储LIST_STORAGE_VECTOR
+ * 25.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加计数分配器InitCountingAllocator
 *************************************************************************************************************/
+#if !WIN32 && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+//flock is not part of POSIX
+#if !WIN32 && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
 #include "forwardlist.h"
 #include "stdlib.h"
 #include "string.h"
 #include "stdio.h"
 
+#if LIST_USE_MMAP
+#include "fcntl.h"
+#include "unistd.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
+#include "sys/file.h"
+#endif
+
+static void* DefaultAlloc(void* pContext, size_t size);
+static void DefaultRelease(void* pContext, void* pMemory);
+static void* CountingAlloc(void* pContext, size_t size);
+static void CountingRelease(void* pContext, void* pMemory);
+static node_t* AllocNode(list_t* pList);
+static void FreeNode(list_t* pList, node_t* pNode);
+static void ReleaseAllNodes(list_t* pList);
+static unsigned int CursorLoadBegin(list_t* pList);
+static int CursorLoadValid(list_t* pList, unsigned int seq);
+static int CursorStoreBegin(list_t* pList, unsigned int* pSeq);
+static void CursorStoreEnd(list_t* pList, unsigned int seq);
+static node_t* LocateNode(list_t* pList, unsigned int index, node_t** ppPrev);
+static int SwapData(list_t* pList, void* pData1, void* pData2);
+static node_t* SplitRun(node_t* pHead, unsigned int count);
+static node_t* MergeRuns(node_t* pLeft, node_t* pRight, unsigned int(*exec)(const void*, const void*), node_t** ppTail);
+static node_t* SortChain(node_t* pHead, unsigned int count, unsigned int(*exec)(const void*, const void*), node_t** ppTail);
+static void SortTaskEntry(void* pJob, unsigned int task);
+static unsigned long long ReadKey(const void* pData, unsigned int key_offset, unsigned int key_width);
+static int IsValidKey(list_t* pList, unsigned int key_offset, unsigned int key_width);
+static unsigned int SkipRandomLevel(list_t* pList);
+static skip_tower_t* AllocSkipTower(list_t* pList, node_t* pNode, unsigned int level);
+static skip_tower_t* SkipSearch(list_t* pList, unsigned int rank, skip_tower_t** ppUpdate, unsigned int* pRanks, unsigned int* pRank);
+static node_t* SkipLocate(list_t* pList, unsigned int index);
+static void SkipInsertTower(list_t* pList, unsigned int index, node_t* pNode);
+static void SkipRemoveTower(list_t* pList, unsigned int index, node_t* pNode);
+static void ReleaseSkipTowers(list_t* pList);
+static void RebuildSkipIndex(list_t* pList);
+static int IsValidHashAttr(const list_attr_t* pAttr, unsigned int carry_data_size);
+static hash_index_t* CreateHashIndex(const list_allocator_t* pAllocator, const list_attr_t* pAttr);
+static unsigned int HashCode(const hash_index_t* pHash, const void* pKey);
+static int HashKeyEqual(const hash_index_t* pHash, const void* pKey1, const void* pKey2);
+static void HashPlace(hash_slot_t* pSlots, unsigned int capacity, node_t* pNode, unsigned int hash);
+static int HashReserve(list_t* pList, unsigned int count);
+static void HashInsertNode(list_t* pList, node_t* pNode);
+static void HashRemoveNode(list_t* pList, node_t* pNode);
+static void HashClear(list_t* pList);
+static int OperatePopFrontCopy(list_t* pList, void* pOut);
+static int OperateSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width);
+static void OperateParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold);
+static void ReservePoolNodes(list_t* pList, unsigned int count);
+static node_t* BuildChain(list_t* pList, const void* pData, unsigned int count, node_t** ppTail);
+static void LinkChain(list_t* pList, unsigned int index, node_t* pFirst, node_t* pLast, unsigned int count);
+static int OperatePushFrontN(list_t* pList, const void* pData, unsigned int count);
+static int OperatePushBackN(list_t* pList, const void* pData, unsigned int count);
+static int OperateInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count);
+static unsigned int OperateToArray(list_t* pList, void* pBuffer, unsigned int capacity);
+static int IsSpliceValid(list_t* pList, unsigned int index, list_t* pSource);
+static int IsRelinkable(list_t* pList, list_t* pSource);
+static void AdoptPool(list_t* pList, list_t* pSource);
+static int SpliceByCopy(list_t* pList, unsigned int index, list_t* pSource);
+static int OperateSplice(list_t* pList, unsigned int index, list_t* pSource);
+static int OperateSpliceAfter(list_t* pList, unsigned int index, list_t* pSource);
+static int OperateConcat(list_t* pList, list_t* pSource);
+static void OperateBeforeBegin(list_t* pList, list_iter_t* pIter);
+static int OperateBegin(list_t* pList, list_iter_t* pIter);
+static int OperateNext(list_t* pList, list_iter_t* pIter);
+static void* OperateDeref(list_t* pList, list_iter_t* pIter);
+static int OperateIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData);
+static int OperateIterEraseAfter(list_t* pList, list_iter_t* pIter);
+static void FreeNodeChain(list_t* pList, node_t* pFirst, node_t* pLast);
+static unsigned int OperateRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static void* OperateFindByKey(list_t* pList, const void* pKey);
+static unsigned int GatherItems(list_t* pList, list_iter_t* pIter, void** ppItems);
+static void OperateForeach2(list_t* pList, void(*exec)(void*, void*), void* pContext);
+static void OperateForeachBatch(list_t* pList, void(*exec)(void**, unsigned int, void*), void* pContext);
+static void* OperateFindIfBatch(list_t* pList, unsigned int(*exec)(void**, unsigned int, void*), void* pContext);
+#if LIST_USE_PTHREAD
+static void* WorkerEntry(void* pArg);
+static worker_pool_t* AcquireWorkers(list_t* pList, unsigned int count);
+#endif //end of LIST_USE_PTHREAD
+static void ReleaseWorkers(list_t* pList);
+static void RunWorkerTasks(list_t* pList, void(*run)(void*, unsigned int), void* pJob, unsigned int count, unsigned int thread_count);
+static void LocateSplits(list_t* pList, list_iter_t* pSplits, unsigned int chunks);
+static void TraverseTaskEntry(void* pArg, unsigned int chunk);
+static void PrepareTraverseJob(list_t* pList, traverse_job_t* pJob, unsigned int thread_count);
+static void OperateParallelForeach(list_t* pList, void(*exec)(void*, void*), void* pContext, unsigned int thread_count);
+static unsigned int OperateCountIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, unsigned int thread_count);
+static unsigned int OperateFindAll(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, void** ppOutput, unsigned int capacity, unsigned int thread_count);
+static unsigned long long PackTagged(node_t* pNode, unsigned long long tag);
+static node_t* TaggedNode(unsigned long long word);
+static void PushTagged(unsigned long long* pTop, node_t* pNode);
+static node_t* PopTagged(unsigned long long* pTop);
+static int OperateSetConcurrent(list_t* pList, int enable);
+static int ConcurrentPushFront(list_t* pList, const void* pData);
+static int ConcurrentPopFront(list_t* pList);
+static int ConcurrentPopFrontCopy(list_t* pList, void* pOut);
+static unsigned int ConcurrentSize(list_t* pList);
+static int ConcurrentEmpty(list_t* pList);
+static int ConcurrentClear(list_t* pList);
+static int ConcurrentDestroy(list_t** ppList);
+static void* RejectPeek(list_t* pList);
+static int RejectList(list_t* pList);
+static int RejectData(list_t* pList, const void* pData);
+static int RejectIndex(list_t* pList, unsigned int index);
+static void* RejectGet(list_t* pList, unsigned int index);
+static void* RejectFindIf(list_t* pList, unsigned int(*exec)(const void*));
+static void* RejectFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static unsigned int RejectFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static unsigned int RejectRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static int RejectIndexData(list_t* pList, unsigned int index, const void* pData);
+static int RejectTwoIndices(list_t* pList, unsigned int arg1, unsigned int arg2);
+static void RejectSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*));
+static void RejectParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold);
+static void RejectResize(list_t* pList, unsigned int new_size);
+static void RejectForeach(list_t* pList, void(*exec)(void*));
+static int RejectDataCount(list_t* pList, const void* pData, unsigned int count);
+static int RejectInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count);
+static unsigned int RejectToArray(list_t* pList, void* pBuffer, unsigned int capacity);
+static int RejectSplice(list_t* pList, unsigned int index, list_t* pSource);
+static int RejectConcat(list_t* pList, list_t* pSource);
+static int RejectIter(list_t* pList, list_iter_t* pIter);
+static void* RejectDeref(list_t* pList, list_iter_t* pIter);
+static int RejectIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData);
+static void* RejectFindByKey(list_t* pList, const void* pKey);
+static void RejectForeach2(list_t* pList, void(*exec)(void*, void*), void* pContext);
+static void RejectForeachBatch(list_t* pList, void(*exec)(void**, unsigned int, void*), void* pContext);
+static void* RejectFindIfBatch(list_t* pList, unsigned int(*exec)(void**, unsigned int, void*), void* pContext);
+static void RejectParallelForeach(list_t* pList, void(*exec)(void*, void*), void* pContext, unsigned int thread_count);
+static unsigned int RejectCountIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, unsigned int thread_count);
+static unsigned int RejectFindAll(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, void** ppOutput, unsigned int capacity, unsigned int thread_count);
+static int RejectFile(list_t* pList, FILE* pFile);
+static unsigned long long RejectLocality(list_t* pList);
+static void BindConcurrentOperations(list_t* pList);
+static void BindNodeOperations(list_t* pList);
+static unsigned int OperateReadBegin(list_t* pList);
+static void OperateReadEnd(list_t* pList, unsigned int slot);
+static void ReleaseRetired(list_t* pList, unsigned int bucket);
+static int AdvanceEpoch(list_t* pList);
+static void RetireNode(list_t* pList, node_t* pNode);
+static int OperateSetReadMostly(list_t* pList, int enable);
+static node_t* ReadMostlyLocate(list_t* pList, unsigned int index);
+static int ReadMostlyLink(list_t* pList, node_t* pPrev, const void* pData);
+static int ReadMostlyUnlink(list_t* pList, node_t* pPrev);
+static void* ReadMostlyFront(list_t* pList);
+static void* ReadMostlyBack(list_t* pList);
+static void* ReadMostlyGet(list_t* pList, unsigned int index);
+static void* ReadMostlyFindIf(list_t* pList, unsigned int(*exec)(const void*));
+static void* ReadMostlyFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static unsigned int ReadMostlyFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static void ReadMostlyForeach(list_t* pList, void(*exec)(void*));
+static unsigned int ReadMostlySize(list_t* pList);
+static int ReadMostlyEmpty(list_t* pList);
+static int ReadMostlyPushFront(list_t* pList, const void* pData);
+static int ReadMostlyPushBack(list_t* pList, const void* pData);
+static int ReadMostlyPopFront(list_t* pList);
+static int ReadMostlyPopFrontCopy(list_t* pList, void* pOut);
+static int ReadMostlyPopBack(list_t* pList);
+static int ReadMostlyRemove(list_t* pList, unsigned int index);
+static int ReadMostlyInsertAfter(list_t* pList, unsigned int index, const void* pData);
+static int ReadMostlyAssign(list_t* pList, unsigned int index, const void* pData);
+static int ReadMostlyClear(list_t* pList);
+static int ReadMostlyDestroy(list_t** ppList);
+static void BindReadMostlyOperations(list_t* pList);
+static void SnapshotSum(snapshot_t* pSnapshot, const char* pBytes, unsigned int bytes);
+static void SnapshotFlush(snapshot_t* pSnapshot);
+static void SnapshotCollect(void** ppItems, unsigned int count, void* pContext);
+static int SnapshotBegin(list_t* pList, snapshot_t* pSnapshot, FILE* pStream);
+static int OperateSaveList(list_t* pList, FILE* pStream);
+static void DescribeListAttr(list_t* pList, list_attr_t* pAttr);
+static void SwapListContents(list_t* pList, list_t* pOther);
+static int OperateLoadList(list_t* pList, FILE* pStream);
+static int OperateFlush(list_t* pList);
+static persist_header_t* PersistHeader(list_t* pList);
+static persist_node_t* PersistNode(list_t* pList, unsigned long long offset);
+static char* PersistItem(list_t* pList, unsigned long long offset);
+static unsigned long long* PersistLink(list_t* pList, unsigned long long prev);
+static void PersistMarkDirty(list_t* pList);
+static int PersistMapFile(persist_t* pPersist, const char* pPath, int* pCreated);
+static int PersistGrow(list_t* pList);
+static unsigned long long PersistNewNode(list_t* pList, const void* pData);
+static void PersistFreeChain(list_t* pList, unsigned long long first, unsigned long long last);
+static unsigned long long PersistLocate(list_t* pList, unsigned int index);
+static void PersistLinkChain(list_t* pList, unsigned long long prev, unsigned long long first, unsigned long long last, unsigned int count);
+static int PersistUnlink(list_t* pList, unsigned long long prev);
+static void PersistReplace(list_t* pList, unsigned long long prev, unsigned long long oldFirst, unsigned long long oldLast,
+	unsigned long long newFirst, unsigned long long newLast);
+static int PersistRecover(list_t* pList);
+static void PersistUnmap(list_t* pList);
+static int PersistFlush(list_t* pList);
+static void* PersistFront(list_t* pList);
+static void* PersistBack(list_t* pList);
+static int PersistPushFront(list_t* pList, const void* pData);
+static int PersistPushBack(list_t* pList, const void* pData);
+static int PersistPopFront(list_t* pList);
+static int PersistPopBack(list_t* pList);
+static void* PersistGet(list_t* pList, unsigned int index);
+static void* PersistFindIf(list_t* pList, unsigned int(*exec)(const void*));
+static void* PersistFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static unsigned int PersistFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static int PersistRemove(list_t* pList, unsigned int index);
+static int PersistAssign(list_t* pList, unsigned int index, const void* pData);
+static int PersistInsertAfter(list_t* pList, unsigned int index, const void* pData);
+static int PersistSwap(list_t* pList, unsigned int index1, unsigned int index2);
+static list_t* PersistCopyOut(list_t* pList);
+static int PersistRebuild(list_t* pList, list_t* pSorted);
+static void PersistSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*));
+static int PersistSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width);
+static void PersistParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold);
+static void PersistForeach(list_t* pList, void(*exec)(void*));
+static int PersistClear(list_t* pList);
+static int PersistDestroy(list_t** ppList);
+static int PersistInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count);
+static unsigned int PersistToArray(list_t* pList, void* pBuffer, unsigned int capacity);
+static int PersistNext(list_t* pList, list_iter_t* pIter);
+static void* PersistDeref(list_t* pList, list_iter_t* pIter);
+static int PersistIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData);
+static int PersistIterEraseAfter(list_t* pList, list_iter_t* pIter);
+static unsigned int PersistRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static void BindPersistOperations(list_t* pList);
+static int OperateCompact(list_t* pList);
+static void LocalityCollect(void** ppItems, unsigned int count, void* pContext);
+static unsigned long long OperateLocality(list_t* pList);
+static int ShardLock(shard_t* pShard, int blocking);
+static void ShardUnlock(shard_t* pShard);
+static unsigned int ShardHint(shard_list_t* pShardList);
+static int ShardPush(shard_list_t* pShardList, const void* pData);
+static unsigned int ShardSize(shard_list_t* pShardList);
+static void ShardForeach(shard_list_t* pShardList, void(*exec)(void*, void*), void* pContext);
+static unsigned int ShardDrain(shard_list_t* pShardList, void(*exec)(void*, void*), void* pContext);
+static int ShardDestroy(shard_list_t** ppShardList);
+static void BindUnrolledOperations(list_t* pList);
+static block_t* AllocBlock(list_t* pList);
+static void FreeBlock(list_t* pList, block_t* pBlock);
+static char* BlockItem(list_t* pList, block_t* pBlock, unsigned int offset);
+static block_t* LocateBlock(list_t* pList, unsigned int index, unsigned int* pOffset);
+static void UnlinkBlock(list_t* pList, block_t* pBlock);
+static block_t* SplitBlock(list_t* pList, block_t* pBlock, unsigned int offset);
+static int UnrolledInsertAt(list_t* pList, unsigned int index, const void* pData);
+static void UnrolledRemoveAt(list_t* pList, unsigned int index);
+static char** MergeSortItems(char** ppItems, unsigned int count, unsigned int(*exec)(const void*, const void*));
+static char** RadixSortItems(char** ppItems, unsigned int count, unsigned int key_offset, unsigned int key_width);
+static char** CollectUnrolledItems(list_t* pList);
+static int RebuildUnrolledBlocks(list_t* pList, char** ppItems);
+static void* UnrolledFront(list_t* pList);
+static void* UnrolledBack(list_t* pList);
+static int UnrolledPushFront(list_t* pList, const void* pData);
+static int UnrolledPushBack(list_t* pList, const void* pData);
+static int UnrolledPopFront(list_t* pList);
+static int UnrolledPopBack(list_t* pList);
+static void* UnrolledGet(list_t* pList, unsigned int index);
+static void* UnrolledFindIf(list_t* pList, unsigned int(*exec)(const void*));
+static void* UnrolledFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static unsigned int UnrolledFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static int UnrolledRemove(list_t* pList, unsigned int index);
+static int UnrolledAssign(list_t* pList, unsigned int index, const void* pData);
+static int UnrolledInsertAfter(list_t* pList, unsigned int index, const void* pData);
+static int UnrolledSwap(list_t* pList, unsigned int index1, unsigned int index2);
+static void UnrolledSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*));
+static int UnrolledSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width);
+static void UnrolledParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold);
+static void UnrolledForeach(list_t* pList, void(*exec)(void*));
+static int UnrolledInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count);
+static unsigned int UnrolledToArray(list_t* pList, void* pBuffer, unsigned int capacity);
+static int UnrolledSplice(list_t* pList, unsigned int index, list_t* pSource);
+static int UnrolledNext(list_t* pList, list_iter_t* pIter);
+static void* UnrolledDeref(list_t* pList, list_iter_t* pIter);
+static int UnrolledIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData);
+static int UnrolledIterEraseAfter(list_t* pList, list_iter_t* pIter);
+static unsigned int UnrolledRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static void* UnrolledFindByKey(list_t* pList, const void* pKey);
+static int UnrolledCompact(list_t* pList);
+static void BindVectorOperations(list_t* pList);
+static char* VectorItem(list_t* pList, unsigned int index);
+static int VectorResize(list_t* pList, unsigned int capacity);
+static int VectorReserve(list_t* pList, unsigned int count);
+static int VectorInsertAt(list_t* pList, unsigned int index, const void* pData, unsigned int count);
+static void VectorRemoveAt(list_t* pList, unsigned int index);
+static void* VectorFront(list_t* pList);
+static void* VectorBack(list_t* pList);
+static int VectorPushFront(list_t* pList, const void* pData);
+static int VectorPushBack(list_t* pList, const void* pData);
+static int VectorPopFront(list_t* pList);
+static int VectorPopBack(list_t* pList);
+static void* VectorGet(list_t* pList, unsigned int index);
+static void* VectorFindIf(list_t* pList, unsigned int(*exec)(const void*));
+static void* VectorFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static unsigned int VectorFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static int VectorRemove(list_t* pList, unsigned int index);
+static int VectorAssign(list_t* pList, unsigned int index, const void* pData);
+static int VectorInsertAfter(list_t* pList, unsigned int index, const void* pData);
+static int VectorSwap(list_t* pList, unsigned int index1, unsigned int index2);
+static char** CollectVectorItems(list_t* pList);
+static int RebuildVector(list_t* pList, char** ppItems);
+static void VectorSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*));
+static int VectorSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width);
+static void VectorParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold);
+static void VectorForeach(list_t* pList, void(*exec)(void*));
+static int VectorInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count);
+static unsigned int VectorToArray(list_t* pList, void* pBuffer, unsigned int capacity);
+static int VectorSplice(list_t* pList, unsigned int index, list_t* pSource);
+static int VectorNext(list_t* pList, list_iter_t* pIter);
+static void* VectorDeref(list_t* pList, list_iter_t* pIter);
+static int VectorIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData);
+static int VectorIterEraseAfter(list_t* pList, list_iter_t* pIter);
+static unsigned int VectorRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef);
+static void* VectorFindByKey(list_t* pList, const void* pKey);
+static int VectorCompact(list_t* pList);
+
 /*****************************************************************************
  * Function      : CreateList
  * Description   : 创建链表容器，需传入链表的大小，以及节点所挂数据的大小
@@ -34,23 +421,250 @@
  * 1.Date        : 20170321
  *   Author      : bingshuizhilian@yeah.net
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 转发至CreateListEx
 *****************************************************************************/
 list_t* CreateList( unsigned int max_size, unsigned int carry_data_size )
+{
+	return CreateListEx( max_size, carry_data_size, NULL );
+}
+
+/*****************************************************************************
+ * Function      : CreateListEx
+ * Description   : 按属性创建链表容器，属性中可指定内存分配器以及节点池
+ * Input         : unsigned int max_size         
+                unsigned int carry_data_size  
+                const list_attr_t* pAttr  为NULL时等同于CreateList
+ * Output        : None
+ * Return        : 
+ * Others        : pAttr->pAllocator为NULL时使用LIST_MALLOC/LIST_FREE；
+ 				   pAttr->PoolNodesPerSlab非0时，节点从每块可容纳该数量节点的
+ 				   大块内存中切分，删除的节点回收复用，clear/destroy时整块释放，
+ 				   单块超过UINT_MAX字节时每块的节点数自动下调；
+ 				   pAttr->Storage为LIST_STORAGE_UNROLLED时，每块连续存放最多
+ 				   pAttr->BlockItems个元素(0表示LIST_UNROLLED_DEFAULT_ITEMS)，
+ 				   此时不使用节点池，操作接口不变；节点存储下pAttr->SkipIndex
+ 				   非0时建立可按位置索引的跳表，get/insert/remove等按位置的
+ 				   操作期望时间复杂度为O(logn)；pAttr->HashIndex非0时按
+ 				   HashKeyOffset/HashKeyWidth(或hash/keyequal回调)指定的键
+ 				   建立哈希索引供findbykey使用，配置无效时返回NULL；
+ 				   LIST_STORAGE_VECTOR时全部元素存放在一块可增长的连续内存中，
+ 				   按位置访问为O(1)；LIST_STORAGE_PERSIST只能经由
+ 				   OpenPersistList创建；get等按位置的查找记录上次定位的位置，
+ 				   顺序访问为均摊O(1)，游标经序列号发布，get仍可在读锁下并发
+ 				   调用；pAttr->CursorCache非0时游标改以普通写更新，省去原子
+ 				   操作，但get随之成为修改容器的操作，不能与其他读操作并发
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 增加存储方式选择，支持展开链表
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 增加可选的哈希索引
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 绑定popfrontcopy/setconcurrent并初始化并发模式成员
+ * 5.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 绑定readbegin/readend/setreadmostly
+ * 6.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 绑定savelist/loadlist
+ * 7.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 绑定flush，拒绝直接创建持久化存储
+ * 8.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 绑定compact/locality
+ * 9.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 增加连续存储(vector)
+ * 10.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 增加可选的游标缓存CursorCache
+ * 11.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 节点池单块大小不超过UINT_MAX字节
+ * 12.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 节点存储的接口绑定移至BindNodeOperations
+ * 13.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 游标默认启用，CursorCache改为可选的普通写游标
+*****************************************************************************/
+list_t* CreateListEx( unsigned int max_size, unsigned int carry_data_size, const list_attr_t* pAttr )
 {
 	list_t* pList = NULL;
+	pool_t* pPool = NULL;
+	skip_tower_t* pSkipHeader = NULL;
+	hash_index_t* pHash = NULL;
+	list_allocator_t allocator = { DefaultAlloc, DefaultRelease, NULL };
+
+	if( NULL != pAttr && NULL != pAttr->pAllocator )
+	{
+		allocator = *pAttr->pAllocator;
+	}
+
+	if( NULL != pAttr && 0 != pAttr->HashIndex && OPERATE_FALSE == IsValidHashAttr(pAttr, carry_data_size) )
+	{
+		return NULL;
+	}
+
+	if( NULL != pAttr && LIST_STORAGE_PERSIST == pAttr->Storage )
+	{
+		return NULL;
+	}
 	
-	pList = (list_t*)LIST_MALLOC(sizeof(list_t));
+	pList = (list_t*)allocator.alloc(allocator.pContext, sizeof(list_t));
 	
 	if( NULL == pList )
 	{
-		return OPERATE_FAIL;
+		return NULL;
+	}
+
+	if( NULL != pAttr && 0 != pAttr->PoolNodesPerSlab && LIST_STORAGE_NODE == pAttr->Storage )
+	{
+		pPool = (pool_t*)allocator.alloc(allocator.pContext, sizeof(pool_t));
+
+		if( NULL == pPool )
+		{
+			allocator.release(allocator.pContext, pList);
+			return NULL;
+		}
+
+		pPool->pSlabs = NULL;
+		pPool->pFreeNodes = NULL;
+		pPool->pCarve = NULL;
+		pPool->CarveLeft = 0;
+		pPool->NodeSize = LIST_POOL_ROUNDUP( sizeof(node_t) + carry_data_size );
+		pPool->NodesPerSlab = pAttr->PoolNodesPerSlab;
+
+		if( 0 != max_size && max_size < pPool->NodesPerSlab )
+		{
+			pPool->NodesPerSlab = max_size;
+		}
+
+		/* 单块的字节数须能以unsigned int表示，数据过大以至于一个节点都放不下时创建失败 */
+		if( carry_data_size > UINT_MAX - LIST_POOL_ROUNDUP( sizeof(slab_t) ) - LIST_POOL_ROUNDUP( sizeof(node_t) ) )
+		{
+			allocator.release(allocator.pContext, pPool);
+			allocator.release(allocator.pContext, pList);
+			return NULL;
+		}
+
+		if( pPool->NodesPerSlab > ( UINT_MAX - LIST_POOL_ROUNDUP( sizeof(slab_t) ) ) / pPool->NodeSize )
+		{
+			pPool->NodesPerSlab = ( UINT_MAX - LIST_POOL_ROUNDUP( sizeof(slab_t) ) ) / pPool->NodeSize;
+		}
+	}
+
+	if( NULL != pAttr && 0 != pAttr->SkipIndex && LIST_STORAGE_NODE == pAttr->Storage )
+	{
+		pSkipHeader = (skip_tower_t*)allocator.alloc(allocator.pContext,
+			sizeof(skip_tower_t) + ( LIST_SKIP_MAX_LEVEL - 1 ) * sizeof(skip_link_t));
+
+		if( NULL == pSkipHeader )
+		{
+			if( NULL != pPool )
+			{
+				allocator.release(allocator.pContext, pPool);
+			}
+
+			allocator.release(allocator.pContext, pList);
+			return NULL;
+		}
+
+		pSkipHeader->pNode = NULL;
+		pSkipHeader->Level = LIST_SKIP_MAX_LEVEL;
+	}
+
+	if( NULL != pAttr && 0 != pAttr->HashIndex )
+	{
+		pHash = CreateHashIndex(&allocator, pAttr);
+
+		if( NULL == pHash )
+		{
+			if( NULL != pSkipHeader )
+			{
+				allocator.release(allocator.pContext, pSkipHeader);
+			}
+
+			if( NULL != pPool )
+			{
+				allocator.release(allocator.pContext, pPool);
+			}
+
+			allocator.release(allocator.pContext, pList);
+			return NULL;
+		}
 	}
 	
+	pList->Allocator = allocator;
+	pList->pPool = pPool;
 	pList->Size = 0;
 	pList->MaxSize = max_size;
 	pList->CarryDataSize = carry_data_size;
 	pList->pHead = NULL;
+	pList->pTail = NULL;
+	pList->pCursor = NULL;
+	pList->CursorIndex = 0;
+	pList->CursorSeq = 0;
+	pList->CursorCache = ( NULL != pAttr && 0 != pAttr->CursorCache ) ? OPERATE_TRUE : OPERATE_FALSE;
+	pList->Storage = ( NULL != pAttr ) ? pAttr->Storage : LIST_STORAGE_NODE;
+	pList->BlockItems = ( NULL != pAttr && 0 != pAttr->BlockItems ) ? pAttr->BlockItems : LIST_UNROLLED_DEFAULT_ITEMS;
+	pList->pHeadBlock = NULL;
+	pList->pTailBlock = NULL;
+	pList->pCursorBlock = NULL;
+	pList->pSkipHeader = pSkipHeader;
+	pList->SkipLevel = 0;
+	pList->SkipSeed = LIST_SKIP_SEED;
+	pList->pHash = pHash;
+	pList->Revision = 0;
+	pList->pWorkers = NULL;
+	pList->pSplits = NULL;
+	pList->SplitChunks = 0;
+	pList->SplitRevision = ~0U;
+	pList->SplitBuilding = 0;
+	pList->Concurrent = OPERATE_FALSE;
+	pList->ConcurrentHead = 0;
+	pList->ConcurrentFree = 0;
+	pList->pReclaim = NULL;
+	pList->pPersist = NULL;
+	pList->pVector = NULL;
+	pList->VectorCapacity = 0;
+
+	BindNodeOperations(pList);
+
+	if( LIST_STORAGE_UNROLLED == pList->Storage )
+	{
+		BindUnrolledOperations(pList);
+	}
+	else if( LIST_STORAGE_VECTOR == pList->Storage )
+	{
+		BindVectorOperations(pList);
+	}
 
+	return pList;
+}
+
+/*****************************************************************************
+ * Function      : BindNodeOperations
+ * Description   : 内部实现接口，将全部操作接口绑定为节点存储的实现
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 创建链表及退出并发栈模式时调用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void BindNodeOperations(list_t* pList)
+{
 	pList->front = OperateFront;
 	pList->back = OperateBack;
 	pList->pushfront = OperatePushFront;
@@ -67,6 +681,8 @@ list_t* CreateList( unsigned int max_size, unsigned int carry_data_size )
 	pList->insertafter = OperateInsertAfter;
 	pList->swap = OperateSwap;
 	pList->sortif = OperateSortIf;
+	pList->sortbykey = OperateSortByKey;
+	pList->parallelsortif = OperateParallelSortIf;
 	pList->size = OperateSize;
 	pList->capacity = OperateCapacity;
 	pList->resize = OperateResize;
@@ -75,227 +691,703 @@ list_t* CreateList( unsigned int max_size, unsigned int carry_data_size )
 	pList->clear = OperateClear;
 	pList->destroy = OperateDestroy;
 	pList->foreach = OperateForeach;
+	pList->pushfrontn = OperatePushFrontN;
+	pList->pushbackn = OperatePushBackN;
+	pList->insertrange = OperateInsertRange;
+	pList->toarray = OperateToArray;
+	pList->splice = OperateSplice;
+	pList->spliceafter = OperateSpliceAfter;
+	pList->concat = OperateConcat;
+	pList->beforebegin = OperateBeforeBegin;
+	pList->begin = OperateBegin;
+	pList->next = OperateNext;
+	pList->deref = OperateDeref;
+	pList->iterinsertafter = OperateIterInsertAfter;
+	pList->itereraseafter = OperateIterEraseAfter;
+	pList->removeif = OperateRemoveIf;
+	pList->findbykey = OperateFindByKey;
+	pList->foreach2 = OperateForeach2;
+	pList->foreachbatch = OperateForeachBatch;
+	pList->findifbatch = OperateFindIfBatch;
+	pList->parallelforeach = OperateParallelForeach;
+	pList->countif = OperateCountIf;
+	pList->findall = OperateFindAll;
+	pList->popfrontcopy = OperatePopFrontCopy;
+	pList->setconcurrent = OperateSetConcurrent;
+	pList->readbegin = OperateReadBegin;
+	pList->readend = OperateReadEnd;
+	pList->setreadmostly = OperateSetReadMostly;
+	pList->savelist = OperateSaveList;
+	pList->loadlist = OperateLoadList;
+	pList->flush = OperateFlush;
+	pList->compact = OperateCompact;
+	pList->locality = OperateLocality;
+}
 
-	return pList;
+/*****************************************************************************
+ * Function      : CreateShardList
+ * Description   : 创建分片容器，元素分散存放于shard_count个各自加锁的链表
+ 				   容器中，适合无序的工作项集合的高并发插入
+ * Input         : unsigned int max_size         所有分片合计的容量
+                unsigned int carry_data_size  
+                unsigned int shard_count  为0时使用LIST_SHARD_DEFAULT_COUNT
+                const list_attr_t* pAttr  每个分片链表的属性，可为NULL
+                unsigned int (*route)(const void*)  可为NULL
+ * Output        : None
+ * Return        : 
+ * Others        : route为NULL时按调用线程分散插入，目标分片被占用或已满时
+ 				   依次尝试其他分片；route非NULL时元素固定插入第
+ 				   route(pData) % shard_count个分片；每个分片的容量为max_size
+ 				   平均分配后向上取整；不支持并发栈模式与读多写少模式
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 属性中的分配器指针改为指向容器自身的副本
+*****************************************************************************/
+shard_list_t* CreateShardList( unsigned int max_size, unsigned int carry_data_size, unsigned int shard_count,
+	const list_attr_t* pAttr, unsigned int (*route)(const void*) )
+{
+	shard_list_t* pShardList = NULL;
+	list_allocator_t allocator = { DefaultAlloc, DefaultRelease, NULL };
+	unsigned int count = ( 0 == shard_count ) ? LIST_SHARD_DEFAULT_COUNT : shard_count;
+	unsigned int i = 0;
+
+	if( NULL != pAttr && NULL != pAttr->pAllocator )
+	{
+		allocator = *pAttr->pAllocator;
+	}
+
+	pShardList = (shard_list_t*)allocator.alloc(allocator.pContext, sizeof(shard_list_t));
+
+	if( NULL == pShardList )
+	{
+		return NULL;
+	}
+
+	pShardList->pShards = (shard_t*)allocator.alloc(allocator.pContext, count * sizeof(shard_t));
+
+	if( NULL == pShardList->pShards )
+	{
+		allocator.release(allocator.pContext, pShardList);
+		return NULL;
+	}
+
+	pShardList->ShardCount = 0;
+	pShardList->ShardMaxSize = max_size / count + ( ( 0 != max_size % count ) ? 1 : 0 );
+	pShardList->CarryDataSize = carry_data_size;
+	pShardList->NextShard = 0;
+	pShardList->Allocator = allocator;
+	pShardList->HasAttr = ( NULL != pAttr ) ? OPERATE_TRUE : OPERATE_FALSE;
+	pShardList->route = route;
+
+	if( NULL != pAttr )
+	{
+		pShardList->Attr = *pAttr;
+		pShardList->Attr.pAllocator = &pShardList->Allocator;
+	}
+
+	pShardList->push = ShardPush;
+	pShardList->size = ShardSize;
+	pShardList->foreach = ShardForeach;
+	pShardList->drain = ShardDrain;
+	pShardList->destroy = ShardDestroy;
+
+	for( i = 0; i < count; i++ )
+	{
+		pShardList->pShards[i].pList = CreateListEx(pShardList->ShardMaxSize, carry_data_size, pAttr);
+
+		if( NULL == pShardList->pShards[i].pList )
+		{
+			ShardDestroy(&pShardList);
+			return NULL;
+		}
+
+#if LIST_USE_PTHREAD
+		pthread_mutex_init(&pShardList->pShards[i].Lock, NULL);
+#endif
+		pShardList->ShardCount++;
+	}
+
+	return pShardList;
 }
 
 /*****************************************************************************
- * Function      : CopyItemToNode
- * Description   : 内部实现接口，更新元素index，容器内部在各种添加/删除/插入操
- 				   作后始终通过UpdateAllItemIndex保证index是按从0开始有序的分配，
- 				   如pushfront一个A元素后，get(0)就一定得到A
- * Input         : list_t* pList
+ * Function      : OpenPersistList
+ * Description   : 打开(不存在时创建)以内存映射文件为存储的持久化链表容器
+ * Input         : const char* pPath  
+                unsigned int max_size  仅在新建文件时使用
+                unsigned int carry_data_size  须与已有文件一致
  * Output        : None
- * Return        : static
- * Others        : 
+ * Return        : 
+ * Others        : 节点位于映射文件中，链接保存为相对文件起始的偏移量，文件
+ 				   空间不足时加倍扩展并重新映射；正常关闭(destroy或flush)后
+ 				   重新打开的时间复杂度为O(1)，无需反序列化；操作接口与节点
+ 				   存储相同，另提供flush作为持久化点；崩溃一致性约定：
+ 				   1.每个修改操作只有一次发布链接的写入，进程在任意时刻崩溃后
+ 				   重新打开，链表都等于该操作之前或之后的状态(removeif逐个
+ 				   删除，resize逐个popback，可能只完成一部分)；
+ 				   2.assign/swap/sort以复制新节点后一次替换的方式实现，不会出现
+ 				   写了一半的数据，sort期间需要约两倍空间；
+ 				   3.上次flush之后有过修改时文件标记为dirty，打开时沿链表做带
+ 				   边界检查的O(n)恢复，重新计算Size/尾节点并回收泄漏的节点，
+ 				   链接损坏时返回NULL而不会返回错误的链表；
+ 				   4.flush返回后到下一次修改之前掉电不丢数据，flush之后的修改
+ 				   在掉电时可能丢失；
+ 				   同一文件同一时刻只能由一个链表打开，以flock保证，已被打开时
+ 				   返回NULL；不存在或为空的文件才新建，非空且不以
+ 				   LIST_PERSIST_MAGIC开头的文件返回NULL且不被修改(新建过程中
+ 				   崩溃留下的文件同样如此，须删除后重新打开)；文件为本机字节序；
+ 				   未启用LIST_USE_MMAP时返回NULL
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 只初始化新建的空文件，并以文件锁保证只有一个打开者
 *****************************************************************************/
-static int UpdateAllItemIndex(list_t* pList)
+list_t* OpenPersistList( const char* pPath, unsigned int max_size, unsigned int carry_data_size )
 {
-	node_t* pScan = pList->pHead;
-	unsigned int counter = 0;
+	list_t* pList = CreateListEx(max_size, carry_data_size, NULL);
+	persist_t* pPersist = NULL;
+	persist_header_t* pHeader = NULL;
+	unsigned int node_size = LIST_POOL_ROUNDUP( sizeof(persist_node_t) + carry_data_size );
+	int created = OPERATE_FALSE;
 
-	for( ; NULL != pScan; pScan = pScan->pNext )
+	if( NULL == pList )
 	{
-		pScan->item.Index = counter++;
+		return NULL;
 	}
 
-	return OPERATE_SUCC;
+	pPersist = (persist_t*)pList->Allocator.alloc(pList->Allocator.pContext, sizeof(persist_t));
+
+	if( NULL == pPersist || OPERATE_FAIL == PersistMapFile(pPersist, pPath, &created) )
+	{
+		if( NULL != pPersist )
+		{
+			pList->Allocator.release(pList->Allocator.pContext, pPersist);
+		}
+
+		pList->destroy(&pList);
+		return NULL;
+	}
+
+	pList->pPersist = pPersist;
+	pList->Storage = LIST_STORAGE_PERSIST;
+	BindPersistOperations(pList);
+	pHeader = PersistHeader(pList);
+
+	if( created )
+	{
+		memset(pHeader, 0, sizeof(persist_header_t));
+		pHeader->Version = LIST_PERSIST_VERSION;
+		pHeader->CarryDataSize = carry_data_size;
+		pHeader->NodeSize = node_size;
+		pHeader->MaxSize = max_size;
+		pHeader->Bump = LIST_PERSIST_DATA_START;
+		LIST_ATOMIC_STORE(&pHeader->Magic, LIST_PERSIST_MAGIC);
+	}
+
+	pHeader->FileSize = pPersist->MapSize;
+
+	if( LIST_PERSIST_MAGIC != pHeader->Magic || LIST_PERSIST_VERSION != pHeader->Version
+		|| carry_data_size != pHeader->CarryDataSize || node_size != pHeader->NodeSize
+		|| LIST_PERSIST_DATA_START > pHeader->Bump || pHeader->Bump > pHeader->FileSize
+		|| 0 != ( pHeader->Bump - LIST_PERSIST_DATA_START ) % node_size
+		|| ( 0 != pHeader->Dirty && OPERATE_FAIL == PersistRecover(pList) ) )
+	{
+		PersistUnmap(pList);
+		OperateDestroy(&pList);
+		return NULL;
+	}
+
+	pList->MaxSize = pHeader->MaxSize;
+	pList->Size = pHeader->Size;
+
+	if( created )
+	{
+		pList->flush(pList);
+	}
+
+	return pList;
 }
 
 /*****************************************************************************
- * Function      : PackageDataWithAutoIndex
- * Description   : 将用户数据组装，并自动分配index，分配原则见UpdateAllItemIndex
- * Input         : node_t* pNode        
-                const void* pData    
-                list_t* pList  
+ * Function      : InitCountingAllocator
+ * Description   : 生成一个统计分配次数与内存占用的分配器，经由list_attr_t的
+ 				   pAllocator传给CreateListEx/CreateShardList后，可据pStats
+ 				   得出每次操作的分配次数与容器的堆内存占用
+ * Input         : list_allocator_t* pAllocator  输出的分配器
+                list_alloc_stats_t* pStats  计数器，须在使用该分配器的所有
+                容器销毁之后才能释放
+                const list_allocator_t* pInner  实际分配内存的分配器，为NULL
+                时使用LIST_MALLOC/LIST_FREE
  * Output        : None
- * Return        : static
- * Others        : 
+ * Return        : 
+ * Others        : 计数器清零；每块内存前附加LIST_STATS_HEADER字节记录大小，
+ 				   LiveBytes/PeakBytes为用户请求的字节数，不含该附加部分及
+ 				   pInner自身的开销；计数器以原子操作更新，可用于并发模式的
+ 				   链表；不适用于OpenPersistList(节点位于映射文件中)
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static item_t* PackageDataWithAutoIndex(node_t* pNode, const void* pData, list_t* pList)
+void InitCountingAllocator( list_allocator_t* pAllocator, list_alloc_stats_t* pStats, const list_allocator_t* pInner )
 {
-	item_t* pItem = &pNode->item;
+	list_allocator_t inner = { DefaultAlloc, DefaultRelease, NULL };
 
-	pItem->Index = pList->Size;
-	pItem->pData = (void*)(pNode + 1);
-	memcpy(pItem->pData, pData, pList->CarryDataSize);
+	if( NULL != pInner )
+	{
+		inner = *pInner;
+	}
 
-	return pItem;
+	pStats->Inner = inner;
+	pStats->Allocs = 0;
+	pStats->Releases = 0;
+	pStats->LiveBytes = 0;
+	pStats->PeakBytes = 0;
+
+	pAllocator->alloc = CountingAlloc;
+	pAllocator->release = CountingRelease;
+	pAllocator->pContext = pStats;
 }
 
 /*****************************************************************************
- * Function      : CopyItemToNode
- * Description   : 内部实现接口，拷贝数据到节点
- * Input         : node_t* pNode        
-                const item_t* pItem  
+ * Function      : DefaultAlloc
+ * Description   : 内部实现接口，默认内存分配器，转发至LIST_MALLOC
+ * Input         : void* pContext  
+                size_t size  
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: size参数改为size_t
 *****************************************************************************/
-static void CopyItemToNode(node_t* pNode, const item_t* pItem)
+static void* DefaultAlloc(void* pContext, size_t size)
 {
-	memcpy( &pNode->item, pItem, sizeof( item_t ) );
+	(void)pContext;
+
+	return LIST_MALLOC(size);
 }
 
 /*****************************************************************************
- * Function      : OperateFront
- * Description   : 返回链表容器首元素
- * Input         : list_t* pList  
+ * Function      : DefaultRelease
+ * Description   : 内部实现接口，默认内存释放器，转发至LIST_FREE
+ * Input         : void* pContext  
+                void* pMemory  
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static void* OperateFront(list_t* pList)
+static void DefaultRelease(void* pContext, void* pMemory)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList))
-	{
-		return NULL;
-	}
-	
-	return pScan->item.pData;
+	(void)pContext;
+
+	LIST_FREE(pMemory);
 }
 
 /*****************************************************************************
- * Function      : OperateBack
- * Description   : 返回链表容器尾元素
- * Input         : list_t* pList  
+ * Function      : CountingAlloc
+ * Description   : 内部实现接口，InitCountingAllocator生成的分配器的alloc，
+ 				   转发至内层分配器并计数
+ * Input         : void* pContext  list_alloc_stats_t*
+                size_t size  
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 分配失败时不计数
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: size参数改为size_t
 *****************************************************************************/
-static void* OperateBack(list_t* pList)
+static void* CountingAlloc(void* pContext, size_t size)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList))
+	list_alloc_stats_t* pStats = (list_alloc_stats_t*)pContext;
+	char* pMemory = NULL;
+	unsigned long long live = 0;
+	unsigned long long peak = 0;
+
+	if( size > (size_t)-1 - LIST_STATS_HEADER )
 	{
 		return NULL;
 	}
 
-	while(NULL != pScan->pNext)
+	pMemory = (char*)pStats->Inner.alloc(pStats->Inner.pContext, size + LIST_STATS_HEADER);
+
+	if( NULL == pMemory )
 	{
-		pScan = pScan->pNext;
+		return NULL;
 	}
 
-	return pScan->item.pData;
+	*(size_t*)pMemory = size;
+	LIST_ATOMIC_ADD(&pStats->Allocs, 1);
+	live = LIST_ATOMIC_ADD(&pStats->LiveBytes, size);
+	peak = LIST_ATOMIC_LOAD_RELAXED(&pStats->PeakBytes);
+
+	while( live > peak && !LIST_ATOMIC_CAS(&pStats->PeakBytes, &peak, live) )
+	{
+	}
+
+	return pMemory + LIST_STATS_HEADER;
 }
 
 /*****************************************************************************
- * Function      : OperatePushFront
- * Description   : 添加一个元素到链表容器头部
- * Input         : list_t* pList      
-                const void* pData  
+ * Function      : CountingRelease
+ * Description   : 内部实现接口，InitCountingAllocator生成的分配器的release
+ * Input         : void* pContext  list_alloc_stats_t*
+                void* pMemory  
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 块头按size_t记录大小
 *****************************************************************************/
-static int OperatePushFront(list_t* pList, const void* pData)
+static void CountingRelease(void* pContext, void* pMemory)
 {
-	node_t* pNewNode = (node_t*)LIST_MALLOC(sizeof(node_t) + pList->CarryDataSize);
-	item_t* pItem = NULL;
-
-	if( NULL == pNewNode )
-	{
-		return OPERATE_FAIL;
-	}
-
-	if( pList->full(pList) )
-	{
-		return OPERATE_FAIL;
-	}
+	list_alloc_stats_t* pStats = (list_alloc_stats_t*)pContext;
+	char* pBase = (char*)pMemory - LIST_STATS_HEADER;
 
-	pItem = PackageDataWithAutoIndex( pNewNode, pData, pList );
-	CopyItemToNode(pNewNode, pItem);
-	pNewNode->pNext = pList->pHead;
-	pList->pHead = pNewNode;
-	pList->Size++;
-	UpdateAllItemIndex(pList);
-	
-	return OPERATE_SUCC;
+	LIST_ATOMIC_ADD(&pStats->Releases, 1);
+	LIST_ATOMIC_SUB(&pStats->LiveBytes, *(size_t*)pBase);
+	pStats->Inner.release(pStats->Inner.pContext, pBase);
 }
 
 /*****************************************************************************
- * Function      : OperatePushBack
- * Description   : 添加一个元素到链表容器尾部
- * Input         : list_t* pList      
-                const void* pData  
+ * Function      : AllocNode
+ * Description   : 内部实现接口，为链表容器分配一个节点(含所挂数据的空间)
+ * Input         : list_t* pList  
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 启用节点池时优先复用已回收的节点，其次从当前块中切分，块用
+ 				   尽时才向分配器申请新块
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 块大小按size_t计算
 *****************************************************************************/
-static int OperatePushBack(list_t* pList, const void* pData)
+static node_t* AllocNode(list_t* pList)
 {
-	node_t* pNewNode = (node_t*)LIST_MALLOC(sizeof(node_t) + pList->CarryDataSize);
-	item_t* pItem = NULL;
-	node_t* pScan = pList->pHead;
+	pool_t* pPool = pList->pPool;
+	slab_t* pSlab = NULL;
+	node_t* pNode = NULL;
 
-	if( NULL == pNewNode )
+	if( NULL == pPool )
 	{
-		return OPERATE_FAIL;
+		return (node_t*)pList->Allocator.alloc(pList->Allocator.pContext, sizeof(node_t) + pList->CarryDataSize);
 	}
 
-	if( pList->full(pList) )
+	if( NULL != pPool->pFreeNodes )
 	{
-		return OPERATE_FAIL;
+		pNode = pPool->pFreeNodes;
+		pPool->pFreeNodes = pNode->pNext;
+
+		return pNode;
 	}
 
-	pItem = PackageDataWithAutoIndex( pNewNode, pData, pList );
-	CopyItemToNode(pNewNode, pItem);
-	pNewNode->pNext = NULL;
-	
-	if( NULL == pScan )
+	if( 0 == pPool->CarveLeft )
 	{
-		pList->pHead = pNewNode;
+		pSlab = (slab_t*)pList->Allocator.alloc(pList->Allocator.pContext,
+			LIST_POOL_ROUNDUP( sizeof(slab_t) ) + (size_t)pPool->NodesPerSlab * pPool->NodeSize);
+
+		if( NULL == pSlab )
+		{
+			return NULL;
+		}
+
+		pSlab->pNext = pPool->pSlabs;
+		pPool->pSlabs = pSlab;
+		pPool->pCarve = (char*)pSlab + LIST_POOL_ROUNDUP( sizeof(slab_t) );
+		pPool->CarveLeft = pPool->NodesPerSlab;
 	}
-	else
+
+	pNode = (node_t*)pPool->pCarve;
+	pPool->pCarve += pPool->NodeSize;
+	pPool->CarveLeft--;
+
+	return pNode;
+}
+
+/*****************************************************************************
+ * Function      : FreeNode
+ * Description   : 内部实现接口，释放一个节点，启用节点池时节点回收至空闲链
+ * Input         : list_t* pList  
+                node_t* pNode  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void FreeNode(list_t* pList, node_t* pNode)
+{
+	pool_t* pPool = pList->pPool;
+
+	if( NULL == pPool )
+	{
+		pList->Allocator.release(pList->Allocator.pContext, pNode);
+		return;
+	}
+
+	pNode->pNext = pPool->pFreeNodes;
+	pPool->pFreeNodes = pNode;
+}
+
+/*****************************************************************************
+ * Function      : ReleaseAllNodes
+ * Description   : 内部实现接口，释放链表容器的全部节点(或块)，启用节点池时整块
+ 				   释放而无需遍历节点
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 仅释放内存，不修改pHead/pTail/Size等成员(pHeadBlock、
+ 				   pVector除外)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同时清空哈希索引
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同时释放连续存储的内存
+*****************************************************************************/
+static void ReleaseAllNodes(list_t* pList)
+{
+	pool_t* pPool = pList->pPool;
+	node_t* pScan = pList->pHead;
+	node_t* pErase = NULL;
+	slab_t* pSlab = NULL;
+	block_t* pBlock = NULL;
+
+	ReleaseSkipTowers(pList);
+	HashClear(pList);
+
+	while(NULL != pList->pHeadBlock)
+	{
+		pBlock = pList->pHeadBlock;
+		pList->pHeadBlock = pBlock->pNext;
+		FreeBlock(pList, pBlock);
+	}
+
+	if( NULL != pList->pVector )
+	{
+		pList->Allocator.release(pList->Allocator.pContext, pList->pVector);
+		pList->pVector = NULL;
+		pList->VectorCapacity = 0;
+	}
+
+	if( NULL == pPool )
 	{
-		while(NULL != pScan->pNext)
+		while(NULL != pScan)
 		{
+			pErase = pScan;
 			pScan = pScan->pNext;
+			FreeNode(pList, pErase);
 		}
-		
-		pScan->pNext = pNewNode;
+
+		return;
 	}
-	
-	pList->Size++;
-	
-	return OPERATE_SUCC;
+
+	while(NULL != pPool->pSlabs)
+	{
+		pSlab = pPool->pSlabs;
+		pPool->pSlabs = pSlab->pNext;
+		pList->Allocator.release(pList->Allocator.pContext, pSlab);
+	}
+
+	pPool->pFreeNodes = NULL;
+	pPool->pCarve = NULL;
+	pPool->CarveLeft = 0;
 }
 
 /*****************************************************************************
- * Function      : OperatePopFront
- * Description   : 删除链表容器首元素
- * Input         : list_t* pList  
+ * Function      : CursorLoadBegin ~ CursorStoreEnd
+ * Description   : 内部实现接口，游标的读取与发布。游标pCursor/pCursorBlock与
+ 				   CursorIndex由序列号CursorSeq保护：读取方先取序列号，读出
+ 				   游标后确认序列号为偶数且未变化，否则视为没有游标；发布方
+ 				   将序列号由偶数CAS为奇数后写入游标，再写回下一个偶数，CAS
+ 				   失败说明另一个线程正在发布，直接放弃本次更新
+ * Input         : list_t* pList
+                unsigned int seq / unsigned int* pSeq  序列号
+ * Output        : None
+ * Return        : static
+ * Others        : 游标只是定位的起点提示，放弃更新不影响结果，因此读锁下的多个
+ 				   get只会互相竞争游标，不会读到不一致的游标；修改容器的操作
+ 				   持有写锁，可直接改写游标；启用CursorCache时不使用序列号，
+ 				   未启用LIST_HAS_ATOMIC且未启用CursorCache时不使用游标
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int CursorLoadBegin(list_t* pList)
+{
+	return LIST_ATOMIC_LOAD(&pList->CursorSeq);
+}
+
+static int CursorLoadValid(list_t* pList, unsigned int seq)
+{
+	if( OPERATE_TRUE == pList->CursorCache )
+	{
+		return OPERATE_TRUE;
+	}
+
+	if( !LIST_HAS_ATOMIC || 0 != ( seq & 1 ) )
+	{
+		return OPERATE_FALSE;
+	}
+
+	LIST_ATOMIC_FENCE_ACQUIRE();
+
+	return ( ( seq == LIST_ATOMIC_LOAD_RELAXED(&pList->CursorSeq) ) ? OPERATE_TRUE : OPERATE_FALSE );
+}
+
+static int CursorStoreBegin(list_t* pList, unsigned int* pSeq)
+{
+	if( OPERATE_TRUE == pList->CursorCache )
+	{
+		return OPERATE_TRUE;
+	}
+
+	if( !LIST_HAS_ATOMIC )
+	{
+		return OPERATE_FALSE;
+	}
+
+	*pSeq = LIST_ATOMIC_LOAD_RELAXED(&pList->CursorSeq);
+
+	return ( ( 0 == ( *pSeq & 1 ) && LIST_ATOMIC_CAS(&pList->CursorSeq, pSeq, *pSeq + 1) ) ? OPERATE_TRUE : OPERATE_FALSE );
+}
+
+static void CursorStoreEnd(list_t* pList, unsigned int seq)
+{
+	if( OPERATE_TRUE != pList->CursorCache )
+	{
+		LIST_ATOMIC_STORE(&pList->CursorSeq, seq + 2);
+	}
+}
+
+/*****************************************************************************
+ * Function      : LocateNode
+ * Description   : 内部实现接口，定位链表容器指定index处的节点，index从0开始。
+ 				   容器不再在每次添加/删除/插入操作后重写所有节点的index，节点
+ 				   位置在遍历时按需计数，因此头部操作为O(1)，而index语义不变，
+ 				   如pushfront一个A元素后，get(0)就一定得到A
+ * Input         : list_t* pList
+                unsigned int index
+                node_t** ppPrev  若非NULL，返回该节点的前驱节点(首节点为NULL)
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需保证index有效；若游标pCursor位于目标之前则从游标处
+ 				   开始查找，并将游标更新为本次定位的节点，因此顺序访问get(0),
+ 				   get(1), ...的均摊复杂度为O(1)；游标经CursorLoadBegin ~
+ 				   CursorStoreEnd读取与发布，get可在读写锁的读锁下并发调用；
+ 				   启用跳表时，游标距目标超过LIST_SKIP_CURSOR_WINDOW则改由跳表
+ 				   定位
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function, 取代UpdateAllItemIndex
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 增加游标缓存
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 仅在启用CursorCache时使用并更新游标
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 游标默认启用，经序列号读取与发布，读锁下并发get不再竞争
+*****************************************************************************/
+static node_t* LocateNode(list_t* pList, unsigned int index, node_t** ppPrev)
+{
+	node_t* pScan = pList->pHead;
+	node_t* pPrev = NULL;
+	node_t* pCursor = NULL;
+	unsigned int cursor_index = 0;
+	unsigned int counter = 0;
+	unsigned int seq = CursorLoadBegin(pList);
+
+	pCursor = LIST_ATOMIC_LOAD_RELAXED(&pList->pCursor);
+	cursor_index = LIST_ATOMIC_LOAD_RELAXED(&pList->CursorIndex);
+
+	if( OPERATE_FALSE == CursorLoadValid(pList, seq) )
+	{
+		pCursor = NULL;
+	}
+
+	if( NULL == ppPrev && index == pList->Size - 1 )
+	{
+		pScan = pList->pTail;
+		counter = index;
+	}
+	else if( NULL != pCursor && cursor_index <= index
+		&& ( NULL == ppPrev || cursor_index < index )
+		&& ( NULL == pList->pSkipHeader || index - cursor_index <= LIST_SKIP_CURSOR_WINDOW ) )
+	{
+		pScan = pCursor;
+		counter = cursor_index;
+	}
+	else if( NULL != pList->pSkipHeader && 0 != index )
+	{
+		pPrev = SkipLocate(pList, index - 1);
+		pScan = pPrev->pNext;
+		counter = index;
+	}
+
+	for( ; counter < index; counter++ )
+	{
+		pPrev = pScan;
+		pScan = pScan->pNext;
+	}
+
+	if( NULL != ppPrev )
+	{
+		*ppPrev = pPrev;
+	}
+
+	if( ( pCursor != pScan || cursor_index != index ) && OPERATE_TRUE == CursorStoreBegin(pList, &seq) )
+	{
+		LIST_ATOMIC_STORE_RELAXED(&pList->pCursor, pScan);
+		LIST_ATOMIC_STORE_RELAXED(&pList->CursorIndex, index);
+		CursorStoreEnd(pList, seq);
+	}
+
+	return pScan;
+}
+
+/*****************************************************************************
+ * Function      : PackageData
+ * Description   : 将用户数据组装到节点
+ * Input         : node_t* pNode        
+                const void* pData    
+                list_t* pList  
  * Output        : None
  * Return        : static
  * Others        : 
@@ -303,691 +1395,10794 @@ static int OperatePushBack(list_t* pList, const void* pData)
  * 1.Date        : 20170321
  *   Author      : bingshuizhilian@yeah.net
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 节点不再保存index，由PackageDataWithAutoIndex更名
+*****************************************************************************/
+static item_t* PackageData(node_t* pNode, const void* pData, list_t* pList)
+{
+	item_t* pItem = &pNode->item;
+
+	pItem->pData = (void*)(pNode + 1);
+	memcpy(pItem->pData, pData, pList->CarryDataSize);
+
+	return pItem;
+}
+
+/*****************************************************************************
+ * Function      : SwapData
+ * Description   : 内部实现接口，交换两个元素的数据
+ * Input         : list_t* pList
+                void* pData1
+                void* pData2
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function, 由OperateSwap中拆分
+*****************************************************************************/
+static int SwapData(list_t* pList, void* pData1, void* pData2)
+{
+	char* pTmpData = (char*)pList->Allocator.alloc(pList->Allocator.pContext, pList->CarryDataSize);
+
+	if( NULL == pTmpData )
+	{
+		return OPERATE_FAIL;
+	}
+
+	memcpy(pTmpData, pData1, pList->CarryDataSize);
+	memcpy(pData1, pData2, pList->CarryDataSize);
+	memcpy(pData2, pTmpData, pList->CarryDataSize);
+	pList->Allocator.release(pList->Allocator.pContext, pTmpData);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : IsValidHashAttr
+ * Description   : 内部实现接口，检查哈希索引的配置是否有效
+ * Input         : const list_attr_t* pAttr  
+                unsigned int carry_data_size  
+ * Output        : None
+ * Return        : static
+ * Others        : 未提供hash/keyequal回调时，要求HashKeyWidth非0且键完全位于
+ 				   用户数据内；提供回调时两者须同时提供，且HashKeyOffset位于
+ 				   用户数据内
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int IsValidHashAttr(const list_attr_t* pAttr, unsigned int carry_data_size)
+{
+	if( ( NULL == pAttr->hash ) != ( NULL == pAttr->keyequal ) )
+	{
+		return OPERATE_FALSE;
+	}
+
+	if( NULL == pAttr->hash && ( 0 == pAttr->HashKeyWidth || carry_data_size < pAttr->HashKeyWidth
+		|| carry_data_size - pAttr->HashKeyWidth < pAttr->HashKeyOffset ) )
+	{
+		return OPERATE_FALSE;
+	}
+
+	if( NULL != pAttr->hash && carry_data_size <= pAttr->HashKeyOffset )
+	{
+		return OPERATE_FALSE;
+	}
+
+	return OPERATE_TRUE;
+}
+
+/*****************************************************************************
+ * Function      : CreateHashIndex
+ * Description   : 内部实现接口，按属性创建哈希索引
+ * Input         : const list_allocator_t* pAllocator  
+                const list_attr_t* pAttr  
+ * Output        : None
+ * Return        : static
+ * Others        : 节点存储时同时分配LIST_HASH_INITIAL_SLOTS个槽；展开链表的
+ 				   元素地址不固定，只保存键的配置，失败返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static hash_index_t* CreateHashIndex(const list_allocator_t* pAllocator, const list_attr_t* pAttr)
+{
+	hash_index_t* pHash = (hash_index_t*)pAllocator->alloc(pAllocator->pContext, sizeof(hash_index_t));
+
+	if( NULL == pHash )
+	{
+		return NULL;
+	}
+
+	pHash->pSlots = NULL;
+	pHash->Capacity = 0;
+	pHash->Count = 0;
+	pHash->KeyOffset = pAttr->HashKeyOffset;
+	pHash->KeyWidth = pAttr->HashKeyWidth;
+	pHash->hash = pAttr->hash;
+	pHash->keyequal = pAttr->keyequal;
+
+	if( LIST_STORAGE_NODE == pAttr->Storage )
+	{
+		pHash->pSlots = (hash_slot_t*)pAllocator->alloc(pAllocator->pContext, LIST_HASH_INITIAL_SLOTS * sizeof(hash_slot_t));
+
+		if( NULL == pHash->pSlots )
+		{
+			pAllocator->release(pAllocator->pContext, pHash);
+			return NULL;
+		}
+
+		memset(pHash->pSlots, 0, LIST_HASH_INITIAL_SLOTS * sizeof(hash_slot_t));
+		pHash->Capacity = LIST_HASH_INITIAL_SLOTS;
+	}
+
+	return pHash;
+}
+
+/*****************************************************************************
+ * Function      : HashCode
+ * Description   : 内部实现接口，计算键的哈希值
+ * Input         : const hash_index_t* pHash  
+                const void* pKey  
+ * Output        : None
+ * Return        : static
+ * Others        : 未提供hash回调时对KeyWidth字节做FNV-1a；结果再经过一次混合，
+ 				   使低位足够分散，便于以2的幂为容量的线性探测
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int HashCode(const hash_index_t* pHash, const void* pKey)
+{
+	const unsigned char* pByte = (const unsigned char*)pKey;
+	unsigned int hash = LIST_HASH_FNV_BASIS;
+	unsigned int counter = 0;
+
+	if( NULL != pHash->hash )
+	{
+		hash = pHash->hash(pKey);
+	}
+	else
+	{
+		for( counter = 0; counter < pHash->KeyWidth; counter++ )
+		{
+			hash = ( hash ^ pByte[counter] ) * LIST_HASH_FNV_PRIME;
+		}
+	}
+
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6BU;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35U;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+/*****************************************************************************
+ * Function      : HashKeyEqual
+ * Description   : 内部实现接口，比较两个键是否相等
+ * Input         : const hash_index_t* pHash  
+                const void* pKey1  
+                const void* pKey2  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int HashKeyEqual(const hash_index_t* pHash, const void* pKey1, const void* pKey2)
+{
+	if( NULL != pHash->keyequal )
+	{
+		return ( pHash->keyequal(pKey1, pKey2) ? OPERATE_TRUE : OPERATE_FALSE );
+	}
+
+	return ( ( 0 == memcmp(pKey1, pKey2, pHash->KeyWidth) ) ? OPERATE_TRUE : OPERATE_FALSE );
+}
+
+/*****************************************************************************
+ * Function      : HashPlace
+ * Description   : 内部实现接口，将节点放入线性探测表中第一个空槽
+ * Input         : hash_slot_t* pSlots  
+                unsigned int capacity  2的幂
+                node_t* pNode  
+                unsigned int hash  
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需保证表中有空槽
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void HashPlace(hash_slot_t* pSlots, unsigned int capacity, node_t* pNode, unsigned int hash)
+{
+	unsigned int slot = hash & ( capacity - 1 );
+
+	while( NULL != pSlots[slot].pNode )
+	{
+		slot = ( slot + 1 ) & ( capacity - 1 );
+	}
+
+	pSlots[slot].pNode = pNode;
+	pSlots[slot].Hash = hash;
+}
+
+/*****************************************************************************
+ * Function      : HashReserve
+ * Description   : 内部实现接口，确保哈希索引还能再容纳count个节点而装载因子
+ 				   不超过1/2，不足时扩容并重新散列
+ * Input         : list_t* pList  
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 未启用哈希索引时直接成功；各插入操作在修改链表之前调用，
+ 				   失败时操作整体失败，因此之后的HashInsertNode不会失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int HashReserve(list_t* pList, unsigned int count)
+{
+	hash_index_t* pHash = pList->pHash;
+	hash_slot_t* pSlots = NULL;
+	unsigned int capacity = 0;
+	unsigned int counter = 0;
+
+	if( NULL == pHash || NULL == pHash->pSlots )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( count > UINT_MAX / 4 - pHash->Count )
+	{
+		return OPERATE_FAIL;
+	}
+
+	for( capacity = pHash->Capacity; capacity < 2 * ( pHash->Count + count ); capacity *= 2 )
+	{
+	}
+
+	if( capacity == pHash->Capacity )
+	{
+		return OPERATE_SUCC;
+	}
+
+	pSlots = (hash_slot_t*)pList->Allocator.alloc(pList->Allocator.pContext, capacity * sizeof(hash_slot_t));
+
+	if( NULL == pSlots )
+	{
+		return OPERATE_FAIL;
+	}
+
+	memset(pSlots, 0, capacity * sizeof(hash_slot_t));
+
+	for( counter = 0; counter < pHash->Capacity; counter++ )
+	{
+		if( NULL != pHash->pSlots[counter].pNode )
+		{
+			HashPlace(pSlots, capacity, pHash->pSlots[counter].pNode, pHash->pSlots[counter].Hash);
+		}
+	}
+
+	pList->Allocator.release(pList->Allocator.pContext, pHash->pSlots);
+	pHash->pSlots = pSlots;
+	pHash->Capacity = capacity;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : HashInsertNode
+ * Description   : 内部实现接口，将新加入链表的节点登记到哈希索引
+ * Input         : list_t* pList  
+                node_t* pNode  
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需先通过HashReserve预留空间
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void HashInsertNode(list_t* pList, node_t* pNode)
+{
+	hash_index_t* pHash = pList->pHash;
+
+	if( NULL == pHash || NULL == pHash->pSlots )
+	{
+		return;
+	}
+
+	HashPlace(pHash->pSlots, pHash->Capacity, pNode,
+		HashCode(pHash, (const char*)pNode->item.pData + pHash->KeyOffset));
+	pHash->Count++;
+}
+
+/*****************************************************************************
+ * Function      : HashRemoveNode
+ * Description   : 内部实现接口，从哈希索引中删除节点
+ * Input         : list_t* pList  
+                node_t* pNode  
+ * Output        : None
+ * Return        : static
+ * Others        : 需在节点数据被修改或释放之前调用；删除后将同一探测序列中
+ 				   后续的槽前移，不使用墓碑标记
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void HashRemoveNode(list_t* pList, node_t* pNode)
+{
+	hash_index_t* pHash = pList->pHash;
+	unsigned int mask = 0;
+	unsigned int slot = 0;
+	unsigned int scan = 0;
+	unsigned int home = 0;
+
+	if( NULL == pHash || NULL == pHash->pSlots )
+	{
+		return;
+	}
+
+	mask = pHash->Capacity - 1;
+	slot = HashCode(pHash, (const char*)pNode->item.pData + pHash->KeyOffset) & mask;
+
+	while( pHash->pSlots[slot].pNode != pNode )
+	{
+		slot = ( slot + 1 ) & mask;
+	}
+
+	for( scan = ( slot + 1 ) & mask; NULL != pHash->pSlots[scan].pNode; scan = ( scan + 1 ) & mask )
+	{
+		home = pHash->pSlots[scan].Hash & mask;
+
+		if( ( ( scan - home ) & mask ) >= ( ( scan - slot ) & mask ) )
+		{
+			pHash->pSlots[slot] = pHash->pSlots[scan];
+			slot = scan;
+		}
+	}
+
+	pHash->pSlots[slot].pNode = NULL;
+	pHash->Count--;
+}
+
+/*****************************************************************************
+ * Function      : HashClear
+ * Description   : 内部实现接口，清空哈希索引，保留已分配的槽
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void HashClear(list_t* pList)
+{
+	hash_index_t* pHash = pList->pHash;
+
+	if( NULL == pHash || NULL == pHash->pSlots || 0 == pHash->Count )
+	{
+		return;
+	}
+
+	memset(pHash->pSlots, 0, pHash->Capacity * sizeof(hash_slot_t));
+	pHash->Count = 0;
+}
+
+/*****************************************************************************
+ * Function      : CopyItemToNode
+ * Description   : 内部实现接口，拷贝数据到节点
+ * Input         : node_t* pNode        
+                const item_t* pItem  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static void CopyItemToNode(node_t* pNode, const item_t* pItem)
+{
+	memcpy( &pNode->item, pItem, sizeof( item_t ) );
+}
+
+/*****************************************************************************
+ * Function      : SplitRun
+ * Description   : 内部实现接口，从pHead开始截取最多count个节点作为一段，返回
+ 				   剩余部分的首节点
+ * Input         : node_t* pHead  
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* SplitRun(node_t* pHead, unsigned int count)
+{
+	node_t* pRest = NULL;
+
+	for( ; NULL != pHead && count > 1; count-- )
+	{
+		pHead = pHead->pNext;
+	}
+
+	if( NULL == pHead )
+	{
+		return NULL;
+	}
+
+	pRest = pHead->pNext;
+	pHead->pNext = NULL;
+
+	return pRest;
+}
+
+/*****************************************************************************
+ * Function      : MergeRuns
+ * Description   : 内部实现接口，按exec将两段有序节点链合并为一段，只修改pNext
+ 				   而不拷贝数据
+ * Input         : node_t* pLeft  
+                node_t* pRight  
+                unsigned int(*exec)(const void*, const void*)  
+                node_t** ppTail  返回合并后的尾节点
+ * Output        : None
+ * Return        : static
+ * Others        : 仅当exec(左, 右)为OPERATE_TRUE时右段节点先行，故合并是稳定的
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* MergeRuns(node_t* pLeft, node_t* pRight, unsigned int(*exec)(const void*, const void*), node_t** ppTail)
+{
+	node_t head;
+	node_t* pTail = &head;
+
+	while( NULL != pLeft && NULL != pRight )
+	{
+		if( OPERATE_TRUE == exec( pLeft->item.pData, pRight->item.pData ) )
+		{
+			pTail->pNext = pRight;
+			pRight = pRight->pNext;
+		}
+		else
+		{
+			pTail->pNext = pLeft;
+			pLeft = pLeft->pNext;
+		}
+
+		pTail = pTail->pNext;
+	}
+
+	pTail->pNext = ( NULL != pLeft ) ? pLeft : pRight;
+
+	while( NULL != pTail->pNext )
+	{
+		pTail = pTail->pNext;
+	}
+
+	*ppTail = pTail;
+
+	return head.pNext;
+}
+
+/*****************************************************************************
+ * Function      : SortChain
+ * Description   : 内部实现接口，对以pHead开始的count个节点组成的节点链做自底
+ 				   向上的归并排序，返回排序后的首节点
+ * Input         : node_t* pHead  
+                unsigned int count  
+                unsigned int(*exec)(const void*, const void*)  
+                node_t** ppTail  返回排序后的尾节点
+ * Output        : None
+ * Return        : static
+ * Others        : 由OperateSortIf中拆分，供sortif与parallelsortif共用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* SortChain(node_t* pHead, unsigned int count, unsigned int(*exec)(const void*, const void*), node_t** ppTail)
+{
+	node_t head;
+	node_t* pTail = NULL;
+	node_t* pRest = NULL;
+	node_t* pLeft = NULL;
+	node_t* pRight = NULL;
+	node_t* pRunTail = NULL;
+	unsigned int width = 1;
+
+	head.pNext = pHead;
+
+	for( ; ; width *= 2 )
+	{
+		pRest = head.pNext;
+		pTail = &head;
+
+		while( NULL != pRest )
+		{
+			pLeft = pRest;
+			pRight = SplitRun(pLeft, width);
+			pRest = SplitRun(pRight, width);
+			pTail->pNext = MergeRuns(pLeft, pRight, exec, &pRunTail);
+			pTail = pRunTail;
+		}
+
+		if( width >= count - width )
+		{
+			break;
+		}
+	}
+
+	*ppTail = pTail;
+
+	return head.pNext;
+}
+
+/*****************************************************************************
+ * Function      : SortTaskEntry
+ * Description   : 内部实现接口，执行第task个排序任务：pRight为NULL时对pHead开始
+ 				   的Count个节点排序，否则将pHead与pRight两段有序链合并
+ * Input         : void* pJob  sort_task_t数组
+                unsigned int task  
+ * Output        : None
+ * Return        : static
+ * Others        : 作为RunWorkerTasks的任务函数，在线程池中执行
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 改为线程池的任务函数，删除RunSortTasks
+*****************************************************************************/
+static void SortTaskEntry(void* pJob, unsigned int task)
+{
+	sort_task_t* pTask = (sort_task_t*)pJob + task;
+
+	if( NULL == pTask->pRight )
+	{
+		pTask->pHead = SortChain(pTask->pHead, pTask->Count, pTask->exec, &pTask->pTail);
+	}
+	else
+	{
+		pTask->pHead = MergeRuns(pTask->pHead, pTask->pRight, pTask->exec, &pTask->pTail);
+		pTask->pRight = NULL;
+	}
+}
+
+/*****************************************************************************
+ * Function      : ReadKey
+ * Description   : 内部实现接口，读取用户数据中key_offset处宽度为key_width字节
+ 				   的无符号整数键值
+ * Input         : const void* pData  
+                unsigned int key_offset  
+                unsigned int key_width  1/2/4/8
+ * Output        : None
+ * Return        : static
+ * Others        : 按本机字节序读取，键值无需对齐
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned long long ReadKey(const void* pData, unsigned int key_offset, unsigned int key_width)
+{
+	const char* pKey = (const char*)pData + key_offset;
+	unsigned char key8 = 0;
+	unsigned short key16 = 0;
+	unsigned int key32 = 0;
+	unsigned long long key64 = 0;
+
+	switch( key_width )
+	{
+		case sizeof(key8):
+			memcpy(&key8, pKey, sizeof(key8));
+			return key8;
+		case sizeof(key16):
+			memcpy(&key16, pKey, sizeof(key16));
+			return key16;
+		case sizeof(key32):
+			memcpy(&key32, pKey, sizeof(key32));
+			return key32;
+		default:
+			memcpy(&key64, pKey, sizeof(key64));
+			return key64;
+	}
+}
+
+/*****************************************************************************
+ * Function      : IsValidKey
+ * Description   : 内部实现接口，检查键值描述是否有效：宽度为1/2/4/8字节且不
+ 				   超出用户数据的范围
+ * Input         : list_t* pList  
+                unsigned int key_offset  
+                unsigned int key_width  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int IsValidKey(list_t* pList, unsigned int key_offset, unsigned int key_width)
+{
+	if( 1 != key_width && 2 != key_width && 4 != key_width && 8 != key_width )
+	{
+		return OPERATE_FALSE;
+	}
+
+	return ( key_offset <= pList->CarryDataSize && key_width <= pList->CarryDataSize - key_offset ) ? OPERATE_TRUE : OPERATE_FALSE;
+}
+
+/*****************************************************************************
+ * Function      : SkipRandomLevel
+ * Description   : 内部实现接口，为新节点随机生成跳表塔的层数
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 每层晋升概率为1/4，返回0表示该节点不建塔；使用链表内的
+ 				   xorshift随机数状态，不依赖全局的rand()
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int SkipRandomLevel(list_t* pList)
+{
+	unsigned int level = 0;
+	unsigned int seed = pList->SkipSeed;
+
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	pList->SkipSeed = seed;
+
+	while( 0 == ( seed & 3 ) && level < LIST_SKIP_MAX_LEVEL )
+	{
+		level++;
+		seed >>= 2;
+	}
+
+	return level;
+}
+
+/*****************************************************************************
+ * Function      : AllocSkipTower
+ * Description   : 内部实现接口，分配一个level层的跳表塔
+ * Input         : list_t* pList  
+                node_t* pNode  
+                unsigned int level  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static skip_tower_t* AllocSkipTower(list_t* pList, node_t* pNode, unsigned int level)
+{
+	skip_tower_t* pTower = (skip_tower_t*)pList->Allocator.alloc(pList->Allocator.pContext,
+		sizeof(skip_tower_t) + ( level - 1 ) * sizeof(skip_link_t));
+
+	if( NULL == pTower )
+	{
+		return NULL;
+	}
+
+	pTower->pNode = pNode;
+	pTower->Level = level;
+
+	return pTower;
+}
+
+/*****************************************************************************
+ * Function      : SkipSearch
+ * Description   : 内部实现接口，在跳表中查找每一层上排名(rank，首元素为1，表头
+ 				   为0)不超过rank的最后一个塔
+ * Input         : list_t* pList  
+                unsigned int rank  
+                skip_tower_t** ppUpdate  若非NULL，返回各层的查找结果
+                unsigned int* pRanks  若非NULL，返回各层查找结果的rank
+                unsigned int* pRank  返回最底层查找结果的rank
+ * Output        : None
+ * Return        : static
+ * Others        : 时间复杂度期望O(logn)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static skip_tower_t* SkipSearch(list_t* pList, unsigned int rank, skip_tower_t** ppUpdate, unsigned int* pRanks, unsigned int* pRank)
+{
+	skip_tower_t* pScan = pList->pSkipHeader;
+	unsigned int scanRank = 0;
+	unsigned int level = pList->SkipLevel;
+
+	while( level-- > 0 )
+	{
+		while( NULL != pScan->Links[level].pNext && scanRank + pScan->Links[level].Span <= rank )
+		{
+			scanRank += pScan->Links[level].Span;
+			pScan = pScan->Links[level].pNext;
+		}
+
+		if( NULL != ppUpdate )
+		{
+			ppUpdate[level] = pScan;
+			pRanks[level] = scanRank;
+		}
+	}
+
+	*pRank = scanRank;
+
+	return pScan;
+}
+
+/*****************************************************************************
+ * Function      : SkipLocate
+ * Description   : 内部实现接口，借助跳表定位指定index处的节点
+ * Input         : list_t* pList  
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需保证index有效；先在跳表中找到不超过目标的最后一个
+ 				   塔，再沿节点链前进期望不超过4步
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* SkipLocate(list_t* pList, unsigned int index)
+{
+	skip_tower_t* pTower = NULL;
+	node_t* pScan = NULL;
+	unsigned int rank = 0;
+
+	pTower = SkipSearch(pList, index + 1, NULL, NULL, &rank);
+
+	if( 0 == rank )
+	{
+		pScan = pList->pHead;
+		rank = 1;
+	}
+	else
+	{
+		pScan = pTower->pNode;
+	}
+
+	for( ; rank < index + 1; rank++ )
+	{
+		pScan = pScan->pNext;
+	}
+
+	return pScan;
+}
+
+/*****************************************************************************
+ * Function      : SkipInsertTower
+ * Description   : 内部实现接口，新节点已链接到index处后，更新跳表
+ * Input         : list_t* pList  
+                unsigned int index  新节点的index
+                node_t* pNode  新节点
+ * Output        : None
+ * Return        : static
+ * Others        : 未启用跳表时直接返回；塔分配失败时新节点不建塔，跳表仍保持
+ 				   正确
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void SkipInsertTower(list_t* pList, unsigned int index, node_t* pNode)
+{
+	skip_tower_t* update[LIST_SKIP_MAX_LEVEL];
+	unsigned int ranks[LIST_SKIP_MAX_LEVEL];
+	skip_tower_t* pTower = NULL;
+	unsigned int level = 0;
+	unsigned int rank = 0;
+	unsigned int i = 0;
+
+	if( NULL == pList->pSkipHeader )
+	{
+		return;
+	}
+
+	SkipSearch(pList, index, update, ranks, &rank);
+	level = SkipRandomLevel(pList);
+
+	if( 0 != level )
+	{
+		pTower = AllocSkipTower(pList, pNode, level);
+	}
+
+	if( NULL == pTower )
+	{
+		level = 0;
+	}
+
+	for( ; pList->SkipLevel < level; pList->SkipLevel++ )
+	{
+		update[pList->SkipLevel] = pList->pSkipHeader;
+		ranks[pList->SkipLevel] = 0;
+		pList->pSkipHeader->Links[pList->SkipLevel].pNext = NULL;
+		pList->pSkipHeader->Links[pList->SkipLevel].Span = 0;
+	}
+
+	for( i = 0; i < level; i++ )
+	{
+		pTower->Links[i].pNext = update[i]->Links[i].pNext;
+		pTower->Links[i].Span = update[i]->Links[i].Span - ( index - ranks[i] );
+		update[i]->Links[i].pNext = pTower;
+		update[i]->Links[i].Span = index + 1 - ranks[i];
+	}
+
+	for( ; i < pList->SkipLevel; i++ )
+	{
+		update[i]->Links[i].Span++;
+	}
+}
+
+/*****************************************************************************
+ * Function      : SkipRemoveTower
+ * Description   : 内部实现接口，节点从index处摘除前，更新跳表
+ * Input         : list_t* pList  
+                unsigned int index  待删除节点的index
+                node_t* pNode  待删除节点
+ * Output        : None
+ * Return        : static
+ * Others        : 未启用跳表时直接返回
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void SkipRemoveTower(list_t* pList, unsigned int index, node_t* pNode)
+{
+	skip_tower_t* update[LIST_SKIP_MAX_LEVEL];
+	unsigned int ranks[LIST_SKIP_MAX_LEVEL];
+	skip_tower_t* pTower = NULL;
+	skip_tower_t* pNext = NULL;
+	unsigned int rank = 0;
+	unsigned int i = 0;
+
+	if( NULL == pList->pSkipHeader )
+	{
+		return;
+	}
+
+	SkipSearch(pList, index, update, ranks, &rank);
+
+	for( i = 0; i < pList->SkipLevel; i++ )
+	{
+		pNext = update[i]->Links[i].pNext;
+
+		if( NULL != pNext && pNext->pNode == pNode )
+		{
+			update[i]->Links[i].Span += pNext->Links[i].Span - 1;
+			update[i]->Links[i].pNext = pNext->Links[i].pNext;
+			pTower = pNext;
+		}
+		else
+		{
+			update[i]->Links[i].Span--;
+		}
+	}
+
+	while( 0 < pList->SkipLevel && NULL == pList->pSkipHeader->Links[pList->SkipLevel - 1].pNext )
+	{
+		pList->SkipLevel--;
+	}
+
+	if( NULL != pTower )
+	{
+		pList->Allocator.release(pList->Allocator.pContext, pTower);
+	}
+}
+
+/*****************************************************************************
+ * Function      : ReleaseSkipTowers
+ * Description   : 内部实现接口，释放跳表的全部塔(表头除外)并清空跳表
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 每个塔至少有一层，因此沿第0层即可遍历全部塔
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void ReleaseSkipTowers(list_t* pList)
+{
+	skip_tower_t* pScan = NULL;
+	skip_tower_t* pErase = NULL;
+
+	if( NULL == pList->pSkipHeader )
+	{
+		return;
+	}
+
+	pScan = ( 0 < pList->SkipLevel ) ? pList->pSkipHeader->Links[0].pNext : NULL;
+
+	while( NULL != pScan )
+	{
+		pErase = pScan;
+		pScan = pScan->Links[0].pNext;
+		pList->Allocator.release(pList->Allocator.pContext, pErase);
+	}
+
+	pList->SkipLevel = 0;
+}
+
+/*****************************************************************************
+ * Function      : RebuildSkipIndex
+ * Description   : 内部实现接口，按当前节点链重新建立跳表
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 供sortif等重新链接节点的操作在完成后调用，时间复杂度O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void RebuildSkipIndex(list_t* pList)
+{
+	skip_tower_t* last[LIST_SKIP_MAX_LEVEL];
+	unsigned int ranks[LIST_SKIP_MAX_LEVEL];
+	skip_tower_t* pTower = NULL;
+	node_t* pScan = NULL;
+	unsigned int level = 0;
+	unsigned int rank = 0;
+	unsigned int i = 0;
+
+	if( NULL == pList->pSkipHeader )
+	{
+		return;
+	}
+
+	ReleaseSkipTowers(pList);
+
+	for( pScan = pList->pHead, rank = 1; NULL != pScan; pScan = pScan->pNext, rank++ )
+	{
+		level = SkipRandomLevel(pList);
+
+		if( 0 == level || NULL == ( pTower = AllocSkipTower(pList, pScan, level) ) )
+		{
+			continue;
+		}
+
+		for( ; pList->SkipLevel < level; pList->SkipLevel++ )
+		{
+			last[pList->SkipLevel] = pList->pSkipHeader;
+			ranks[pList->SkipLevel] = 0;
+		}
+
+		for( i = 0; i < level; i++ )
+		{
+			last[i]->Links[i].pNext = pTower;
+			last[i]->Links[i].Span = rank - ranks[i];
+			last[i] = pTower;
+			ranks[i] = rank;
+		}
+	}
+
+	for( i = 0; i < pList->SkipLevel; i++ )
+	{
+		last[i]->Links[i].pNext = NULL;
+		last[i]->Links[i].Span = rank - ranks[i];
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateFront
+ * Description   : 返回链表容器首元素
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static void* OperateFront(list_t* pList)
+{
+	node_t* pScan = pList->pHead;
+	
+	if(pList->empty(pList))
+	{
+		return NULL;
+	}
+	
+	return pScan->item.pData;
+}
+
+/*****************************************************************************
+ * Function      : OperateBack
+ * Description   : 返回链表容器尾元素
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 通过尾指针直接返回，时间复杂度O(1)
+*****************************************************************************/
+static void* OperateBack(list_t* pList)
+{
+	if(pList->empty(pList))
+	{
+		return NULL;
+	}
+
+	return pList->pTail->item.pData;
+}
+
+/*****************************************************************************
+ * Function      : OperatePushFront
+ * Description   : 添加一个元素到链表容器头部
+ * Input         : list_t* pList      
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 不再调用UpdateAllItemIndex，时间复杂度O(1)
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步游标位置
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperatePushFront(list_t* pList, const void* pData)
+{
+	node_t* pNewNode = AllocNode(pList);
+	item_t* pItem = NULL;
+
+	if( NULL == pNewNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( pList->full(pList) || OPERATE_FAIL == HashReserve(pList, 1) )
+	{
+		FreeNode(pList, pNewNode);
+		return OPERATE_FAIL;
+	}
+
+	pItem = PackageData( pNewNode, pData, pList );
+	CopyItemToNode(pNewNode, pItem);
+	pNewNode->pNext = pList->pHead;
+	pList->pHead = pNewNode;
+
+	if( NULL == pList->pTail )
+	{
+		pList->pTail = pNewNode;
+	}
+
+	if( NULL != pList->pCursor )
+	{
+		pList->CursorIndex++;
+	}
+
+	pList->Size++;
+	pList->Revision++;
+	SkipInsertTower(pList, 0, pNewNode);
+	HashInsertNode(pList, pNewNode);
+	
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperatePushBack
+ * Description   : 添加一个元素到链表容器尾部
+ * Input         : list_t* pList      
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 通过尾指针直接挂接新节点，时间复杂度O(1)
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperatePushBack(list_t* pList, const void* pData)
+{
+	node_t* pNewNode = AllocNode(pList);
+	item_t* pItem = NULL;
+
+	if( NULL == pNewNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( pList->full(pList) || OPERATE_FAIL == HashReserve(pList, 1) )
+	{
+		FreeNode(pList, pNewNode);
+		return OPERATE_FAIL;
+	}
+
+	pItem = PackageData( pNewNode, pData, pList );
+	CopyItemToNode(pNewNode, pItem);
+	pNewNode->pNext = NULL;
+	
+	if( NULL == pList->pTail )
+	{
+		pList->pHead = pNewNode;
+	}
+	else
+	{
+		pList->pTail->pNext = pNewNode;
+	}
+	
+	pList->pTail = pNewNode;
+	pList->Size++;
+	pList->Revision++;
+	SkipInsertTower(pList, pList->Size - 1, pNewNode);
+	HashInsertNode(pList, pNewNode);
+	
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperatePopFront
+ * Description   : 删除链表容器首元素
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 不再调用UpdateAllItemIndex，时间复杂度O(1)
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步游标位置
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperatePopFront(list_t* pList)
+{
+	node_t* pScan = pList->pHead;
+	
+	if(pList->empty(pList))
+	{
+		return OPERATE_FAIL;
+	}
+
+	SkipRemoveTower(pList, 0, pScan);
+	HashRemoveNode(pList, pScan);
+	pList->pHead = pScan->pNext;
+
+	if( NULL == pList->pHead )
+	{
+		pList->pTail = NULL;
+	}
+
+	if( pList->pCursor == pScan )
+	{
+		pList->pCursor = NULL;
+	}
+	else if( NULL != pList->pCursor )
+	{
+		pList->CursorIndex--;
+	}
+
+	pList->Size--;
+	pList->Revision++;
+	FreeNode(pList, pScan);
+	
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperatePopBack
+ * Description   : 删除链表容器尾元素
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 删除游标所在节点时使游标失效
+*****************************************************************************/
+static int OperatePopBack(list_t* pList)
+{
+	if(pList->empty(pList))
+	{
+		return OPERATE_FAIL;
+	}
+
+	return OperateRemove(pList, pList->Size - 1);
+}
+
+/*****************************************************************************
+ * Function      : OperatePopFrontCopy
+ * Description   : 将链表容器首元素的用户数据拷贝到pOut后删除首元素
+ * Input         : list_t* pList  
+                void* pOut  至少CarryDataSize字节
+ * Output        : None
+ * Return        : static
+ * Others        : 链表为空时返回OPERATE_FAIL且不修改pOut；并发模式下取出与删除
+ 				   是一个原子操作
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperatePopFrontCopy(list_t* pList, void* pOut)
+{
+	void* pData = pList->front(pList);
+
+	if( NULL == pData )
+	{
+		return OPERATE_FAIL;
+	}
+
+	memcpy(pOut, pData, pList->CarryDataSize);
+
+	return pList->popfront(pList);
+}
+
+/*****************************************************************************
+ * Function      : OperateGet
+ * Description   : 获取链表容器指定index处的元素，index从0开始
+ * Input         : list_t* pList       
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 游标经序列号发布，多个线程可在读写锁的读锁下同时调用；创建时
+ 				   启用CursorCache则以普通写更新游标，此时get是修改容器的操作，
+ 				   须与其他读写操作互斥
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 按位置计数定位节点，不再依赖节点index
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 注明游标缓存对并发读的影响
+*****************************************************************************/
+static void* OperateGet(list_t* pList, unsigned int index)
+{
+	if(pList->empty(pList) || pList->Size <= index)
+	{
+		return NULL;
+	}
+
+	return LocateNode(pList, index, NULL)->item.pData;
+}
+
+/*****************************************************************************
+ * Function      : OperateFindIf
+ * Description   : 按用户传入的函数指针的匹配条件查找并返回元素,未找到返回NULL
+ * Input         : list_t* pList               
+                unsigned int(*exec)(const void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static void* OperateFindIf(list_t* pList, unsigned int(*exec)(const void*))
+{
+	node_t* pScan = pList->pHead;
+	
+	if(pList->empty(pList))
+	{
+		return NULL;
+	}
+
+	do
+	{
+		if(OPERATE_TRUE == exec( pScan->item.pData ))
+		{		
+			return pScan->item.pData;
+		}
+		
+		pScan = pScan->pNext;
+		
+	}while(NULL != pScan);
+	
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : OperateFindIf2
+ * Description   : 按用户传入的函数指针与待查找内容的匹配条件查找并返回元素,若
+ 				未找到返回NULL
+ * Input         : list_t* pList
+ 				unsigned int(*exec)(const void*, const void*)
+ 				const void* pRef                 
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+
+*****************************************************************************/
+static void* OperateFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	node_t* pScan = pList->pHead;
+	
+	if(pList->empty(pList))
+	{
+		return NULL;
+	}
+
+	do
+	{
+		if(OPERATE_TRUE == exec( pScan->item.pData, pRef ))
+		{		
+			return pScan->item.pData;
+		}
+		
+		pScan = pScan->pNext;
+		
+	}while(NULL != pScan);
+	
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : OperateFindIndexIf
+ * Description   : 按用户传入的函数指针与待查找内容的匹配条件查找并返回所查找
+ 				元素的index, 若未找到返回OPERATE_INVALID
+ * Input         : list_t* pList              
+                unsigned int(*exec)(const void*, const void*)                     
+                const void* pRef                 
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170323
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 遍历时按位置计数返回index
+*****************************************************************************/
+static unsigned int OperateFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	node_t* pScan = pList->pHead;
+	unsigned int counter = 0;
+	
+	if(pList->empty(pList))
+	{
+		return OPERATE_FAIL;
+	}
+
+	do
+	{
+		if(OPERATE_TRUE == exec( pScan->item.pData, pRef ))
+		{		
+			return counter;
+		}
+		
+		pScan = pScan->pNext;
+		counter++;
+		
+	}while(NULL != pScan);
+	
+	return OPERATE_INVALID;
+}
+
+/*****************************************************************************
+ * Function      : OperateRemove
+ * Description   : 删除链表容器指定index处的元素
+ * Input         : list_t* pList       
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 按位置计数定位节点，删除后不再重写所有index
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 删除后游标移至前驱节点
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperateRemove(list_t* pList, unsigned int index)
+{
+	node_t* pScan = NULL;
+	node_t* pPrev = NULL;
+	
+	if(pList->empty(pList) || pList->Size <= index)
+	{
+		return OPERATE_FAIL;
+	}
+
+	pScan = LocateNode(pList, index, &pPrev);
+	SkipRemoveTower(pList, index, pScan);
+	HashRemoveNode(pList, pScan);
+
+	if( NULL == pPrev )
+	{
+		pList->pHead = pScan->pNext;
+	}
+	else
+	{
+		pPrev->pNext = pScan->pNext;
+	}
+
+	if( pList->pTail == pScan )
+	{
+		pList->pTail = pPrev;
+	}
+
+	pList->pCursor = pPrev;
+	pList->CursorIndex = index - 1;
+	pList->Size--;
+	pList->Revision++;
+	FreeNode(pList, pScan);
+	
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateAssign
+ * Description   : 用新元素对链表容器指定index处的元素进行替换
+ * Input         : list_t* pList       
+                unsigned int index  
+                const void* pData   
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 按位置计数定位节点
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperateAssign(list_t* pList, unsigned int index, const void* pData)
+{
+	node_t* pScan = NULL;
+
+	if(pList->empty(pList) || pList->Size <= index)
+	{
+		return OPERATE_FAIL;
+	}
+
+	pScan = LocateNode(pList, index, NULL);
+	HashRemoveNode(pList, pScan);
+	memcpy( pScan->item.pData, pData, pList->CarryDataSize );
+	HashInsertNode(pList, pScan);
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateInsert
+ * Description   : 在链表容器指定index处的元素之前插入一个元素
+ * Input         : list_t* pList       
+                unsigned int index  
+                const void* pData   
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 直接转发至pushfront/insertafter，修复未使用节点的内存泄漏
+*****************************************************************************/
+static int OperateInsert(list_t* pList, unsigned int index, const void* pData)
+{
+	if( pList->full(pList) || pList->empty(pList) || pList->Size <= index)
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == index )
+	{
+		return pList->pushfront(pList, pData);
+	}
+	
+	return pList->insertafter(pList, index - 1, pData);
+}
+
+/*****************************************************************************
+ * Function      : OperateInsertAfter
+ * Description   : 在链表容器指定index处的元素之后插入一个元素
+ * Input         : list_t* pList       
+                unsigned int index  
+                const void* pData   
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 按位置计数定位节点，插入后不再重写所有index
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperateInsertAfter(list_t* pList, unsigned int index, const void* pData)
+{
+	node_t* pNewNode = AllocNode(pList);
+	item_t* pItem = NULL;
+	node_t* pScan = NULL;
+
+	if( NULL == pNewNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( pList->full(pList) || pList->empty(pList) || pList->Size <= index || OPERATE_FAIL == HashReserve(pList, 1) )
+	{
+		FreeNode(pList, pNewNode);
+		return OPERATE_FAIL;
+	}
+
+	pItem = PackageData( pNewNode, pData, pList );
+	CopyItemToNode(pNewNode, pItem);
+	pScan = LocateNode(pList, index, NULL);
+	
+	pNewNode->pNext = pScan->pNext;
+	pScan->pNext = pNewNode;
+
+	if( pList->pTail == pScan )
+	{
+		pList->pTail = pNewNode;
+	}
+	
+	pList->Size++;
+	pList->Revision++;
+	SkipInsertTower(pList, index + 1, pNewNode);
+	HashInsertNode(pList, pNewNode);
+	
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateSwap
+ * Description   : 交换链表容器指定的两个index处的元素的内容，以交换节点携带的
+ 				   数据而非交换节点本身的方式实现
+ * Input         : list_t* pList        
+                unsigned int index1  
+                unsigned int index2  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170322
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 按位置计数定位节点，数据交换移至SwapData
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 经由SwapData交换数据
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 同步哈希索引
+*****************************************************************************/
+static int OperateSwap(list_t* pList, unsigned int index1, unsigned int index2)
+{
+	node_t* pScan1 = NULL;
+	node_t* pScan2 = NULL;
+	int result = OPERATE_FAIL;
+
+	if((index1 == index2) || (pList->Size <= index1) || (pList->Size <= index2) || (pList->Size <= 1))
+	{
+		return OPERATE_FAIL;
+	}
+
+	pScan1 = LocateNode(pList, index1, NULL);
+	pScan2 = LocateNode(pList, index2, NULL);
+
+	HashRemoveNode(pList, pScan1);
+	HashRemoveNode(pList, pScan2);
+	result = SwapData(pList, pScan1->item.pData, pScan2->item.pData);
+	HashInsertNode(pList, pScan1);
+	HashInsertNode(pList, pScan2);
+
+	return result;
+}
+
+/*****************************************************************************
+ * Function      : OperateSortIf
+ * Description   : 按用户传入的函数指针指定的比较方法来重新排列链表容器
+ * Input         : list_t* pList              
+                unsigned int(*exec)(const void*, const void*)                     
+ * Output        : None
+ * Return        : static
+ * Others        : 自底向上的归并排序，时间复杂度O(nlogn)，只重新链接节点而不拷贝
+ 				   数据、不申请内存，排序是稳定的；exec(a, b)为OPERATE_TRUE表示a
+ 				   应排在b之后
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 直接交换节点数据，不再按index经由swap重新定位
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 改为自底向上的归并排序，重新链接节点，稳定且不申请内存
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 排序主体移至SortChain
+*****************************************************************************/
+static void OperateSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*))
+{
+	if( 1 >= pList->size(pList) )
+	{
+		return;
+	}
+
+	pList->pHead = SortChain(pList->pHead, pList->Size, exec, &pList->pTail);
+	pList->pCursor = NULL;
+	pList->Revision++;
+	RebuildSkipIndex(pList);
+}
+
+/*****************************************************************************
+ * Function      : OperateSortByKey
+ * Description   : 按节点所挂数据中的无符号整数键值升序排列链表容器
+ * Input         : list_t* pList              
+                unsigned int key_offset  键值在数据中的偏移
+                unsigned int key_width  键值宽度，须为1/2/4/8字节
+ * Output        : None
+ * Return        : static
+ * Others        : LSD基数排序，每趟按一个字节将节点分配到桶中再依次链接，时间
+ 				   复杂度O(n*key_width)，不调用比较函数、不拷贝数据、不申请内存，
+ 				   排序是稳定的；所有键值在某字节上相同时跳过该趟
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width)
+{
+	node_t* pBucketHead[LIST_RADIX_BUCKETS];
+	node_t* pBucketTail[LIST_RADIX_BUCKETS];
+	node_t* pScan = NULL;
+	node_t* pNext = NULL;
+	node_t* pTail = NULL;
+	unsigned long long keyOr = 0;
+	unsigned long long keyAnd = ~0ULL;
+	unsigned long long key = 0;
+	unsigned int shift = 0;
+	unsigned int bucket = 0;
+
+	if( !IsValidKey(pList, key_offset, key_width) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 1 >= pList->size(pList) )
+	{
+		return OPERATE_SUCC;
+	}
+
+	for( pScan = pList->pHead; NULL != pScan; pScan = pScan->pNext )
+	{
+		key = ReadKey(pScan->item.pData, key_offset, key_width);
+		keyOr |= key;
+		keyAnd &= key;
+	}
+
+	for( shift = 0; shift < key_width * 8; shift += LIST_RADIX_BITS )
+	{
+		if( 0 == ( ( ( keyOr ^ keyAnd ) >> shift ) & ( LIST_RADIX_BUCKETS - 1 ) ) )
+		{
+			continue;
+		}
+
+		memset(pBucketHead, 0, sizeof(pBucketHead));
+
+		for( pScan = pList->pHead; NULL != pScan; pScan = pNext )
+		{
+			pNext = pScan->pNext;
+			bucket = (unsigned int)( ( ReadKey(pScan->item.pData, key_offset, key_width) >> shift ) & ( LIST_RADIX_BUCKETS - 1 ) );
+
+			if( NULL == pBucketHead[bucket] )
+			{
+				pBucketHead[bucket] = pScan;
+			}
+			else
+			{
+				pBucketTail[bucket]->pNext = pScan;
+			}
+
+			pBucketTail[bucket] = pScan;
+		}
+
+		pList->pHead = NULL;
+		pTail = NULL;
+
+		for( bucket = 0; bucket < LIST_RADIX_BUCKETS; bucket++ )
+		{
+			if( NULL == pBucketHead[bucket] )
+			{
+				continue;
+			}
+
+			if( NULL == pTail )
+			{
+				pList->pHead = pBucketHead[bucket];
+			}
+			else
+			{
+				pTail->pNext = pBucketHead[bucket];
+			}
+
+			pTail = pBucketTail[bucket];
+		}
+
+		pTail->pNext = NULL;
+		pList->pTail = pTail;
+	}
+
+	pList->pCursor = NULL;
+	pList->Revision++;
+	RebuildSkipIndex(pList);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateParallelSortIf
+ * Description   : 多线程版本的sortif，排序结果与sortif一致
+ * Input         : list_t* pList              
+                unsigned int(*exec)(const void*, const void*)                     
+                unsigned int thread_count  线程数(含调用线程)，最多
+                						   LIST_SORT_MAX_THREADS
+                unsigned int serial_threshold  元素个数小于该值时退化为sortif
+ * Output        : None
+ * Return        : static
+ * Others        : 将节点链切分为thread_count段，各线程分别排序后再逐层两两并
+ 				   发合并，全程只重新链接节点；exec须可被多个线程同时调用；
+ 				   各段由链表容器的线程池(与parallelforeach共用)执行，不再每次
+ 				   创建线程；LIST_USE_PTHREAD为0时各段在调用线程中依次处理
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 使用线程池执行排序任务
+*****************************************************************************/
+static void OperateParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold)
+{
+	sort_task_t tasks[LIST_SORT_MAX_THREADS];
+	node_t* pScan = pList->pHead;
+	unsigned int runs = 0;
+	unsigned int i = 0;
+	unsigned int j = 0;
+
+	if( thread_count > LIST_SORT_MAX_THREADS )
+	{
+		thread_count = LIST_SORT_MAX_THREADS;
+	}
+
+	if( thread_count > pList->Size / 2 )
+	{
+		thread_count = pList->Size / 2;
+	}
+
+	if( 1 >= thread_count || pList->Size < serial_threshold )
+	{
+		pList->sortif(pList, exec);
+		return;
+	}
+
+	for( i = 0; i < thread_count; i++ )
+	{
+		tasks[i].pHead = pScan;
+		tasks[i].pRight = NULL;
+		tasks[i].Count = pList->Size / thread_count + ( ( i < pList->Size % thread_count ) ? 1 : 0 );
+		tasks[i].exec = exec;
+		pScan = SplitRun(pScan, tasks[i].Count);
+	}
+
+	RunWorkerTasks(pList, SortTaskEntry, tasks, thread_count, thread_count);
+
+	for( runs = thread_count; runs > 1; runs = ( runs + 1 ) / 2 )
+	{
+		for( i = 0, j = 0; j + 1 < runs; i++, j += 2 )
+		{
+			tasks[i].pHead = tasks[j].pHead;
+			tasks[i].pRight = tasks[j + 1].pHead;
+		}
+
+		RunWorkerTasks(pList, SortTaskEntry, tasks, i, i);
+
+		if( j < runs )
+		{
+			tasks[i] = tasks[j];
+		}
+	}
+
+	pList->pHead = tasks[0].pHead;
+	pList->pTail = tasks[0].pTail;
+	pList->pCursor = NULL;
+	pList->Revision++;
+	RebuildSkipIndex(pList);
+}
+
+
+
+/*****************************************************************************
+ * Function      : OperateSize
+ * Description   : 链表容器当前含有的元素个数
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateSize(list_t* pList)
+{
+	return pList->Size;
+}
+
+/*****************************************************************************
+ * Function      : OperateCapacity
+ * Description   : 链表容器最多可以携带的元素个数
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateCapacity(list_t* pList)
+{
+	return pList->MaxSize;
+}
+
+/*****************************************************************************
+ * Function      : OperateResize
+ * Description   : 重新设置链表容器最多可以携带的元素个数
+ * Input         : list_t* pList          
+                unsigned int new_size  
+ * Output        : None
+ * Return        : static
+ * Others        : 从链表容器后面截断，此操作可能会导致元素丢失
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static void OperateResize(list_t* pList, unsigned int new_size)
+{
+	pList->MaxSize = new_size;
+
+	while( pList->Size > pList->MaxSize )
+	{
+		pList->popback(pList);
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateEmpty
+ * Description   : 链表容器当前是否为空
+ * Input         : const list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateEmpty(list_t* pList)
+{
+	return ( ( 0 == pList->Size ) ? 1 : 0 );
+}
+
+/*****************************************************************************
+ * Function      : OperateFull
+ * Description   : 链表容器当前是否为满
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateFull(list_t* pList)
+{
+	return ( ( pList->size(pList) < pList->capacity(pList) ) ? 0 : 1 );
+}
+
+/*****************************************************************************
+ * Function      : OperateClear
+ * Description   : 清空链表容器数据，但不销毁链表
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 经由ReleaseAllNodes释放节点，启用节点池时整块释放
+*****************************************************************************/
+static int OperateClear(list_t* pList)
+{
+	if(NULL == pList)
+	{
+		return OPERATE_SUCC;
+	}
+
+	ReleaseAllNodes(pList);
+
+	pList->Size = 0;
+	pList->Revision++;
+	pList->pHead = NULL;
+	pList->pTail = NULL;
+	pList->pCursor = NULL;
+	pList->pTailBlock = NULL;
+	pList->pCursorBlock = NULL;
+	
+	return OPERATE_SUCC;	
+}
+
+/*****************************************************************************
+ * Function      : OperateDestroy
+ * Description   : 销毁链表容器
+ * Input         : list_t** pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 经由ReleaseAllNodes释放节点，并通过链表的分配器释放容器
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 释放哈希索引
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 销毁线程池与分段缓存
+*****************************************************************************/
+static int OperateDestroy(list_t** ppList)
+{
+	list_allocator_t allocator;
+	
+	if(NULL == *ppList)
+	{
+		return OPERATE_SUCC;
+	}
+
+	ReleaseAllNodes(*ppList);
+	ReleaseWorkers(*ppList);
+	allocator = (*ppList)->Allocator;
+
+	if( NULL != (*ppList)->pSplits )
+	{
+		allocator.release(allocator.pContext, (*ppList)->pSplits);
+	}
+
+	if( NULL != (*ppList)->pPool )
+	{
+		allocator.release(allocator.pContext, (*ppList)->pPool);
+	}
+
+	if( NULL != (*ppList)->pSkipHeader )
+	{
+		allocator.release(allocator.pContext, (*ppList)->pSkipHeader);
+	}
+
+	if( NULL != (*ppList)->pHash )
+	{
+		if( NULL != (*ppList)->pHash->pSlots )
+		{
+			allocator.release(allocator.pContext, (*ppList)->pHash->pSlots);
+		}
+
+		allocator.release(allocator.pContext, (*ppList)->pHash);
+	}
+
+	(*ppList)->Size = 0;
+	(*ppList)->MaxSize = 0;
+	(*ppList)->CarryDataSize = 0;
+	(*ppList)->pHead = NULL;
+	(*ppList)->pTail = NULL;
+	(*ppList)->pCursor = NULL;
+	(*ppList)->pTailBlock = NULL;
+	(*ppList)->pCursorBlock = NULL;
+	(*ppList)->pPool = NULL;
+	(*ppList)->pSkipHeader = NULL;
+	(*ppList)->pHash = NULL;
+	(*ppList)->pSplits = NULL;
+	allocator.release(allocator.pContext, *ppList);
+	*ppList = NULL;
+	
+	return OPERATE_SUCC;	
+}
+
+/*****************************************************************************
+ * Function      : OperateForeach
+ * Description   : 将链表容器的每个用户数据依次传递传递至用户传入的函数指针
+ * Input         : list_t* pList       
+                void(*exec)(void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20170321
+ *   Author      : bingshuizhilian@yeah.net
+ *   Modification: Created function
+*****************************************************************************/
+static void OperateForeach(list_t* pList, void(*exec)(void*))
+{
+	node_t* pScan = pList->pHead;
+
+	for( ; NULL != pScan; pScan = pScan->pNext )
+	{
+		exec(pScan->item.pData);
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateBeforeBegin
+ * Description   : 将迭代器置于首元素之前的位置，用于在头部插入或删除首元素
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 此时Index为OPERATE_INVALID，deref返回NULL，next后指向首元素
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 初始化持久化链表使用的Position
+*****************************************************************************/
+static void OperateBeforeBegin(list_t* pList, list_iter_t* pIter)
+{
+	(void)pList;
+
+	pIter->pNode = NULL;
+	pIter->pBlock = NULL;
+	pIter->Offset = 0;
+	pIter->Position = 0;
+	pIter->Index = OPERATE_INVALID;
+}
+
+/*****************************************************************************
+ * Function      : OperateBegin
+ * Description   : 将迭代器置于首元素
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 链表为空时返回OPERATE_FALSE，迭代器处于末尾
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateBegin(list_t* pList, list_iter_t* pIter)
+{
+	pList->beforebegin(pList, pIter);
+
+	return pList->next(pList, pIter);
+}
+
+/*****************************************************************************
+ * Function      : OperateNext
+ * Description   : 将迭代器移至下一个元素
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 移动后指向有效元素时返回OPERATE_TRUE，到达末尾时返回
+ 				   OPERATE_FALSE；时间复杂度O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateNext(list_t* pList, list_iter_t* pIter)
+{
+	if( OPERATE_INVALID == pIter->Index )
+	{
+		pIter->pNode = pList->pHead;
+	}
+	else if( NULL != pIter->pNode )
+	{
+		pIter->pNode = pIter->pNode->pNext;
+	}
+	else
+	{
+		return OPERATE_FALSE;
+	}
+
+	pIter->Index++;
+
+	return ( ( NULL != pIter->pNode ) ? OPERATE_TRUE : OPERATE_FALSE );
+}
+
+/*****************************************************************************
+ * Function      : OperateDeref
+ * Description   : 返回迭代器所指元素的用户数据
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 迭代器位于首元素之前或末尾时返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* OperateDeref(list_t* pList, list_iter_t* pIter)
+{
+	(void)pList;
+
+	return ( ( NULL != pIter->pNode ) ? pIter->pNode->item.pData : NULL );
+}
+
+/*****************************************************************************
+ * Function      : OperateIterInsertAfter
+ * Description   : 在迭代器所指元素之后插入新元素，迭代器位于首元素之前时插入
+ 				   到头部
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 迭代器仍指向原元素；无需定位，时间复杂度O(1)(启用跳表时为
+ 				   维护索引需O(logn))；迭代器位于末尾时失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData)
+{
+	node_t* pNewNode = NULL;
+	unsigned int index = pIter->Index + 1;
+
+	if( pList->full(pList) || ( NULL == pIter->pNode && OPERATE_INVALID != pIter->Index )
+		|| OPERATE_FAIL == HashReserve(pList, 1) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pNewNode = AllocNode(pList);
+
+	if( NULL == pNewNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PackageData( pNewNode, pData, pList );
+
+	if( NULL == pIter->pNode )
+	{
+		pNewNode->pNext = pList->pHead;
+		pList->pHead = pNewNode;
+	}
+	else
+	{
+		pNewNode->pNext = pIter->pNode->pNext;
+		pIter->pNode->pNext = pNewNode;
+	}
+
+	if( NULL == pNewNode->pNext )
+	{
+		pList->pTail = pNewNode;
+	}
+
+	if( NULL != pList->pCursor && pList->CursorIndex >= index )
+	{
+		pList->CursorIndex++;
+	}
+
+	pList->Size++;
+	pList->Revision++;
+	SkipInsertTower(pList, index, pNewNode);
+	HashInsertNode(pList, pNewNode);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateIterEraseAfter
+ * Description   : 删除迭代器所指元素之后的元素，迭代器位于首元素之前时删除首
+ 				   元素
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 迭代器仍指向原元素；无需定位，时间复杂度O(1)(启用跳表时为
+ 				   维护索引需O(logn))；其后没有元素时失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateIterEraseAfter(list_t* pList, list_iter_t* pIter)
+{
+	node_t* pErase = NULL;
+	unsigned int index = pIter->Index + 1;
+
+	if( NULL != pIter->pNode )
+	{
+		pErase = pIter->pNode->pNext;
+	}
+	else if( OPERATE_INVALID == pIter->Index )
+	{
+		pErase = pList->pHead;
+	}
+
+	if( NULL == pErase )
+	{
+		return OPERATE_FAIL;
+	}
+
+	SkipRemoveTower(pList, index, pErase);
+	HashRemoveNode(pList, pErase);
+
+	if( NULL == pIter->pNode )
+	{
+		pList->pHead = pErase->pNext;
+	}
+	else
+	{
+		pIter->pNode->pNext = pErase->pNext;
+	}
+
+	if( pList->pTail == pErase )
+	{
+		pList->pTail = pIter->pNode;
+	}
+
+	if( pList->pCursor == pErase )
+	{
+		pList->pCursor = pIter->pNode;
+		pList->CursorIndex = pIter->Index;
+	}
+	else if( NULL != pList->pCursor && pList->CursorIndex > index )
+	{
+		pList->CursorIndex--;
+	}
+
+	pList->Size--;
+	pList->Revision++;
+	FreeNode(pList, pErase);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : FreeNodeChain
+ * Description   : 内部实现接口，批量释放一条以NULL结尾、首尾为pFirst/pLast的
+ 				   节点链
+ * Input         : list_t* pList  
+                node_t* pFirst  
+                node_t* pLast  
+ * Output        : None
+ * Return        : static
+ * Others        : 启用节点池时整条链一次性挂到空闲链上，时间复杂度O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void FreeNodeChain(list_t* pList, node_t* pFirst, node_t* pLast)
+{
+	node_t* pErase = NULL;
+
+	if( NULL == pFirst )
+	{
+		return;
+	}
+
+	if( NULL != pList->pPool )
+	{
+		pLast->pNext = pList->pPool->pFreeNodes;
+		pList->pPool->pFreeNodes = pFirst;
+		return;
+	}
+
+	while( NULL != pFirst )
+	{
+		pErase = pFirst;
+		pFirst = pFirst->pNext;
+		pList->Allocator.release(pList->Allocator.pContext, pErase);
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateRemoveIf
+ * Description   : 删除链表容器中所有满足条件的元素，返回删除的元素个数
+ * Input         : list_t* pList       
+                unsigned int(*exec)(const void*, const void*)  满足条件时返回
+                非0，第二个参数为pRef
+                const void* pRef  
+ * Output        : None
+ * Return        : static
+ * Others        : 一次遍历摘除所有匹配的节点，遍历结束后再统一释放，时间复杂度
+ 				   O(n)；启用跳表时有删除则重建索引
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	node_t dropped;
+	node_t* pDropTail = &dropped;
+	node_t* pPrev = NULL;
+	node_t* pScan = pList->pHead;
+	unsigned int count = 0;
+
+	while( NULL != pScan )
+	{
+		if( exec(pScan->item.pData, pRef) )
+		{
+			HashRemoveNode(pList, pScan);
+
+			if( NULL == pPrev )
+			{
+				pList->pHead = pScan->pNext;
+			}
+			else
+			{
+				pPrev->pNext = pScan->pNext;
+			}
+
+			pDropTail->pNext = pScan;
+			pDropTail = pScan;
+			count++;
+		}
+		else
+		{
+			pPrev = pScan;
+		}
+
+		pScan = pScan->pNext;
+	}
+
+	if( 0 == count )
+	{
+		return 0;
+	}
+
+	pDropTail->pNext = NULL;
+	pList->pTail = pPrev;
+	pList->pCursor = NULL;
+	pList->Size -= count;
+	pList->Revision++;
+	RebuildSkipIndex(pList);
+	FreeNodeChain(pList, dropped.pNext, pDropTail);
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : OperateFindByKey
+ * Description   : 按键查找链表容器中的元素，返回其用户数据
+ * Input         : list_t* pList       
+                const void* pKey  与用户数据中HashKeyOffset处的键同样格式
+ * Output        : None
+ * Return        : static
+ * Others        : 经由哈希索引查找，期望时间复杂度O(1)；存在多个相同键的元素
+ 				   时返回其中任意一个；未找到或未启用哈希索引时返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* OperateFindByKey(list_t* pList, const void* pKey)
+{
+	hash_index_t* pHash = pList->pHash;
+	hash_slot_t* pSlot = NULL;
+	unsigned int hash = 0;
+	unsigned int slot = 0;
+
+	if( NULL == pHash || NULL == pHash->pSlots )
+	{
+		return NULL;
+	}
+
+	hash = HashCode(pHash, pKey);
+
+	for( slot = hash & ( pHash->Capacity - 1 ); NULL != pHash->pSlots[slot].pNode; slot = ( slot + 1 ) & ( pHash->Capacity - 1 ) )
+	{
+		pSlot = &pHash->pSlots[slot];
+
+		if( pSlot->Hash == hash
+			&& HashKeyEqual(pHash, (const char*)pSlot->pNode->item.pData + pHash->KeyOffset, pKey) )
+		{
+			return pSlot->pNode->item.pData;
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : GatherItems
+ * Description   : 内部实现接口，从迭代器位置起收集最多LIST_TRAVERSE_BATCH个
+ 				   用户数据的地址，并将迭代器移到其后
+ * Input         : list_t* pList       
+                list_iter_t* pIter  
+                void** ppItems  至少LIST_TRAVERSE_BATCH个元素
+ * Output        : None
+ * Return        : static
+ * Others        : 返回收集的个数，为0表示遍历结束；节点存储时收集的同时预取后
+ 				   续节点，展开链表预取下一块，使下一次收集与回调的执行重叠
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 支持持久化链表
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 支持连续存储
+*****************************************************************************/
+static unsigned int GatherItems(list_t* pList, list_iter_t* pIter, void** ppItems)
+{
+	node_t* pScan = pIter->pNode;
+	block_t* pBlock = pIter->pBlock;
+	char* pItem = NULL;
+	unsigned int count = 0;
+
+	if( LIST_STORAGE_UNROLLED == pList->Storage )
+	{
+		while( NULL != pBlock && count < LIST_TRAVERSE_BATCH )
+		{
+			if( 0 == pIter->Offset )
+			{
+				LIST_PREFETCH( pBlock->pNext );
+			}
+
+			pItem = BlockItem(pList, pBlock, pIter->Offset);
+
+			for( ; pIter->Offset < pBlock->Count && count < LIST_TRAVERSE_BATCH; pIter->Offset++ )
+			{
+				ppItems[count++] = pItem;
+				pItem += pList->CarryDataSize;
+			}
+
+			if( pIter->Offset == pBlock->Count )
+			{
+				pBlock = pBlock->pNext;
+				pIter->Offset = 0;
+			}
+		}
+
+		pIter->pBlock = pBlock;
+		pIter->Index += count;
+
+		return count;
+	}
+
+	if( LIST_STORAGE_VECTOR == pList->Storage )
+	{
+		for( ; pIter->Index < pList->Size && count < LIST_TRAVERSE_BATCH; pIter->Index++ )
+		{
+			ppItems[count++] = VectorItem(pList, pIter->Index);
+		}
+
+		return count;
+	}
+
+	if( LIST_STORAGE_PERSIST == pList->Storage )
+	{
+		for( ; 0 != pIter->Position && count < LIST_TRAVERSE_BATCH; pIter->Position = PersistNode(pList, pIter->Position)->Next )
+		{
+			ppItems[count++] = PersistItem(pList, pIter->Position);
+		}
+
+		pIter->Index += count;
+
+		return count;
+	}
+
+	while( NULL != pScan && count < LIST_TRAVERSE_BATCH )
+	{
+		if( NULL != pScan->pNext )
+		{
+			LIST_PREFETCH( pScan->pNext->pNext );
+		}
+
+		LIST_PREFETCH( pScan->item.pData );
+		ppItems[count++] = pScan->item.pData;
+		pScan = pScan->pNext;
+	}
+
+	pIter->pNode = pScan;
+	pIter->Index += count;
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : OperateForeach2
+ * Description   : 将链表容器的每个用户数据连同用户上下文依次传递至用户传入的
+ 				   函数指针
+ * Input         : list_t* pList       
+                void(*exec)(void*, void*)  第二个参数为pContext
+                void* pContext  
+ * Output        : None
+ * Return        : static
+ * Others        : 按批收集元素并预取，再逐个回调
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void OperateForeach2(list_t* pList, void(*exec)(void*, void*), void* pContext)
+{
+	void* items[LIST_TRAVERSE_BATCH];
+	list_iter_t iter;
+	unsigned int count = 0;
+	unsigned int counter = 0;
+
+	pList->begin(pList, &iter);
+
+	while( 0 != ( count = GatherItems(pList, &iter, items) ) )
+	{
+		for( counter = 0; counter < count; counter++ )
+		{
+			exec(items[counter], pContext);
+		}
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateForeachBatch
+ * Description   : 按顺序将链表容器的用户数据分批传递至用户传入的函数指针，每批
+ 				   最多LIST_TRAVERSE_BATCH个
+ * Input         : list_t* pList       
+                void(*exec)(void**, unsigned int, void*)  参数依次为用户数据
+                地址数组、本批个数、pContext
+                void* pContext  
+ * Output        : None
+ * Return        : static
+ * Others        : 回调中可对一批数据做向量化处理；地址数组仅在回调期间有效
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void OperateForeachBatch(list_t* pList, void(*exec)(void**, unsigned int, void*), void* pContext)
+{
+	void* items[LIST_TRAVERSE_BATCH];
+	list_iter_t iter;
+	unsigned int count = 0;
+
+	pList->begin(pList, &iter);
+
+	while( 0 != ( count = GatherItems(pList, &iter, items) ) )
+	{
+		exec(items, count, pContext);
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateFindIfBatch
+ * Description   : 分批查找第一个满足条件的元素并返回其用户数据，未找到返回
+ 				   NULL
+ * Input         : list_t* pList       
+                unsigned int(*exec)(void**, unsigned int, void*)  返回本批中
+                第一个满足条件的元素的下标，没有时返回不小于本批个数的值
+                void* pContext  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* OperateFindIfBatch(list_t* pList, unsigned int(*exec)(void**, unsigned int, void*), void* pContext)
+{
+	void* items[LIST_TRAVERSE_BATCH];
+	list_iter_t iter;
+	unsigned int count = 0;
+	unsigned int match = 0;
+
+	pList->begin(pList, &iter);
+
+	while( 0 != ( count = GatherItems(pList, &iter, items) ) )
+	{
+		match = exec(items, count, pContext);
+
+		if( match < count )
+		{
+			return items[match];
+		}
+	}
+
+	return NULL;
+}
+
+#if LIST_USE_PTHREAD
+/*****************************************************************************
+ * Function      : WorkerEntry
+ * Description   : 内部实现接口，线程池工作线程的入口，循环领取并执行任务直至
+ 				   线程池关闭
+ * Input         : void* pArg  worker_pool_t*
+ * Output        : None
+ * Return        : static
+ * Others        : 编号不小于Active的线程不领取任务，使每次调用只使用所请求数
+ 				   量的线程
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* WorkerEntry(void* pArg)
+{
+	worker_pool_t* pPool = (worker_pool_t*)pArg;
+	void (*run)(void*, unsigned int) = NULL;
+	void* pJob = NULL;
+	unsigned int id = 0;
+	unsigned int task = 0;
+
+	pthread_mutex_lock(&pPool->Lock);
+	id = pPool->Started++;
+
+	for( ;; )
+	{
+		while( !pPool->Shutdown && ( pPool->NextTask >= pPool->TaskCount || id >= pPool->Active ) )
+		{
+			pthread_cond_wait(&pPool->WakeCond, &pPool->Lock);
+		}
+
+		if( pPool->Shutdown )
+		{
+			break;
+		}
+
+		task = pPool->NextTask++;
+		run = pPool->run;
+		pJob = pPool->pJob;
+		pthread_mutex_unlock(&pPool->Lock);
+
+		run(pJob, task);
+
+		pthread_mutex_lock(&pPool->Lock);
+
+		if( 0 == --pPool->Pending )
+		{
+			pthread_cond_signal(&pPool->DoneCond);
+		}
+	}
+
+	pthread_mutex_unlock(&pPool->Lock);
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : AcquireWorkers
+ * Description   : 内部实现接口，返回链表容器的线程池，首次使用时创建，工作线程
+ 				   不足count个时补足
+ * Input         : list_t* pList  
+                unsigned int count  所需的工作线程数(不含调用线程)
+ * Output        : None
+ * Return        : static
+ * Others        : 线程池随destroy一同销毁；创建失败返回NULL，线程创建失败时
+ 				   使用已有的线程；多个线程同时首次使用时以CAS安装线程池，
+ 				   落败的一方释放自己创建的线程池
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 以CAS安装线程池，补足工作线程时持有线程池的锁
+*****************************************************************************/
+static worker_pool_t* AcquireWorkers(list_t* pList, unsigned int count)
+{
+	worker_pool_t* pPool = LIST_ATOMIC_LOAD(&pList->pWorkers);
+	worker_pool_t* pExpected = NULL;
+
+	if( NULL == pPool )
+	{
+		pPool = (worker_pool_t*)pList->Allocator.alloc(pList->Allocator.pContext, sizeof(worker_pool_t));
+
+		if( NULL == pPool )
+		{
+			return NULL;
+		}
+
+		if( 0 != pthread_mutex_init(&pPool->Lock, NULL) )
+		{
+			pList->Allocator.release(pList->Allocator.pContext, pPool);
+			return NULL;
+		}
+
+		if( 0 != pthread_cond_init(&pPool->WakeCond, NULL) )
+		{
+			pthread_mutex_destroy(&pPool->Lock);
+			pList->Allocator.release(pList->Allocator.pContext, pPool);
+			return NULL;
+		}
+
+		if( 0 != pthread_cond_init(&pPool->DoneCond, NULL) )
+		{
+			pthread_cond_destroy(&pPool->WakeCond);
+			pthread_mutex_destroy(&pPool->Lock);
+			pList->Allocator.release(pList->Allocator.pContext, pPool);
+			return NULL;
+		}
+
+		pPool->ThreadCount = 0;
+		pPool->Started = 0;
+		pPool->Active = 0;
+		pPool->run = NULL;
+		pPool->pJob = NULL;
+		pPool->TaskCount = 0;
+		pPool->NextTask = 0;
+		pPool->Pending = 0;
+		pPool->Shutdown = 0;
+
+		if( !LIST_ATOMIC_CAS(&pList->pWorkers, &pExpected, pPool) )
+		{
+			pthread_cond_destroy(&pPool->DoneCond);
+			pthread_cond_destroy(&pPool->WakeCond);
+			pthread_mutex_destroy(&pPool->Lock);
+			pList->Allocator.release(pList->Allocator.pContext, pPool);
+			pPool = pExpected;
+		}
+	}
+
+	pthread_mutex_lock(&pPool->Lock);
+
+	while( pPool->ThreadCount < count
+		&& 0 == pthread_create(&pPool->Threads[pPool->ThreadCount], NULL, WorkerEntry, pPool) )
+	{
+		pPool->ThreadCount++;
+	}
+
+	pthread_mutex_unlock(&pPool->Lock);
+
+	return pPool;
+}
+#endif //end of LIST_USE_PTHREAD
+
+/*****************************************************************************
+ * Function      : ReleaseWorkers
+ * Description   : 内部实现接口，关闭并释放链表容器的线程池
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void ReleaseWorkers(list_t* pList)
+{
+#if LIST_USE_PTHREAD
+	worker_pool_t* pPool = pList->pWorkers;
+	unsigned int i = 0;
+
+	if( NULL == pPool )
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&pPool->Lock);
+	pPool->Shutdown = 1;
+	pthread_cond_broadcast(&pPool->WakeCond);
+	pthread_mutex_unlock(&pPool->Lock);
+
+	for( i = 0; i < pPool->ThreadCount; i++ )
+	{
+		pthread_join(pPool->Threads[i], NULL);
+	}
+
+	pthread_cond_destroy(&pPool->DoneCond);
+	pthread_cond_destroy(&pPool->WakeCond);
+	pthread_mutex_destroy(&pPool->Lock);
+	pList->Allocator.release(pList->Allocator.pContext, pPool);
+	pList->pWorkers = NULL;
+#endif //end of LIST_USE_PTHREAD
+}
+
+/*****************************************************************************
+ * Function      : RunWorkerTasks
+ * Description   : 内部实现接口，使用最多thread_count个线程(含调用线程)执行
+ 				   run(pJob, 0) ~ run(pJob, count - 1)并等待全部完成
+ * Input         : list_t* pList  
+                void(*run)(void*, unsigned int)  
+                void* pJob  
+                unsigned int count  
+                unsigned int thread_count  
+ * Output        : None
+ * Return        : static
+ * Others        : 调用线程同样领取任务；线程池不可用，或正被另一个线程的调用
+ 				   占用时，全部在调用线程中执行，因此读锁下的多个并行遍历可以
+ 				   同时调用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 线程池被占用时在调用线程中执行
+*****************************************************************************/
+static void RunWorkerTasks(list_t* pList, void(*run)(void*, unsigned int), void* pJob, unsigned int count, unsigned int thread_count)
+{
+#if LIST_USE_PTHREAD
+	worker_pool_t* pPool = NULL;
+	unsigned int task = 0;
+
+	if( thread_count > 1 && count > 1 )
+	{
+		pPool = AcquireWorkers(pList, thread_count - 1);
+	}
+
+	if( NULL != pPool )
+	{
+		pthread_mutex_lock(&pPool->Lock);
+
+		if( 0 != pPool->TaskCount )
+		{
+			pthread_mutex_unlock(&pPool->Lock);
+			pPool = NULL;
+		}
+	}
+
+	if( NULL != pPool )
+	{
+		pPool->run = run;
+		pPool->pJob = pJob;
+		pPool->TaskCount = count;
+		pPool->NextTask = 0;
+		pPool->Pending = count;
+		pPool->Active = thread_count - 1;
+		pthread_cond_broadcast(&pPool->WakeCond);
+
+		while( pPool->NextTask < pPool->TaskCount )
+		{
+			task = pPool->NextTask++;
+			pthread_mutex_unlock(&pPool->Lock);
+
+			run(pJob, task);
+
+			pthread_mutex_lock(&pPool->Lock);
+			pPool->Pending--;
+		}
+
+		while( 0 != pPool->Pending )
+		{
+			pthread_cond_wait(&pPool->DoneCond, &pPool->Lock);
+		}
+
+		pPool->TaskCount = 0;
+		pPool->NextTask = 0;
+		pthread_mutex_unlock(&pPool->Lock);
+		return;
+	}
+#endif //end of LIST_USE_PTHREAD
+
+	for( ; 0 < count; count-- )
+	{
+		run(pJob, count - 1);
+	}
+}
+
+/*****************************************************************************
+ * Function      : LocateSplits
+ * Description   : 内部实现接口，将链表容器均分为chunks段，将各段起点的迭代器
+ 				   写入pSplits
+ * Input         : list_t* pList  
+                list_iter_t* pSplits  至少chunks个元素，由调用者提供
+                unsigned int chunks  1~LIST_PARALLEL_MAX_CHUNKS，不大于size
+ * Output        : None
+ * Return        : static
+ * Others        : 各段起点按位置递增，从首元素开始一次前进到底即可全部得到，
+ 				   时间复杂度O(n)；展开链表按块跳过，为O(n/BlockItems)；连续
+ 				   存储直接按位置填写。节点存储的结果另存一份在容器的分段缓存
+ 				   中，链表结构未改变(Revision相同)且段数相同时直接复制：缓存
+ 				   只由以CAS抢到SplitBuilding的一个线程在SplitRevision与当前
+ 				   Revision不同时写入，写完后才发布SplitRevision，之后直到下一
+ 				   次修改链表结构(须持有写锁)都不再改变，因此多个线程可在读锁
+ 				   下同时调用；同一Revision下段数不同时不替换缓存
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 支持持久化链表
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 支持连续存储
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 一次遍历得到全部分段起点，结果写入调用者的数组；分段缓存
+ 				   发布后不再改写，读锁下并发调用不再竞争
+*****************************************************************************/
+static void LocateSplits(list_t* pList, list_iter_t* pSplits, unsigned int chunks)
+{
+	list_iter_t iter;
+	unsigned int counter = 0;
+	unsigned int index = 0;
+	unsigned int start = 0;
+	unsigned int idle = 0;
+
+	if( LIST_STORAGE_NODE == pList->Storage && pList->Revision == LIST_ATOMIC_LOAD(&pList->SplitRevision)
+		&& chunks == pList->SplitChunks )
+	{
+		memcpy(pSplits, pList->pSplits, chunks * sizeof(list_iter_t));
+		return;
+	}
+
+	pList->begin(pList, &iter);
+
+	for( counter = 0; counter < chunks; counter++ )
+	{
+		index = pList->Size / chunks * counter + ( ( counter < pList->Size % chunks ) ? counter : pList->Size % chunks );
+
+		if( LIST_STORAGE_UNROLLED == pList->Storage )
+		{
+			while( index >= start + iter.pBlock->Count )
+			{
+				start += iter.pBlock->Count;
+				iter.pBlock = iter.pBlock->pNext;
+			}
+
+			iter.Offset = index - start;
+			iter.Index = index;
+		}
+		else if( LIST_STORAGE_VECTOR == pList->Storage )
+		{
+			iter.Index = index;
+		}
+		else
+		{
+			while( iter.Index < index )
+			{
+				pList->next(pList, &iter);
+			}
+		}
+
+		pSplits[counter] = iter;
+	}
+
+	if( LIST_STORAGE_NODE != pList->Storage || !LIST_ATOMIC_CAS(&pList->SplitBuilding, &idle, 1) )
+	{
+		return;
+	}
+
+	if( pList->Revision != LIST_ATOMIC_LOAD_RELAXED(&pList->SplitRevision) )
+	{
+		if( NULL == pList->pSplits )
+		{
+			pList->pSplits = (list_iter_t*)pList->Allocator.alloc(pList->Allocator.pContext,
+				LIST_PARALLEL_MAX_CHUNKS * sizeof(list_iter_t));
+		}
+
+		if( NULL != pList->pSplits )
+		{
+			memcpy(pList->pSplits, pSplits, chunks * sizeof(list_iter_t));
+			pList->SplitChunks = chunks;
+			LIST_ATOMIC_STORE(&pList->SplitRevision, pList->Revision);
+		}
+	}
+
+	LIST_ATOMIC_STORE(&pList->SplitBuilding, 0);
+}
+
+/*****************************************************************************
+ * Function      : TraverseTaskEntry
+ * Description   : 内部实现接口，按任务模式处理第chunk段的全部元素
+ * Input         : void* pArg  traverse_job_t*
+                unsigned int chunk  
+ * Output        : None
+ * Return        : static
+ * Others        : 可在工作线程中执行，只读访问链表结构
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void TraverseTaskEntry(void* pArg, unsigned int chunk)
+{
+	traverse_job_t* pJob = (traverse_job_t*)pArg;
+	list_t* pList = pJob->pList;
+	list_iter_t iter = pJob->Splits[chunk];
+	unsigned int end = ( chunk + 1 < pJob->ChunkCount ) ? pJob->Splits[chunk + 1].Index : pList->Size;
+	unsigned int output = pJob->Offsets[chunk];
+	unsigned int count = 0;
+	void* pData = NULL;
+
+	for( ; iter.Index < end; pList->next(pList, &iter) )
+	{
+		pData = pList->deref(pList, &iter);
+
+		if( LIST_TRAVERSE_FOREACH == pJob->Mode )
+		{
+			pJob->exec(pData, pJob->pContext);
+		}
+		else if( pJob->match(pData, pJob->pRef) )
+		{
+			if( LIST_TRAVERSE_COLLECT == pJob->Mode && output < pJob->Capacity )
+			{
+				pJob->ppOutput[output++] = pData;
+			}
+
+			count++;
+		}
+	}
+
+	pJob->Counts[chunk] = count;
+}
+
+/*****************************************************************************
+ * Function      : PrepareTraverseJob
+ * Description   : 内部实现接口，按线程数将链表容器分段，填写遍历任务的分段信息
+ * Input         : list_t* pList  
+                traverse_job_t* pJob  
+                unsigned int thread_count  
+ * Output        : None
+ * Return        : static
+ * Others        : 段数为线程数的LIST_PARALLEL_CHUNKS_PER_THREAD倍以平衡负载，
+ 				   每段至少LIST_PARALLEL_MIN_CHUNK个元素；无法分段时整个链表
+ 				   作为一段
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 分段起点保存在任务自身的数组中
+*****************************************************************************/
+static void PrepareTraverseJob(list_t* pList, traverse_job_t* pJob, unsigned int thread_count)
+{
+	unsigned int chunks = 0;
+	unsigned int counter = 0;
+
+	if( thread_count > LIST_SORT_MAX_THREADS )
+	{
+		thread_count = LIST_SORT_MAX_THREADS;
+	}
+
+	chunks = ( 1 < thread_count ) ? thread_count * LIST_PARALLEL_CHUNKS_PER_THREAD : 1;
+
+	if( chunks > pList->Size / LIST_PARALLEL_MIN_CHUNK )
+	{
+		chunks = pList->Size / LIST_PARALLEL_MIN_CHUNK;
+	}
+
+	pJob->pList = pList;
+	pJob->ThreadCount = thread_count;
+
+	if( 1 < chunks )
+	{
+		LocateSplits(pList, pJob->Splits, chunks);
+	}
+	else
+	{
+		chunks = 1;
+		pList->begin(pList, &pJob->Splits[0]);
+	}
+
+	pJob->ChunkCount = chunks;
+
+	for( counter = 0; counter < chunks; counter++ )
+	{
+		pJob->Offsets[counter] = 0;
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateParallelForeach
+ * Description   : 多线程版本的foreach2，将每个用户数据连同pContext传递至用户
+ 				   传入的函数指针
+ * Input         : list_t* pList       
+                void(*exec)(void*, void*)  须可被多个线程同时调用
+                void* pContext  
+                unsigned int thread_count  线程数(含调用线程)，最多
+                						   LIST_SORT_MAX_THREADS
+ * Output        : None
+ * Return        : static
+ * Others        : 各段并发处理，不保证回调的先后顺序；工作线程属于链表容器并在
+ 				   多次调用间复用；遍历期间不得修改链表结构；本函数与countif、
+ 				   findall不写容器(分段缓存除外，见LocateSplits)，多个线程可在
+ 				   读写锁的读锁下同时调用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 注明可在读锁下并发调用
+*****************************************************************************/
+static void OperateParallelForeach(list_t* pList, void(*exec)(void*, void*), void* pContext, unsigned int thread_count)
+{
+	traverse_job_t job;
+
+	job.Mode = LIST_TRAVERSE_FOREACH;
+	job.exec = exec;
+	job.pContext = pContext;
+	PrepareTraverseJob(pList, &job, thread_count);
+	RunWorkerTasks(pList, TraverseTaskEntry, &job, job.ChunkCount, job.ThreadCount);
+}
+
+/*****************************************************************************
+ * Function      : OperateCountIf
+ * Description   : 多线程统计满足条件的元素个数
+ * Input         : list_t* pList       
+                unsigned int(*exec)(const void*, const void*)  满足条件时返回
+                非0，第二个参数为pRef，须可被多个线程同时调用
+                const void* pRef  
+                unsigned int thread_count  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateCountIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, unsigned int thread_count)
+{
+	traverse_job_t job;
+	unsigned int count = 0;
+	unsigned int counter = 0;
+
+	job.Mode = LIST_TRAVERSE_COUNT;
+	job.match = exec;
+	job.pRef = pRef;
+	PrepareTraverseJob(pList, &job, thread_count);
+	RunWorkerTasks(pList, TraverseTaskEntry, &job, job.ChunkCount, job.ThreadCount);
+
+	for( counter = 0; counter < job.ChunkCount; counter++ )
+	{
+		count += job.Counts[counter];
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : OperateFindAll
+ * Description   : 多线程查找所有满足条件的元素，按链表顺序将其用户数据地址写入
+ 				   ppOutput
+ * Input         : list_t* pList       
+                unsigned int(*exec)(const void*, const void*)  
+                const void* pRef  
+                void** ppOutput  
+                unsigned int capacity  ppOutput最多可容纳的个数
+                unsigned int thread_count  
+ * Output        : None
+ * Return        : static
+ * Others        : 返回满足条件的元素总数，超过capacity时只写入前capacity个；
+ 				   先并发统计各段的匹配个数以确定写入位置，再并发写入，因此
+ 				   exec对同一元素会被调用两次，须无副作用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateFindAll(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, void** ppOutput, unsigned int capacity, unsigned int thread_count)
+{
+	traverse_job_t job;
+	unsigned int count = 0;
+	unsigned int counter = 0;
+
+	job.Mode = LIST_TRAVERSE_COUNT;
+	job.match = exec;
+	job.pRef = pRef;
+	PrepareTraverseJob(pList, &job, thread_count);
+	RunWorkerTasks(pList, TraverseTaskEntry, &job, job.ChunkCount, job.ThreadCount);
+
+	for( counter = 0; counter < job.ChunkCount; counter++ )
+	{
+		job.Offsets[counter] = count;
+		count += job.Counts[counter];
+	}
+
+	if( 0 == count || 0 == capacity )
+	{
+		return count;
+	}
+
+	job.Mode = LIST_TRAVERSE_COLLECT;
+	job.ppOutput = ppOutput;
+	job.Capacity = capacity;
+	RunWorkerTasks(pList, TraverseTaskEntry, &job, job.ChunkCount, job.ThreadCount);
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : ReservePoolNodes
+ * Description   : 内部实现接口，启用节点池且没有已回收的节点时，确保当前块中
+ 				   至少还可切分count个节点
+ * Input         : list_t* pList  
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 不足时一次申请一块可容纳max(count, NodesPerSlab)个节点的内存，
+ 				   单块不超过UINT_MAX字节，放不下的节点由AllocNode按
+ 				   NodesPerSlab另行分块；当前块剩余的空间不再使用，随clear/
+ 				   destroy一同释放；申请失败时不做处理，由AllocNode逐个申请
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 块大小按size_t计算，单块不超过UINT_MAX字节
+*****************************************************************************/
+static void ReservePoolNodes(list_t* pList, unsigned int count)
+{
+	pool_t* pPool = pList->pPool;
+	slab_t* pSlab = NULL;
+
+	if( NULL == pPool || NULL != pPool->pFreeNodes || pPool->CarveLeft >= count )
+	{
+		return;
+	}
+
+	if( count < pPool->NodesPerSlab )
+	{
+		count = pPool->NodesPerSlab;
+	}
+
+	if( count > ( UINT_MAX - LIST_POOL_ROUNDUP( sizeof(slab_t) ) ) / pPool->NodeSize )
+	{
+		count = ( UINT_MAX - LIST_POOL_ROUNDUP( sizeof(slab_t) ) ) / pPool->NodeSize;
+	}
+
+	pSlab = (slab_t*)pList->Allocator.alloc(pList->Allocator.pContext,
+		LIST_POOL_ROUNDUP( sizeof(slab_t) ) + (size_t)count * pPool->NodeSize);
+
+	if( NULL == pSlab )
+	{
+		return;
+	}
+
+	pSlab->pNext = pPool->pSlabs;
+	pPool->pSlabs = pSlab;
+	pPool->pCarve = (char*)pSlab + LIST_POOL_ROUNDUP( sizeof(slab_t) );
+	pPool->CarveLeft = count;
+}
+
+/*****************************************************************************
+ * Function      : BuildChain
+ * Description   : 内部实现接口，用连续存放的count个用户数据建立一条独立的节点
+ 				   链，返回首节点
+ * Input         : list_t* pList  
+                const void* pData  
+                unsigned int count  大于0
+                node_t** ppTail  返回尾节点
+ * Output        : None
+ * Return        : static
+ * Others        : 失败时释放已分配的节点并返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* BuildChain(list_t* pList, const void* pData, unsigned int count, node_t** ppTail)
+{
+	node_t head;
+	node_t* pTail = &head;
+	node_t* pNewNode = NULL;
+	const char* pSrc = (const char*)pData;
+	unsigned int counter = 0;
+
+	ReservePoolNodes(pList, count);
+
+	for( counter = 0; counter < count; counter++, pSrc += pList->CarryDataSize )
+	{
+		pNewNode = AllocNode(pList);
+
+		if( NULL == pNewNode )
+		{
+			pTail->pNext = NULL;
+
+			while( NULL != head.pNext )
+			{
+				pNewNode = head.pNext;
+				head.pNext = pNewNode->pNext;
+				FreeNode(pList, pNewNode);
+			}
+
+			return NULL;
+		}
+
+		PackageData( pNewNode, pSrc, pList );
+		pTail->pNext = pNewNode;
+		pTail = pNewNode;
+	}
+
+	pTail->pNext = NULL;
+	*ppTail = pTail;
+
+	return head.pNext;
+}
+
+/*****************************************************************************
+ * Function      : LinkChain
+ * Description   : 内部实现接口，将一条首尾为pFirst/pLast、共count个节点的独立
+ 				   节点链接入链表容器，使pFirst位于index处
+ * Input         : list_t* pList       
+                unsigned int index  0~size
+                node_t* pFirst  
+                node_t* pLast  
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需保证容量足够；同时维护尾指针、游标与跳表
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void LinkChain(list_t* pList, unsigned int index, node_t* pFirst, node_t* pLast, unsigned int count)
+{
+	node_t* pPrev = NULL;
+	node_t* pScan = NULL;
+	unsigned int counter = 0;
+
+	if( 0 == index )
+	{
+		pLast->pNext = pList->pHead;
+		pList->pHead = pFirst;
+	}
+	else
+	{
+		pPrev = ( index == pList->Size ) ? pList->pTail : LocateNode(pList, index - 1, NULL);
+		pLast->pNext = pPrev->pNext;
+		pPrev->pNext = pFirst;
+	}
+
+	if( NULL == pLast->pNext )
+	{
+		pList->pTail = pLast;
+	}
+
+	if( NULL != pList->pCursor && pList->CursorIndex >= index )
+	{
+		pList->CursorIndex += count;
+	}
+
+	pList->Size += count;
+	pList->Revision++;
+
+	if( NULL != pList->pSkipHeader || NULL != pList->pHash )
+	{
+		for( pScan = pFirst, counter = 0; counter < count; pScan = pScan->pNext, counter++ )
+		{
+			SkipInsertTower(pList, index + counter, pScan);
+			HashInsertNode(pList, pScan);
+		}
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperatePushFrontN
+ * Description   : 将连续存放的count个用户数据按原顺序批量添加到链表容器头部
+ * Input         : list_t* pList      
+                const void* pData  count*CarryDataSize字节
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 完成后get(0)得到pData中的第一个数据
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperatePushFrontN(list_t* pList, const void* pData, unsigned int count)
+{
+	return pList->insertrange(pList, 0, pData, count);
+}
+
+/*****************************************************************************
+ * Function      : OperatePushBackN
+ * Description   : 将连续存放的count个用户数据按原顺序批量添加到链表容器尾部
+ * Input         : list_t* pList      
+                const void* pData  count*CarryDataSize字节
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperatePushBackN(list_t* pList, const void* pData, unsigned int count)
+{
+	return pList->insertrange(pList, pList->Size, pData, count);
+}
+
+/*****************************************************************************
+ * Function      : OperateInsertRange
+ * Description   : 将连续存放的count个用户数据按原顺序批量插入到链表容器指定
+ 				   index处的元素之前，index等于size时添加到尾部
+ * Input         : list_t* pList       
+                unsigned int index  0~size
+                const void* pData  count*CarryDataSize字节
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 先建立独立的节点链再一次性接入，只定位一次插入位置；启用节点
+ 				   池时所需节点尽量从同一块内存中切分；容量不足或内存不足时
+ 				   不插入任何元素
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count)
+{
+	node_t* pFirst = NULL;
+	node_t* pLast = NULL;
+
+	if( pList->Size < index || pList->MaxSize < pList->Size || pList->MaxSize - pList->Size < count )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == count )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( OPERATE_FAIL == HashReserve(pList, count) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pFirst = BuildChain(pList, pData, count, &pLast);
+
+	if( NULL == pFirst )
+	{
+		return OPERATE_FAIL;
+	}
+
+	LinkChain(pList, index, pFirst, pLast, count);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateToArray
+ * Description   : 按顺序将链表容器的用户数据拷贝到调用者提供的连续缓冲区中
+ * Input         : list_t* pList       
+                void* pBuffer  至少capacity*CarryDataSize字节
+                unsigned int capacity  缓冲区最多可容纳的元素个数
+ * Output        : None
+ * Return        : static
+ * Others        : 返回实际拷贝的元素个数，即min(size, capacity)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateToArray(list_t* pList, void* pBuffer, unsigned int capacity)
+{
+	node_t* pScan = pList->pHead;
+	char* pDst = (char*)pBuffer;
+	unsigned int counter = 0;
+
+	for( ; NULL != pScan && counter < capacity; pScan = pScan->pNext, counter++ )
+	{
+		memcpy(pDst, pScan->item.pData, pList->CarryDataSize);
+		pDst += pList->CarryDataSize;
+	}
+
+	return counter;
+}
+
+/*****************************************************************************
+ * Function      : IsSpliceValid
+ * Description   : 内部实现接口，检查能否将pSource的全部元素移动到pList的
+ 				   index处
+ * Input         : list_t* pList       
+                unsigned int index  
+                list_t* pSource  
+ * Output        : None
+ * Return        : static
+ * Others        : 要求两个链表不同、CarryDataSize相同，且pList剩余容量足够
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int IsSpliceValid(list_t* pList, unsigned int index, list_t* pSource)
+{
+	if( NULL == pSource || pList == pSource || pList->CarryDataSize != pSource->CarryDataSize )
+	{
+		return OPERATE_FALSE;
+	}
+
+	if( pList->Size < index || pList->MaxSize < pList->Size || pList->MaxSize - pList->Size < pSource->Size )
+	{
+		return OPERATE_FALSE;
+	}
+
+	return OPERATE_TRUE;
+}
+
+/*****************************************************************************
+ * Function      : IsRelinkable
+ * Description   : 内部实现接口，pSource的节点(或块)能否直接链接到pList中
+ * Input         : list_t* pList       
+                list_t* pSource  
+ * Output        : None
+ * Return        : static
+ * Others        : 节点或块最终由pList释放，因此要求两者存储方式相同、分配器
+ 				   相同，且同时启用或同时未启用节点池(池中节点随所属的块整体
+ 				   释放，两者都启用时由AdoptPool将pSource的块并入pList的池)；
+ 				   compact会为链表启用节点池，因此整理过的链表与未启用节点池
+ 				   的链表之间只能逐个拷贝；展开链表还要求BlockItems相同
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 持久化链表的节点位于各自的文件中，不能直接链接
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 两者都启用节点池时也可直接链接
+*****************************************************************************/
+static int IsRelinkable(list_t* pList, list_t* pSource)
+{
+	if( pList->Storage != pSource->Storage || LIST_STORAGE_PERSIST == pList->Storage
+		|| ( NULL == pList->pPool ) != ( NULL == pSource->pPool ) )
+	{
+		return OPERATE_FALSE;
+	}
+
+	if( NULL != pList->pPool && pList->pPool->NodeSize != pSource->pPool->NodeSize )
+	{
+		return OPERATE_FALSE;
+	}
+
+	if( pList->Allocator.alloc != pSource->Allocator.alloc
+		|| pList->Allocator.release != pSource->Allocator.release
+		|| pList->Allocator.pContext != pSource->Allocator.pContext )
+	{
+		return OPERATE_FALSE;
+	}
+
+	if( LIST_STORAGE_UNROLLED == pList->Storage && pList->BlockItems != pSource->BlockItems )
+	{
+		return OPERATE_FALSE;
+	}
+
+	return OPERATE_TRUE;
+}
+
+/*****************************************************************************
+ * Function      : AdoptPool
+ * Description   : 内部实现接口，将pSource节点池的全部块并入pList的节点池
+ * Input         : list_t* pList       
+                list_t* pSource  
+ * Output        : None
+ * Return        : static
+ * Others        : 仅在pSource的全部节点移入pList时调用；pSource空闲链上的节点
+ 				   与当前块中尚未切分的节点加入pList的空闲链，pSource的池变为
+ 				   空池；需遍历pSource的块链与空闲链
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void AdoptPool(list_t* pList, list_t* pSource)
+{
+	pool_t* pPool = pList->pPool;
+	pool_t* pOther = pSource->pPool;
+	slab_t* pSlab = pOther->pSlabs;
+	node_t* pNode = NULL;
+
+	if( NULL == pSlab )
+	{
+		return;
+	}
+
+	while(NULL != pSlab->pNext)
+	{
+		pSlab = pSlab->pNext;
+	}
+
+	pSlab->pNext = pPool->pSlabs;
+	pPool->pSlabs = pOther->pSlabs;
+
+	while(0 != pOther->CarveLeft)
+	{
+		pNode = (node_t*)pOther->pCarve;
+		pOther->pCarve += pOther->NodeSize;
+		pOther->CarveLeft--;
+		FreeNode(pList, pNode);
+	}
+
+	while(NULL != pOther->pFreeNodes)
+	{
+		pNode = pOther->pFreeNodes;
+		pOther->pFreeNodes = pNode->pNext;
+		FreeNode(pList, pNode);
+	}
+
+	pOther->pSlabs = NULL;
+	pOther->pCarve = NULL;
+}
+
+/*****************************************************************************
+ * Function      : SpliceByCopy
+ * Description   : 内部实现接口，无法直接链接时逐个拷贝pSource的元素到pList
+ 				   的index处并从pSource中删除
+ * Input         : list_t* pList       
+                unsigned int index  
+                list_t* pSource  
+ * Output        : None
+ * Return        : static
+ * Others        : 内存不足时已移动的元素保留在pList中，其余仍在pSource中
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int SpliceByCopy(list_t* pList, unsigned int index, list_t* pSource)
+{
+	while( !pSource->empty(pSource) )
+	{
+		if( OPERATE_FAIL == pList->insertrange(pList, index, pSource->front(pSource), 1) )
+		{
+			return OPERATE_FAIL;
+		}
+
+		pSource->popfront(pSource);
+		index++;
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateSplice
+ * Description   : 将pSource的全部元素按原顺序移动到链表容器index处的元素之前，
+ 				   index等于size时添加到尾部，完成后pSource为空
+ * Input         : list_t* pList       
+                unsigned int index  0~size
+                list_t* pSource  CarryDataSize须与pList相同
+ * Output        : None
+ * Return        : static
+ * Others        : 满足IsRelinkable时只修改指针，不拷贝用户数据，除定位插入位置
+ 				   外为O(1)(启用跳表时需为移入的节点建立索引，启用节点池时需
+ 				   并入pSource的块)；否则退化为逐个拷贝，例如只有一方启用了节点
+ 				   池(包括compact过的链表)；pList容量不足时不移动任何元素
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 两者都启用节点池时并入pSource的块后直接链接
+*****************************************************************************/
+static int OperateSplice(list_t* pList, unsigned int index, list_t* pSource)
+{
+	node_t* pFirst = NULL;
+	node_t* pLast = NULL;
+	unsigned int count = 0;
+
+	if( OPERATE_FALSE == IsSpliceValid(pList, index, pSource) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == pSource->Size )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( OPERATE_FALSE == IsRelinkable(pList, pSource) )
+	{
+		return SpliceByCopy(pList, index, pSource);
+	}
+
+	if( OPERATE_FAIL == HashReserve(pList, pSource->Size) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pFirst = pSource->pHead;
+	pLast = pSource->pTail;
+	count = pSource->Size;
+
+	ReleaseSkipTowers(pSource);
+	pSource->Revision++;
+	HashClear(pSource);
+	pSource->pHead = NULL;
+	pSource->pTail = NULL;
+	pSource->pCursor = NULL;
+	pSource->CursorIndex = 0;
+	pSource->Size = 0;
+
+	if( NULL != pList->pPool )
+	{
+		AdoptPool(pList, pSource);
+	}
+
+	LinkChain(pList, index, pFirst, pLast, count);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateSpliceAfter
+ * Description   : 将pSource的全部元素按原顺序移动到链表容器index处的元素之后
+ * Input         : list_t* pList       
+                unsigned int index  0~size-1
+                list_t* pSource  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateSpliceAfter(list_t* pList, unsigned int index, list_t* pSource)
+{
+	if( index >= pList->Size )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return pList->splice(pList, index + 1, pSource);
+}
+
+/*****************************************************************************
+ * Function      : OperateConcat
+ * Description   : 将pSource的全部元素按原顺序移动到链表容器尾部
+ * Input         : list_t* pList       
+                list_t* pSource  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateConcat(list_t* pList, list_t* pSource)
+{
+	return pList->splice(pList, pList->Size, pSource);
+}
+
+/*****************************************************************************
+ * Function      : PackTagged
+ * Description   : 内部实现接口，将节点指针与版本标记合成一个可原子比较交换的字
+ * Input         : node_t* pNode  
+                unsigned long long tag  
+ * Output        : None
+ * Return        : static
+ * Others        : 标记占用LIST_TAG_SHIFT以上的位，64位平台要求用户空间地址不超
+ 				   过48位；每次成功修改栈顶时标记加1，用于防止ABA问题；64位平台
+ 				   的标记只有16位，每65536次修改回绕一次，见OperateSetConcurrent
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned long long PackTagged(node_t* pNode, unsigned long long tag)
+{
+	return (unsigned long long)(size_t)pNode | ( tag << LIST_TAG_SHIFT );
+}
+
+/*****************************************************************************
+ * Function      : TaggedNode
+ * Description   : 内部实现接口，取出合成字中的节点指针
+ * Input         : unsigned long long word  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* TaggedNode(unsigned long long word)
+{
+	return (node_t*)(size_t)( word & ( ( 1ULL << LIST_TAG_SHIFT ) - 1 ) );
+}
+
+/*****************************************************************************
+ * Function      : PushTagged
+ * Description   : 内部实现接口，无锁地将节点压入以合成字为栈顶的Treiber栈
+ * Input         : unsigned long long* pTop  
+                node_t* pNode  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PushTagged(unsigned long long* pTop, node_t* pNode)
+{
+	unsigned long long top = LIST_ATOMIC_LOAD(pTop);
+
+	do
+	{
+		LIST_ATOMIC_STORE_RELAXED(&pNode->pNext, TaggedNode(top));
+	}while( !LIST_ATOMIC_CAS(pTop, &top, PackTagged(pNode, ( top >> LIST_TAG_SHIFT ) + 1)) );
+}
+
+/*****************************************************************************
+ * Function      : PopTagged
+ * Description   : 内部实现接口，无锁地从以合成字为栈顶的Treiber栈中弹出节点
+ * Input         : unsigned long long* pTop  
+ * Output        : None
+ * Return        : static
+ * Others        : 栈为空时返回NULL；读取的栈顶节点可能已被其他线程弹出，但并发
+ 				   模式下弹出的节点只回收到空闲栈而不释放，读取其pNext总是安全
+ 				   的，版本标记保证此时比较交换失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* PopTagged(unsigned long long* pTop)
+{
+	unsigned long long top = LIST_ATOMIC_LOAD(pTop);
+	node_t* pNode = NULL;
+	node_t* pNext = NULL;
+
+	do
+	{
+		pNode = TaggedNode(top);
+
+		if( NULL == pNode )
+		{
+			return NULL;
+		}
+
+		pNext = (node_t*)LIST_ATOMIC_LOAD_RELAXED(&pNode->pNext);
+	}while( !LIST_ATOMIC_CAS(pTop, &top, PackTagged(pNext, ( top >> LIST_TAG_SHIFT ) + 1)) );
+
+	return pNode;
+}
+
+/*****************************************************************************
+ * Function      : OperateSetConcurrent
+ * Description   : 进入或退出并发栈模式；并发模式下pushfront/popfront/
+ 				   popfrontcopy/size/empty可被多个线程同时调用且无锁
+ * Input         : list_t* pList  
+                int enable  OPERATE_TRUE进入，OPERATE_FALSE退出
+ * Output        : None
+ * Return        : static
+ * Others        : 须在没有其他线程访问链表时调用；仅支持未启用节点池、跳表、
+ 				   哈希索引的节点存储，且平台须支持LIST_HAS_ATOMIC；并发模式下
+ 				   其余操作(clear/destroy/full/capacity/beforebegin除外)直接返回
+ 				   失败或不做处理，分配器须是线程安全的；
+ 				   弹出的节点暂存于空闲栈中供pushfront复用，退出时才释放；
+ 				   退出时重新计算尾指针，时间复杂度O(n)；栈顶的ABA版本标记
+ 				   在64位平台只有16位(32位平台为32位)，某线程读出栈顶后被挂起
+ 				   期间若恰好发生65536的整数倍次栈顶修改且同一节点回到栈顶，
+ 				   其CAS会错误地成功，因此不适用于线程可能被长时间挂起而其余
+ 				   线程持续高频操作的场景
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 不能与读多写少模式同时启用
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 并发模式下不支持的接口绑定为直接返回失败的占位实现
+*****************************************************************************/
+static int OperateSetConcurrent(list_t* pList, int enable)
+{
+	node_t* pNode = NULL;
+
+	if( ( 0 != enable ) == ( OPERATE_TRUE == pList->Concurrent ) )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( enable )
+	{
+		if( !LIST_HAS_ATOMIC || LIST_STORAGE_NODE != pList->Storage || NULL != pList->pReclaim
+			|| NULL != pList->pPool || NULL != pList->pSkipHeader || NULL != pList->pHash )
+		{
+			return OPERATE_FAIL;
+		}
+
+		pList->ConcurrentHead = PackTagged(pList->pHead, 0);
+		pList->ConcurrentFree = 0;
+		pList->pCursor = NULL;
+		pList->Concurrent = OPERATE_TRUE;
+		pList->Revision++;
+
+		BindConcurrentOperations(pList);
+
+		return OPERATE_SUCC;
+	}
+
+	pList->pHead = TaggedNode(pList->ConcurrentHead);
+	pList->pTail = pList->pHead;
+
+	while( NULL != pList->pTail && NULL != pList->pTail->pNext )
+	{
+		pList->pTail = pList->pTail->pNext;
+	}
+
+	while( NULL != ( pNode = TaggedNode(pList->ConcurrentFree) ) )
+	{
+		pList->ConcurrentFree = PackTagged(pNode->pNext, 0);
+		FreeNode(pList, pNode);
+	}
+
+	pList->ConcurrentHead = 0;
+	pList->Concurrent = OPERATE_FALSE;
+	pList->Revision++;
+
+	BindNodeOperations(pList);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentPushFront
+ * Description   : 并发模式版本的pushfront
+ * Input         : list_t* pList      
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 先原子地占用一个容量名额，因此不会超过MaxSize；优先复用空闲
+ 				   栈中的节点
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ConcurrentPushFront(list_t* pList, const void* pData)
+{
+	node_t* pNewNode = NULL;
+
+	if( LIST_ATOMIC_ADD(&pList->Size, 1) > pList->MaxSize )
+	{
+		LIST_ATOMIC_SUB(&pList->Size, 1);
+		return OPERATE_FAIL;
+	}
+
+	pNewNode = PopTagged(&pList->ConcurrentFree);
+
+	if( NULL == pNewNode )
+	{
+		pNewNode = AllocNode(pList);
+	}
+
+	if( NULL == pNewNode )
+	{
+		LIST_ATOMIC_SUB(&pList->Size, 1);
+		return OPERATE_FAIL;
+	}
+
+	PackageData( pNewNode, pData, pList );
+	PushTagged(&pList->ConcurrentHead, pNewNode);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentPopFront
+ * Description   : 并发模式版本的popfront
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ConcurrentPopFront(list_t* pList)
+{
+	node_t* pNode = PopTagged(&pList->ConcurrentHead);
+
+	if( NULL == pNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	LIST_ATOMIC_SUB(&pList->Size, 1);
+	PushTagged(&pList->ConcurrentFree, pNode);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentPopFrontCopy
+ * Description   : 并发模式版本的popfrontcopy
+ * Input         : list_t* pList  
+                void* pOut  
+ * Output        : None
+ * Return        : static
+ * Others        : 节点弹出后归调用线程独占，再拷贝数据
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ConcurrentPopFrontCopy(list_t* pList, void* pOut)
+{
+	node_t* pNode = PopTagged(&pList->ConcurrentHead);
+
+	if( NULL == pNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	LIST_ATOMIC_SUB(&pList->Size, 1);
+	memcpy(pOut, pNode->item.pData, pList->CarryDataSize);
+	PushTagged(&pList->ConcurrentFree, pNode);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentSize
+ * Description   : 并发模式版本的size
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 有并发修改时只是近似值
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int ConcurrentSize(list_t* pList)
+{
+	return LIST_ATOMIC_LOAD(&pList->Size);
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentEmpty
+ * Description   : 并发模式版本的empty
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ConcurrentEmpty(list_t* pList)
+{
+	return ( ( NULL == TaggedNode(LIST_ATOMIC_LOAD(&pList->ConcurrentHead)) ) ? 1 : 0 );
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentClear
+ * Description   : 并发模式版本的clear
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 与clear相同，须在没有其他线程访问链表时调用；完成后仍处于
+ 				   并发模式
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ConcurrentClear(list_t* pList)
+{
+	OperateSetConcurrent(pList, OPERATE_FALSE);
+	OperateClear(pList);
+
+	return OperateSetConcurrent(pList, OPERATE_TRUE);
+}
+
+/*****************************************************************************
+ * Function      : ConcurrentDestroy
+ * Description   : 并发模式版本的destroy
+ * Input         : list_t** ppList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ConcurrentDestroy(list_t** ppList)
+{
+	if( NULL == *ppList )
+	{
+		return OPERATE_SUCC;
+	}
+
+	OperateSetConcurrent(*ppList, OPERATE_FALSE);
+
+	return OperateDestroy(ppList);
+}
+
+/*****************************************************************************
+ * Function      : RejectPeek ~ RejectLocality
+ * Description   : 内部实现接口，并发栈模式与读多写少模式下不支持的接口的占位
+ 				   实现，按函数签名每种一个
+ * Input         : list_t* pList  其余参数与被替换的接口相同，均不使用
+ * Output        : None
+ * Return        : static
+ * Others        : 返回指针的接口返回NULL，findindexif返回OPERATE_INVALID，
+ 				   removeif/toarray/countif/findall/locality返回0，其余返回
+ 				   OPERATE_FAIL或不做任何处理；均不访问链表内容
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* RejectPeek(list_t* pList)
+{
+	(void)pList;
+
+	return NULL;
+}
+
+static int RejectList(list_t* pList)
+{
+	(void)pList;
+
+	return OPERATE_FAIL;
+}
+
+static int RejectData(list_t* pList, const void* pData)
+{
+	(void)pList;
+	(void)pData;
+
+	return OPERATE_FAIL;
+}
+
+static int RejectIndex(list_t* pList, unsigned int index)
+{
+	(void)pList;
+	(void)index;
+
+	return OPERATE_FAIL;
+}
+
+static void* RejectGet(list_t* pList, unsigned int index)
+{
+	(void)pList;
+	(void)index;
+
+	return NULL;
+}
+
+static void* RejectFindIf(list_t* pList, unsigned int(*exec)(const void*))
+{
+	(void)pList;
+	(void)exec;
+
+	return NULL;
+}
+
+static void* RejectFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	(void)pList;
+	(void)exec;
+	(void)pRef;
+
+	return NULL;
+}
+
+static unsigned int RejectFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	(void)pList;
+	(void)exec;
+	(void)pRef;
+
+	return OPERATE_INVALID;
+}
+
+static unsigned int RejectRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	(void)pList;
+	(void)exec;
+	(void)pRef;
+
+	return 0;
+}
+
+static int RejectIndexData(list_t* pList, unsigned int index, const void* pData)
+{
+	(void)pList;
+	(void)index;
+	(void)pData;
+
+	return OPERATE_FAIL;
+}
+
+static int RejectTwoIndices(list_t* pList, unsigned int arg1, unsigned int arg2)
+{
+	(void)pList;
+	(void)arg1;
+	(void)arg2;
+
+	return OPERATE_FAIL;
+}
+
+static void RejectSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*))
+{
+	(void)pList;
+	(void)exec;
+}
+
+static void RejectParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold)
+{
+	(void)pList;
+	(void)exec;
+	(void)thread_count;
+	(void)serial_threshold;
+}
+
+static void RejectResize(list_t* pList, unsigned int new_size)
+{
+	(void)pList;
+	(void)new_size;
+}
+
+static void RejectForeach(list_t* pList, void(*exec)(void*))
+{
+	(void)pList;
+	(void)exec;
+}
+
+static int RejectDataCount(list_t* pList, const void* pData, unsigned int count)
+{
+	(void)pList;
+	(void)pData;
+	(void)count;
+
+	return OPERATE_FAIL;
+}
+
+static int RejectInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count)
+{
+	(void)pList;
+	(void)index;
+	(void)pData;
+	(void)count;
+
+	return OPERATE_FAIL;
+}
+
+static unsigned int RejectToArray(list_t* pList, void* pBuffer, unsigned int capacity)
+{
+	(void)pList;
+	(void)pBuffer;
+	(void)capacity;
+
+	return 0;
+}
+
+static int RejectSplice(list_t* pList, unsigned int index, list_t* pSource)
+{
+	(void)pList;
+	(void)index;
+	(void)pSource;
+
+	return OPERATE_FAIL;
+}
+
+static int RejectConcat(list_t* pList, list_t* pSource)
+{
+	(void)pList;
+	(void)pSource;
+
+	return OPERATE_FAIL;
+}
+
+static int RejectIter(list_t* pList, list_iter_t* pIter)
+{
+	(void)pList;
+	(void)pIter;
+
+	return OPERATE_FAIL;
+}
+
+static void* RejectDeref(list_t* pList, list_iter_t* pIter)
+{
+	(void)pList;
+	(void)pIter;
+
+	return NULL;
+}
+
+static int RejectIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData)
+{
+	(void)pList;
+	(void)pIter;
+	(void)pData;
+
+	return OPERATE_FAIL;
+}
+
+static void* RejectFindByKey(list_t* pList, const void* pKey)
+{
+	(void)pList;
+	(void)pKey;
+
+	return NULL;
+}
+
+static void RejectForeach2(list_t* pList, void(*exec)(void*, void*), void* pContext)
+{
+	(void)pList;
+	(void)exec;
+	(void)pContext;
+}
+
+static void RejectForeachBatch(list_t* pList, void(*exec)(void**, unsigned int, void*), void* pContext)
+{
+	(void)pList;
+	(void)exec;
+	(void)pContext;
+}
+
+static void* RejectFindIfBatch(list_t* pList, unsigned int(*exec)(void**, unsigned int, void*), void* pContext)
+{
+	(void)pList;
+	(void)exec;
+	(void)pContext;
+
+	return NULL;
+}
+
+static void RejectParallelForeach(list_t* pList, void(*exec)(void*, void*), void* pContext, unsigned int thread_count)
+{
+	(void)pList;
+	(void)exec;
+	(void)pContext;
+	(void)thread_count;
+}
+
+static unsigned int RejectCountIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, unsigned int thread_count)
+{
+	(void)pList;
+	(void)exec;
+	(void)pRef;
+	(void)thread_count;
+
+	return 0;
+}
+
+static unsigned int RejectFindAll(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef, void** ppOutput, unsigned int capacity, unsigned int thread_count)
+{
+	(void)pList;
+	(void)exec;
+	(void)pRef;
+	(void)ppOutput;
+	(void)capacity;
+	(void)thread_count;
+
+	return 0;
+}
+
+static int RejectFile(list_t* pList, FILE* pFile)
+{
+	(void)pList;
+	(void)pFile;
+
+	return OPERATE_FAIL;
+}
+
+static unsigned long long RejectLocality(list_t* pList)
+{
+	(void)pList;
+
+	return 0;
+}
+
+/*****************************************************************************
+ * Function      : BindConcurrentOperations
+ * Description   : 内部实现接口，进入并发栈模式时替换操作接口
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 并发模式下链表内容只存在于ConcurrentHead中，pHead/pTail不再
+ 				   有效，因此除并发实现外的接口都替换为直接返回失败的占位实现；
+ 				   full经由size实现，capacity/beforebegin不读取链表内容，无需
+ 				   替换
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void BindConcurrentOperations(list_t* pList)
+{
+	pList->front = RejectPeek;
+	pList->back = RejectPeek;
+	pList->pushfront = ConcurrentPushFront;
+	pList->pushback = RejectData;
+	pList->popfront = ConcurrentPopFront;
+	pList->popback = RejectList;
+	pList->get = RejectGet;
+	pList->findif = RejectFindIf;
+	pList->findif2 = RejectFindIf2;
+	pList->findindexif = RejectFindIndexIf;
+	pList->remove = RejectIndex;
+	pList->assign = RejectIndexData;
+	pList->insert = RejectIndexData;
+	pList->insertafter = RejectIndexData;
+	pList->swap = RejectTwoIndices;
+	pList->sortif = RejectSortIf;
+	pList->sortbykey = RejectTwoIndices;
+	pList->parallelsortif = RejectParallelSortIf;
+	pList->size = ConcurrentSize;
+	pList->resize = RejectResize;
+	pList->empty = ConcurrentEmpty;
+	pList->clear = ConcurrentClear;
+	pList->destroy = ConcurrentDestroy;
+	pList->foreach = RejectForeach;
+	pList->pushfrontn = RejectDataCount;
+	pList->pushbackn = RejectDataCount;
+	pList->insertrange = RejectInsertRange;
+	pList->toarray = RejectToArray;
+	pList->splice = RejectSplice;
+	pList->spliceafter = RejectSplice;
+	pList->concat = RejectConcat;
+	pList->begin = RejectIter;
+	pList->next = RejectIter;
+	pList->deref = RejectDeref;
+	pList->iterinsertafter = RejectIterInsertAfter;
+	pList->itereraseafter = RejectIter;
+	pList->removeif = RejectRemoveIf;
+	pList->findbykey = RejectFindByKey;
+	pList->foreach2 = RejectForeach2;
+	pList->foreachbatch = RejectForeachBatch;
+	pList->findifbatch = RejectFindIfBatch;
+	pList->parallelforeach = RejectParallelForeach;
+	pList->countif = RejectCountIf;
+	pList->findall = RejectFindAll;
+	pList->popfrontcopy = ConcurrentPopFrontCopy;
+	pList->savelist = RejectFile;
+	pList->loadlist = RejectFile;
+	pList->flush = RejectList;
+	pList->compact = RejectList;
+	pList->locality = RejectLocality;
+}
+
+/*****************************************************************************
+ * Function      : OperateReadBegin
+ * Description   : 读多写少模式下进入读临界区，区内读到的节点不会被回收
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 返回读者槽位号，须原样传给readend；未处于读多写少模式时返回
+ 				   OPERATE_INVALID；get/findif2等接口返回的数据指针只在临界区
+ 				   内保证有效，需要在接口返回后继续使用时，调用者应先readbegin；
+ 				   最多LIST_EBR_MAX_READERS个读者同时处于临界区，超出时自旋等待
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int OperateReadBegin(list_t* pList)
+{
+	reclaim_t* pReclaim = pList->pReclaim;
+	unsigned int slot = 0;
+	unsigned int expected = 0;
+	unsigned int epoch = 0;
+
+	if( NULL == pReclaim )
+	{
+		return OPERATE_INVALID;
+	}
+
+	slot = LIST_ATOMIC_ADD(&pReclaim->NextSlot, 1) % LIST_EBR_MAX_READERS;
+
+	for( ; ; slot = ( slot + 1 ) % LIST_EBR_MAX_READERS )
+	{
+		epoch = LIST_ATOMIC_LOAD(&pReclaim->GlobalEpoch);
+		expected = 0;
+
+		if( LIST_ATOMIC_CAS(&pReclaim->Slots[slot].Epoch, &expected, ( epoch << 1 ) | 1) )
+		{
+			break;
+		}
+	}
+
+	//与AdvanceEpoch中的栅栏配对：写者要么看到本槽位，要么本读者看到其全部摘链
+	LIST_ATOMIC_FENCE();
+
+	return slot;
+}
+
+/*****************************************************************************
+ * Function      : OperateReadEnd
+ * Description   : 离开readbegin进入的读临界区
+ * Input         : list_t* pList  
+                unsigned int slot  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void OperateReadEnd(list_t* pList, unsigned int slot)
+{
+	if( NULL == pList->pReclaim || slot >= LIST_EBR_MAX_READERS )
+	{
+		return;
+	}
+
+	LIST_ATOMIC_STORE(&pList->pReclaim->Slots[slot].Epoch, 0);
+}
+
+/*****************************************************************************
+ * Function      : ReleaseRetired
+ * Description   : 内部实现接口，释放一个纪元桶中已摘除的全部节点
+ * Input         : list_t* pList  
+                unsigned int bucket  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void ReleaseRetired(list_t* pList, unsigned int bucket)
+{
+	reclaim_t* pReclaim = pList->pReclaim;
+	unsigned int i = 0;
+
+	for( i = 0; i < pReclaim->RetiredCount[bucket]; i++ )
+	{
+		FreeNode(pList, pReclaim->ppRetired[bucket][i]);
+	}
+
+	pReclaim->PendingCount -= pReclaim->RetiredCount[bucket];
+	pReclaim->RetiredCount[bucket] = 0;
+}
+
+/*****************************************************************************
+ * Function      : AdvanceEpoch
+ * Description   : 内部实现接口，所有活跃读者都已进入当前纪元时推进全局纪元，
+ 				   并释放两个纪元之前摘除的节点
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 仅由写者调用；仍有读者停留在旧纪元时返回OPERATE_FAIL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int AdvanceEpoch(list_t* pList)
+{
+	reclaim_t* pReclaim = pList->pReclaim;
+	unsigned int epoch = pReclaim->GlobalEpoch;
+	unsigned int value = 0;
+	unsigned int slot = 0;
+
+	LIST_ATOMIC_FENCE();
+
+	for( slot = 0; slot < LIST_EBR_MAX_READERS; slot++ )
+	{
+		value = LIST_ATOMIC_LOAD(&pReclaim->Slots[slot].Epoch);
+
+		if( 0 != value && ( value >> 1 ) != epoch )
+		{
+			return OPERATE_FAIL;
+		}
+	}
+
+	LIST_ATOMIC_STORE(&pReclaim->GlobalEpoch, ( epoch + 1 ) & LIST_EBR_EPOCH_MASK);
+	pReclaim->Bucket = ( pReclaim->Bucket + 1 ) % LIST_EBR_BUCKETS;
+	ReleaseRetired(pList, ( pReclaim->Bucket + 1 ) % LIST_EBR_BUCKETS);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : RetireNode
+ * Description   : 内部实现接口，将已摘链的节点放入当前纪元桶，延迟到没有读者
+ 				   可能访问时再释放
+ * Input         : list_t* pList  
+                node_t* pNode  
+ * Output        : None
+ * Return        : static
+ * Others        : 不修改节点的pNext，停留在该节点上的读者仍可继续向后遍历；
+ 				   桶扩容失败时同步等待两次纪元推进后直接释放
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void RetireNode(list_t* pList, node_t* pNode)
+{
+	reclaim_t* pReclaim = pList->pReclaim;
+	unsigned int bucket = pReclaim->Bucket;
+	unsigned int capacity = pReclaim->RetiredCapacity[bucket];
+	node_t** ppRetired = NULL;
+
+	if( pReclaim->RetiredCount[bucket] == capacity )
+	{
+		capacity = ( 0 == capacity ) ? LIST_EBR_COLLECT_THRESHOLD : capacity * 2;
+		ppRetired = (node_t**)pList->Allocator.alloc(pList->Allocator.pContext, capacity * sizeof(node_t*));
+
+		if( NULL == ppRetired )
+		{
+			while( OPERATE_FAIL == AdvanceEpoch(pList) )
+			{
+			}
+
+			while( OPERATE_FAIL == AdvanceEpoch(pList) )
+			{
+			}
+
+			FreeNode(pList, pNode);
+			return;
+		}
+
+		if( NULL != pReclaim->ppRetired[bucket] )
+		{
+			memcpy(ppRetired, pReclaim->ppRetired[bucket], pReclaim->RetiredCount[bucket] * sizeof(node_t*));
+			pList->Allocator.release(pList->Allocator.pContext, pReclaim->ppRetired[bucket]);
+		}
+
+		pReclaim->ppRetired[bucket] = ppRetired;
+		pReclaim->RetiredCapacity[bucket] = capacity;
+	}
+
+	pReclaim->ppRetired[bucket][pReclaim->RetiredCount[bucket]++] = pNode;
+
+	if( ++pReclaim->PendingCount >= LIST_EBR_COLLECT_THRESHOLD )
+	{
+		AdvanceEpoch(pList);
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateSetReadMostly
+ * Description   : 进入或退出读多写少模式；该模式下读接口不加锁，与一个写者
+ 				   并发执行，被删除的节点经纪元回收(epoch-based reclamation)
+ 				   延迟释放
+ * Input         : list_t* pList  
+                int enable  OPERATE_TRUE进入，OPERATE_FALSE退出
+ * Output        : None
+ * Return        : static
+ * Others        : 须在没有其他线程访问链表时调用；仅支持未启用跳表、哈希索引的
+ 				   节点存储，且平台须支持LIST_HAS_ATOMIC，不能与并发栈模式同时
+ 				   启用；读接口为front/back/get/findif/findif2/findindexif/
+ 				   foreach/size/empty/full/capacity，可被任意多个线程调用；写接口
+ 				   为pushfront/pushback/popfront/popfrontcopy/popback/insert/
+ 				   insertafter/remove/assign/clear，同一时刻只能有一个线程调用，
+ 				   且不能在读临界区(包括foreach回调)中调用；其余接口在该模式下
+ 				   直接返回失败或不做处理；
+ 				   assign以替换节点的方式实现，读者不会看到写了一半的数据
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 不支持的接口绑定为直接返回失败的占位实现，退出时恢复全部节点存储接口
+*****************************************************************************/
+static int OperateSetReadMostly(list_t* pList, int enable)
+{
+	reclaim_t* pReclaim = pList->pReclaim;
+	unsigned int bucket = 0;
+
+	if( ( 0 != enable ) == ( NULL != pReclaim ) )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( enable )
+	{
+		if( !LIST_HAS_ATOMIC || LIST_STORAGE_NODE != pList->Storage || OPERATE_TRUE == pList->Concurrent
+			|| NULL != pList->pSkipHeader || NULL != pList->pHash )
+		{
+			return OPERATE_FAIL;
+		}
+
+		pReclaim = (reclaim_t*)pList->Allocator.alloc(pList->Allocator.pContext, sizeof(reclaim_t));
+
+		if( NULL == pReclaim )
+		{
+			return OPERATE_FAIL;
+		}
+
+		memset(pReclaim, 0, sizeof(reclaim_t));
+		pList->pReclaim = pReclaim;
+		pList->pCursor = NULL;
+		pList->Revision++;
+
+		BindReadMostlyOperations(pList);
+
+		return OPERATE_SUCC;
+	}
+
+	for( bucket = 0; bucket < LIST_EBR_BUCKETS; bucket++ )
+	{
+		ReleaseRetired(pList, bucket);
+
+		if( NULL != pReclaim->ppRetired[bucket] )
+		{
+			pList->Allocator.release(pList->Allocator.pContext, pReclaim->ppRetired[bucket]);
+		}
+	}
+
+	pList->Allocator.release(pList->Allocator.pContext, pReclaim);
+	pList->pReclaim = NULL;
+	pList->pCursor = NULL;
+	pList->Revision++;
+
+	BindNodeOperations(pList);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyLocate
+ * Description   : 内部实现接口，读多写少模式下按原子读取的链接定位第index个
+ 				   节点
+ * Input         : list_t* pList  
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 链表被并发缩短时可能返回NULL；不使用也不更新游标
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static node_t* ReadMostlyLocate(list_t* pList, unsigned int index)
+{
+	node_t* pScan = LIST_ATOMIC_LOAD(&pList->pHead);
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < index && NULL != pScan; counter++ )
+	{
+		pScan = LIST_ATOMIC_LOAD(&pScan->pNext);
+	}
+
+	return pScan;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyLink
+ * Description   : 内部实现接口，在pPrev之后(为NULL时在链表头部)发布一个新节点
+ * Input         : list_t* pList      
+                node_t* pPrev      
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 新节点初始化完成后才以release语义写入前驱的链接
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyLink(list_t* pList, node_t* pPrev, const void* pData)
+{
+	node_t* pNewNode = NULL;
+
+	if( pList->full(pList) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pNewNode = AllocNode(pList);
+
+	if( NULL == pNewNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PackageData( pNewNode, pData, pList );
+	pNewNode->pNext = ( NULL == pPrev ) ? pList->pHead : pPrev->pNext;
+
+	if( NULL == pPrev )
+	{
+		LIST_ATOMIC_STORE(&pList->pHead, pNewNode);
+	}
+	else
+	{
+		LIST_ATOMIC_STORE(&pPrev->pNext, pNewNode);
+	}
+
+	if( NULL == pNewNode->pNext )
+	{
+		LIST_ATOMIC_STORE(&pList->pTail, pNewNode);
+	}
+
+	LIST_ATOMIC_STORE_RELAXED(&pList->Size, pList->Size + 1);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyUnlink
+ * Description   : 内部实现接口，摘除pPrev之后(为NULL时为首个)的节点并延迟回收
+ * Input         : list_t* pList  
+                node_t* pPrev  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyUnlink(list_t* pList, node_t* pPrev)
+{
+	node_t* pErase = ( NULL == pPrev ) ? pList->pHead : pPrev->pNext;
+
+	if( NULL == pErase )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( NULL == pPrev )
+	{
+		LIST_ATOMIC_STORE(&pList->pHead, pErase->pNext);
+	}
+	else
+	{
+		LIST_ATOMIC_STORE(&pPrev->pNext, pErase->pNext);
+	}
+
+	if( pList->pTail == pErase )
+	{
+		LIST_ATOMIC_STORE(&pList->pTail, pPrev);
+	}
+
+	LIST_ATOMIC_STORE_RELAXED(&pList->Size, pList->Size - 1);
+	RetireNode(pList, pErase);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyFront
+ * Description   : 读多写少模式版本的front
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* ReadMostlyFront(list_t* pList)
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pNode = LIST_ATOMIC_LOAD(&pList->pHead);
+	void* pData = ( NULL == pNode ) ? NULL : pNode->item.pData;
+
+	OperateReadEnd(pList, slot);
+
+	return pData;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyBack
+ * Description   : 读多写少模式版本的back
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* ReadMostlyBack(list_t* pList)
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pNode = LIST_ATOMIC_LOAD(&pList->pTail);
+	void* pData = ( NULL == pNode ) ? NULL : pNode->item.pData;
+
+	OperateReadEnd(pList, slot);
+
+	return pData;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyGet
+ * Description   : 读多写少模式版本的get
+ * Input         : list_t* pList  
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* ReadMostlyGet(list_t* pList, unsigned int index)
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pNode = ReadMostlyLocate(pList, index);
+	void* pData = ( NULL == pNode ) ? NULL : pNode->item.pData;
+
+	OperateReadEnd(pList, slot);
+
+	return pData;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyFindIf
+ * Description   : 读多写少模式版本的findif
+ * Input         : list_t* pList                    
+                unsigned int(*exec)(const void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* ReadMostlyFindIf(list_t* pList, unsigned int(*exec)(const void*))
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pScan = LIST_ATOMIC_LOAD(&pList->pHead);
+	void* pData = NULL;
+
+	while( NULL != pScan && OPERATE_TRUE != exec( pScan->item.pData ) )
+	{
+		pScan = LIST_ATOMIC_LOAD(&pScan->pNext);
+	}
+
+	pData = ( NULL == pScan ) ? NULL : pScan->item.pData;
+	OperateReadEnd(pList, slot);
+
+	return pData;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyFindIf2
+ * Description   : 读多写少模式版本的findif2
+ * Input         : list_t* pList                                 
+                unsigned int(*exec)(const void*, const void*)  
+                const void* pRef                               
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* ReadMostlyFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pScan = LIST_ATOMIC_LOAD(&pList->pHead);
+	void* pData = NULL;
+
+	while( NULL != pScan && OPERATE_TRUE != exec( pScan->item.pData, pRef ) )
+	{
+		pScan = LIST_ATOMIC_LOAD(&pScan->pNext);
+	}
+
+	pData = ( NULL == pScan ) ? NULL : pScan->item.pData;
+	OperateReadEnd(pList, slot);
+
+	return pData;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyFindIndexIf
+ * Description   : 读多写少模式版本的findindexif
+ * Input         : list_t* pList                                 
+                unsigned int(*exec)(const void*, const void*)  
+                const void* pRef                               
+ * Output        : None
+ * Return        : static
+ * Others        : 返回值与findindexif一致
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int ReadMostlyFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pScan = LIST_ATOMIC_LOAD(&pList->pHead);
+	unsigned int counter = ( NULL == pScan ) ? OPERATE_FAIL : OPERATE_INVALID;
+	unsigned int index = 0;
+
+	for( ; NULL != pScan; pScan = LIST_ATOMIC_LOAD(&pScan->pNext), index++ )
+	{
+		if( OPERATE_TRUE == exec( pScan->item.pData, pRef ) )
+		{
+			counter = index;
+			break;
+		}
+	}
+
+	OperateReadEnd(pList, slot);
+
+	return counter;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyForeach
+ * Description   : 读多写少模式版本的foreach
+ * Input         : list_t* pList       
+                void(*exec)(void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 整个遍历处于一个读临界区内，回调中不可调用写接口
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void ReadMostlyForeach(list_t* pList, void(*exec)(void*))
+{
+	unsigned int slot = OperateReadBegin(pList);
+	node_t* pScan = LIST_ATOMIC_LOAD(&pList->pHead);
+
+	for( ; NULL != pScan; pScan = LIST_ATOMIC_LOAD(&pScan->pNext) )
+	{
+		exec( pScan->item.pData );
+	}
+
+	OperateReadEnd(pList, slot);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlySize
+ * Description   : 读多写少模式版本的size
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int ReadMostlySize(list_t* pList)
+{
+	return LIST_ATOMIC_LOAD_RELAXED(&pList->Size);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyEmpty
+ * Description   : 读多写少模式版本的empty
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyEmpty(list_t* pList)
+{
+	return ( ( 0 == LIST_ATOMIC_LOAD_RELAXED(&pList->Size) ) ? 1 : 0 );
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyPushFront
+ * Description   : 读多写少模式版本的pushfront
+ * Input         : list_t* pList      
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyPushFront(list_t* pList, const void* pData)
+{
+	return ReadMostlyLink(pList, NULL, pData);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyPushBack
+ * Description   : 读多写少模式版本的pushback
+ * Input         : list_t* pList      
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyPushBack(list_t* pList, const void* pData)
+{
+	return ReadMostlyLink(pList, pList->pTail, pData);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyPopFront
+ * Description   : 读多写少模式版本的popfront
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyPopFront(list_t* pList)
+{
+	return ReadMostlyUnlink(pList, NULL);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyPopFrontCopy
+ * Description   : 读多写少模式版本的popfrontcopy
+ * Input         : list_t* pList  
+                void* pOut  
+ * Output        : None
+ * Return        : static
+ * Others        : 写接口，只有写者修改链接，拷贝时头节点不会被其他线程摘除
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyPopFrontCopy(list_t* pList, void* pOut)
+{
+	if( NULL == pList->pHead )
+	{
+		return OPERATE_FAIL;
+	}
+
+	memcpy(pOut, pList->pHead->item.pData, pList->CarryDataSize);
+
+	return ReadMostlyUnlink(pList, NULL);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyPopBack
+ * Description   : 读多写少模式版本的popback
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyPopBack(list_t* pList)
+{
+	if( 0 == pList->Size )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return ReadMostlyRemove(pList, pList->Size - 1);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyRemove
+ * Description   : 读多写少模式版本的remove
+ * Input         : list_t* pList       
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyRemove(list_t* pList, unsigned int index)
+{
+	if( pList->Size <= index )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return ReadMostlyUnlink(pList, ( 0 == index ) ? NULL : ReadMostlyLocate(pList, index - 1));
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyInsertAfter
+ * Description   : 读多写少模式版本的insertafter
+ * Input         : list_t* pList      
+                unsigned int index  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyInsertAfter(list_t* pList, unsigned int index, const void* pData)
+{
+	if( pList->Size <= index )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return ReadMostlyLink(pList, ReadMostlyLocate(pList, index), pData);
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyAssign
+ * Description   : 读多写少模式版本的assign
+ * Input         : list_t* pList      
+                unsigned int index  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 以新节点替换原节点，原节点延迟回收，读者看到的要么是旧值
+ 				   要么是新值
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyAssign(list_t* pList, unsigned int index, const void* pData)
+{
+	node_t* pPrev = NULL;
+	node_t* pScan = NULL;
+	node_t* pNewNode = NULL;
+
+	if( pList->Size <= index )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pNewNode = AllocNode(pList);
+
+	if( NULL == pNewNode )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pPrev = ( 0 == index ) ? NULL : ReadMostlyLocate(pList, index - 1);
+	pScan = ( NULL == pPrev ) ? pList->pHead : pPrev->pNext;
+	PackageData( pNewNode, pData, pList );
+	pNewNode->pNext = pScan->pNext;
+
+	if( NULL == pPrev )
+	{
+		LIST_ATOMIC_STORE(&pList->pHead, pNewNode);
+	}
+	else
+	{
+		LIST_ATOMIC_STORE(&pPrev->pNext, pNewNode);
+	}
+
+	if( pList->pTail == pScan )
+	{
+		LIST_ATOMIC_STORE(&pList->pTail, pNewNode);
+	}
+
+	RetireNode(pList, pScan);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyClear
+ * Description   : 读多写少模式版本的clear
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 先整体摘链再逐个延迟回收，完成后仍处于读多写少模式
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyClear(list_t* pList)
+{
+	node_t* pScan = pList->pHead;
+	node_t* pErase = NULL;
+
+	LIST_ATOMIC_STORE(&pList->pHead, (node_t*)NULL);
+	LIST_ATOMIC_STORE(&pList->pTail, (node_t*)NULL);
+	LIST_ATOMIC_STORE_RELAXED(&pList->Size, 0);
+
+	while( NULL != pScan )
+	{
+		pErase = pScan;
+		pScan = pScan->pNext;
+		RetireNode(pList, pErase);
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ReadMostlyDestroy
+ * Description   : 读多写少模式版本的destroy
+ * Input         : list_t** ppList  
+ * Output        : None
+ * Return        : static
+ * Others        : 须在没有读者时调用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ReadMostlyDestroy(list_t** ppList)
+{
+	if( NULL == *ppList )
+	{
+		return OPERATE_SUCC;
+	}
+
+	OperateSetReadMostly(*ppList, OPERATE_FALSE);
+
+	return OperateDestroy(ppList);
+}
+
+/*****************************************************************************
+ * Function      : BindReadMostlyOperations
+ * Description   : 内部实现接口，进入读多写少模式时替换操作接口
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 节点存储的其余写接口会直接改写链接并立即释放节点，其余读接口
+ 				   不以原子方式读取链接，都替换为直接返回失败的占位实现；
+ 				   insert/full经由已替换的接口实现，capacity/beforebegin不读取
+ 				   链表内容，无需替换
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void BindReadMostlyOperations(list_t* pList)
+{
+	pList->front = ReadMostlyFront;
+	pList->back = ReadMostlyBack;
+	pList->pushfront = ReadMostlyPushFront;
+	pList->pushback = ReadMostlyPushBack;
+	pList->popfront = ReadMostlyPopFront;
+	pList->popback = ReadMostlyPopBack;
+	pList->get = ReadMostlyGet;
+	pList->findif = ReadMostlyFindIf;
+	pList->findif2 = ReadMostlyFindIf2;
+	pList->findindexif = ReadMostlyFindIndexIf;
+	pList->remove = ReadMostlyRemove;
+	pList->assign = ReadMostlyAssign;
+	pList->insertafter = ReadMostlyInsertAfter;
+	pList->swap = RejectTwoIndices;
+	pList->sortif = RejectSortIf;
+	pList->sortbykey = RejectTwoIndices;
+	pList->parallelsortif = RejectParallelSortIf;
+	pList->size = ReadMostlySize;
+	pList->resize = RejectResize;
+	pList->empty = ReadMostlyEmpty;
+	pList->clear = ReadMostlyClear;
+	pList->destroy = ReadMostlyDestroy;
+	pList->foreach = ReadMostlyForeach;
+	pList->pushfrontn = RejectDataCount;
+	pList->pushbackn = RejectDataCount;
+	pList->insertrange = RejectInsertRange;
+	pList->toarray = RejectToArray;
+	pList->splice = RejectSplice;
+	pList->spliceafter = RejectSplice;
+	pList->concat = RejectConcat;
+	pList->begin = RejectIter;
+	pList->next = RejectIter;
+	pList->deref = RejectDeref;
+	pList->iterinsertafter = RejectIterInsertAfter;
+	pList->itereraseafter = RejectIter;
+	pList->removeif = RejectRemoveIf;
+	pList->findbykey = RejectFindByKey;
+	pList->foreach2 = RejectForeach2;
+	pList->foreachbatch = RejectForeachBatch;
+	pList->findifbatch = RejectFindIfBatch;
+	pList->parallelforeach = RejectParallelForeach;
+	pList->countif = RejectCountIf;
+	pList->findall = RejectFindAll;
+	pList->popfrontcopy = ReadMostlyPopFrontCopy;
+	pList->savelist = RejectFile;
+	pList->loadlist = RejectFile;
+	pList->flush = RejectList;
+	pList->compact = RejectList;
+	pList->locality = RejectLocality;
+}
+
+/*****************************************************************************
+ * Function      : SnapshotSum
+ * Description   : 内部实现接口，将一段负载累加到快照校验和
+ * Input         : snapshot_t* pSnapshot  
+                const char* pBytes  
+                unsigned int bytes  
+ * Output        : None
+ * Return        : static
+ * Others        : 按4字节字做Fletcher式双累加，末尾不足4字节时补0；除最后一段
+ 				   外调用者保证bytes为4的倍数，分段计算与整体计算结果相同
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void SnapshotSum(snapshot_t* pSnapshot, const char* pBytes, unsigned int bytes)
+{
+	unsigned long long sum1 = pSnapshot->Sum1;
+	unsigned long long sum2 = pSnapshot->Sum2;
+	unsigned int word = 0;
+	unsigned int offset = 0;
+
+	for( offset = 0; offset + sizeof(word) <= bytes; offset += sizeof(word) )
+	{
+		memcpy(&word, pBytes + offset, sizeof(word));
+		sum1 += word;
+		sum2 += sum1;
+	}
+
+	if( offset < bytes )
+	{
+		word = 0;
+		memcpy(&word, pBytes + offset, bytes - offset);
+		sum1 += word;
+		sum2 += sum1;
+	}
+
+	pSnapshot->Sum1 = sum1;
+	pSnapshot->Sum2 = sum2;
+}
+
+/*****************************************************************************
+ * Function      : SnapshotFlush
+ * Description   : 内部实现接口，将缓冲区中已收集的负载计入校验和并写出
+ * Input         : snapshot_t* pSnapshot  
+ * Output        : None
+ * Return        : static
+ * Others        : 写失败时置位Failed
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void SnapshotFlush(snapshot_t* pSnapshot)
+{
+	unsigned int bytes = pSnapshot->Count * pSnapshot->CarryDataSize;
+
+	SnapshotSum(pSnapshot, pSnapshot->pBuffer, bytes);
+
+	if( 0 != bytes && 1 != fwrite(pSnapshot->pBuffer, bytes, 1, pSnapshot->pStream) )
+	{
+		pSnapshot->Failed = OPERATE_TRUE;
+	}
+
+	pSnapshot->Count = 0;
+}
+
+/*****************************************************************************
+ * Function      : SnapshotCollect
+ * Description   : 内部实现接口，foreachbatch回调，将一批元素拷贝到写缓冲区
+ * Input         : void** ppItems  
+                unsigned int count  
+                void* pContext  snapshot_t*
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void SnapshotCollect(void** ppItems, unsigned int count, void* pContext)
+{
+	snapshot_t* pSnapshot = (snapshot_t*)pContext;
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		memcpy(pSnapshot->pBuffer + pSnapshot->Count * pSnapshot->CarryDataSize, ppItems[counter], pSnapshot->CarryDataSize);
+
+		if( ++pSnapshot->Count == pSnapshot->Capacity )
+		{
+			SnapshotFlush(pSnapshot);
+		}
+	}
+}
+
+/*****************************************************************************
+ * Function      : SnapshotBegin
+ * Description   : 内部实现接口，为快照读写分配缓冲区并初始化上下文
+ * Input         : list_t* pList  
+                snapshot_t* pSnapshot  
+                FILE* pStream  
+ * Output        : None
+ * Return        : static
+ * Others        : 缓冲区约LIST_SNAPSHOT_BUFFER字节，容纳的元素个数取4的倍数，
+ 				   使每个满缓冲区的字节数都是4的倍数
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int SnapshotBegin(list_t* pList, snapshot_t* pSnapshot, FILE* pStream)
+{
+	unsigned int capacity = LIST_SNAPSHOT_BUFFER / ( ( 0 == pList->CarryDataSize ) ? 1 : pList->CarryDataSize );
+
+	capacity -= capacity % 4;
+	pSnapshot->Capacity = ( 0 == capacity ) ? 4 : capacity;
+	pSnapshot->pStream = pStream;
+	pSnapshot->CarryDataSize = pList->CarryDataSize;
+	pSnapshot->Count = 0;
+	pSnapshot->Sum1 = 0;
+	pSnapshot->Sum2 = 0;
+	pSnapshot->Failed = OPERATE_FALSE;
+	pSnapshot->pBuffer = (char*)pList->Allocator.alloc(pList->Allocator.pContext,
+		pSnapshot->Capacity * pList->CarryDataSize + 1);
+
+	return ( NULL == pSnapshot->pBuffer ) ? OPERATE_FAIL : OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateSaveList
+ * Description   : 将链表容器写为二进制快照
+ * Input         : list_t* pList  
+                FILE* pStream  以二进制方式打开
+ * Output        : None
+ * Return        : static
+ * Others        : 格式为snapshot_header_t、Size个紧密排列的用户数据、8字节
+ 				   校验和，均为本机字节序；数据经约LIST_SNAPSHOT_BUFFER字节的
+ 				   缓冲区成块写出；并发栈模式与读多写少模式下不可用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateSaveList(list_t* pList, FILE* pStream)
+{
+	snapshot_header_t header;
+	snapshot_t snapshot;
+	unsigned long long checksum = 0;
+
+	if( NULL == pStream || OPERATE_FAIL == SnapshotBegin(pList, &snapshot, pStream) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	header.Magic = LIST_SNAPSHOT_MAGIC;
+	header.Version = LIST_SNAPSHOT_VERSION;
+	header.CarryDataSize = pList->CarryDataSize;
+	header.Size = pList->Size;
+	header.MaxSize = pList->MaxSize;
+	header.Reserved = 0;
+
+	if( 1 != fwrite(&header, sizeof(header), 1, pStream) )
+	{
+		snapshot.Failed = OPERATE_TRUE;
+	}
+	else
+	{
+		pList->foreachbatch(pList, SnapshotCollect, &snapshot);
+		SnapshotFlush(&snapshot);
+	}
+
+	checksum = ( snapshot.Sum2 << 32 ) ^ snapshot.Sum1;
+
+	if( OPERATE_FALSE == snapshot.Failed && 1 != fwrite(&checksum, sizeof(checksum), 1, pStream) )
+	{
+		snapshot.Failed = OPERATE_TRUE;
+	}
+
+	pList->Allocator.release(pList->Allocator.pContext, snapshot.pBuffer);
+
+	return ( OPERATE_TRUE == snapshot.Failed || 0 != fflush(pStream) ) ? OPERATE_FAIL : OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : DescribeListAttr
+ * Description   : 内部实现接口，生成与链表容器配置相同的属性，用于创建同样
+ 				   配置的空链表容器
+ * Input         : list_t* pList  
+                list_attr_t* pAttr  
+ * Output        : None
+ * Return        : static
+ * Others        : 分配器指向pList中保存的副本；持久化链表对应不带索引与内存池
+ 				   的节点存储
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void DescribeListAttr(list_t* pList, list_attr_t* pAttr)
+{
+	memset(pAttr, 0, sizeof(list_attr_t));
+	pAttr->pAllocator = &pList->Allocator;
+
+	if( LIST_STORAGE_PERSIST == pList->Storage )
+	{
+		return;
+	}
+
+	pAttr->Storage = pList->Storage;
+	pAttr->BlockItems = pList->BlockItems;
+	pAttr->PoolNodesPerSlab = ( NULL != pList->pPool ) ? pList->pPool->NodesPerSlab : 0;
+	pAttr->SkipIndex = ( NULL != pList->pSkipHeader ) ? 1 : 0;
+	pAttr->CursorCache = ( OPERATE_TRUE == pList->CursorCache ) ? 1 : 0;
+
+	if( NULL != pList->pHash )
+	{
+		pAttr->HashIndex = 1;
+		pAttr->HashKeyOffset = pList->pHash->KeyOffset;
+		pAttr->HashKeyWidth = pList->pHash->KeyWidth;
+		pAttr->hash = pList->pHash->hash;
+		pAttr->keyequal = pList->pHash->keyequal;
+	}
+}
+
+/*****************************************************************************
+ * Function      : SwapListContents
+ * Description   : 内部实现接口，交换两个配置相同的链表容器的全部内容
+ * Input         : list_t* pList  
+                list_t* pOther  由DescribeListAttr得到的属性创建
+ * Output        : None
+ * Return        : static
+ * Others        : 节点、块、内存池、索引、游标与分段缓存等随内容一同交换，
+ 				   线程池仍属于原来的容器；两者都不能处于并发栈或读多写少
+ 				   模式，也不能是持久化链表
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void SwapListContents(list_t* pList, list_t* pOther)
+{
+	list_t temp = *pList;
+	struct worker_pool* pWorkers = pList->pWorkers;
+
+	*pList = *pOther;
+	*pOther = temp;
+	pOther->pWorkers = pList->pWorkers;
+	pList->pWorkers = pWorkers;
+}
+
+/*****************************************************************************
+ * Function      : OperateLoadList
+ * Description   : 用savelist写出的快照替换链表容器的全部内容
+ * Input         : list_t* pList  
+                FILE* pStream  以二进制方式打开
+ * Output        : None
+ * Return        : static
+ * Others        : 快照的CarryDataSize须与链表容器一致，容量恢复为快照中的
+ 				   MaxSize；数据成块读入后经pushbackn整段链接到一个配置相同的
+ 				   新链表容器中，校验和通过后才与本容器交换内容，格式、长度
+ 				   或校验和不符以及内存不足时返回OPERATE_FAIL，链表容器的内容
+ 				   与容量保持不变；持久化链表先读入内存中的链表容器并校验，
+ 				   通过后再清空并逐个写入文件，写入期间崩溃只保留一部分元素；
+ 				   并发栈模式与读多写少模式下不可用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 在另一个容器中读入并校验后再替换，失败时保留原内容
+*****************************************************************************/
+static int OperateLoadList(list_t* pList, FILE* pStream)
+{
+	snapshot_header_t header;
+	snapshot_t snapshot;
+	list_attr_t attr;
+	list_t* pSide = NULL;
+	node_t* pScan = NULL;
+	unsigned long long checksum = 0;
+	unsigned int left = 0;
+	unsigned int count = 0;
+
+	if( NULL == pStream || 1 != fread(&header, sizeof(header), 1, pStream)
+		|| LIST_SNAPSHOT_MAGIC != header.Magic || LIST_SNAPSHOT_VERSION != header.Version
+		|| pList->CarryDataSize != header.CarryDataSize || header.Size > header.MaxSize )
+	{
+		return OPERATE_FAIL;
+	}
+
+	DescribeListAttr(pList, &attr);
+	pSide = CreateListEx(header.MaxSize, pList->CarryDataSize, &attr);
+
+	if( NULL == pSide )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( OPERATE_FAIL == SnapshotBegin(pList, &snapshot, pStream) )
+	{
+		pSide->destroy(&pSide);
+		return OPERATE_FAIL;
+	}
+
+	for( left = header.Size; 0 != left && OPERATE_FALSE == snapshot.Failed; left -= count )
+	{
+		count = ( left < snapshot.Capacity ) ? left : snapshot.Capacity;
+
+		if( 0 != pList->CarryDataSize && 1 != fread(snapshot.pBuffer, count * pList->CarryDataSize, 1, pStream) )
+		{
+			snapshot.Failed = OPERATE_TRUE;
+			break;
+		}
+
+		SnapshotSum(&snapshot, snapshot.pBuffer, count * pList->CarryDataSize);
+
+		if( OPERATE_FAIL == pSide->pushbackn(pSide, snapshot.pBuffer, count) )
+		{
+			snapshot.Failed = OPERATE_TRUE;
+		}
+	}
+
+	if( OPERATE_FALSE == snapshot.Failed
+		&& ( 1 != fread(&checksum, sizeof(checksum), 1, pStream)
+		|| ( ( snapshot.Sum2 << 32 ) ^ snapshot.Sum1 ) != checksum ) )
+	{
+		snapshot.Failed = OPERATE_TRUE;
+	}
+
+	pList->Allocator.release(pList->Allocator.pContext, snapshot.pBuffer);
+
+	if( OPERATE_FALSE == snapshot.Failed && LIST_STORAGE_PERSIST == pList->Storage )
+	{
+		pList->clear(pList);
+		pList->MaxSize = header.MaxSize;
+
+		for( pScan = pSide->pHead; NULL != pScan && OPERATE_FALSE == snapshot.Failed; pScan = pScan->pNext )
+		{
+			snapshot.Failed = ( OPERATE_FAIL == pList->pushback(pList, pScan->item.pData) );
+		}
+	}
+	else if( OPERATE_FALSE == snapshot.Failed )
+	{
+		SwapListContents(pList, pSide);
+	}
+
+	pSide->destroy(&pSide);
+
+	return ( OPERATE_TRUE == snapshot.Failed ) ? OPERATE_FAIL : OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : OperateFlush
+ * Description   : 将链表容器的修改持久化
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 内存中的链表容器没有需要持久化的内容，直接返回成功；
+ 				   持久化链表的实现见PersistFlush
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateFlush(list_t* pList)
+{
+	(void)pList;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistHeader
+ * Description   : 内部实现接口，返回映射文件的文件头
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 文件扩展后映射地址会改变，调用PersistNewNode后须重新获取
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static persist_header_t* PersistHeader(list_t* pList)
+{
+	return (persist_header_t*)pList->pPersist->pBase;
+}
+
+/*****************************************************************************
+ * Function      : PersistNode
+ * Description   : 内部实现接口，将文件内偏移量转换为节点地址
+ * Input         : list_t* pList  
+                unsigned long long offset  不为0
+ * Output        : None
+ * Return        : static
+ * Others        : 同PersistHeader，地址仅在下一次分配节点之前有效
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static persist_node_t* PersistNode(list_t* pList, unsigned long long offset)
+{
+	return (persist_node_t*)( pList->pPersist->pBase + offset );
+}
+
+/*****************************************************************************
+ * Function      : PersistItem
+ * Description   : 内部实现接口，返回偏移量处节点的用户数据地址
+ * Input         : list_t* pList  
+                unsigned long long offset  不为0
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static char* PersistItem(list_t* pList, unsigned long long offset)
+{
+	return pList->pPersist->pBase + offset + sizeof(persist_node_t);
+}
+
+/*****************************************************************************
+ * Function      : PersistLink
+ * Description   : 内部实现接口，返回指向偏移量处节点之后节点的链接
+ * Input         : list_t* pList  
+                unsigned long long prev  为0时返回头链接
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned long long* PersistLink(list_t* pList, unsigned long long prev)
+{
+	return ( 0 == prev ) ? &PersistHeader(pList)->Head : &PersistNode(pList, prev)->Next;
+}
+
+/*****************************************************************************
+ * Function      : PersistMarkDirty
+ * Description   : 内部实现接口，修改映射文件前将其标记为dirty
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 每个flush周期只在第一次修改时同步写回一次文件头，保证
+ 				   掉电后不会出现数据已修改而文件头仍为clean的情况
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistMarkDirty(list_t* pList)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+
+	if( 0 != pHeader->Dirty )
+	{
+		return;
+	}
+
+	pHeader->Dirty = 1;
+#if LIST_USE_MMAP
+	msync(pHeader, sizeof(persist_header_t), MS_SYNC);
+#endif
+}
+
+/*****************************************************************************
+ * Function      : PersistMapFile
+ * Description   : 内部实现接口，打开(不存在时创建)文件并整体映射到内存
+ * Input         : persist_t* pPersist  
+                const char* pPath  
+                int* pCreated  返回文件是否为新建(原本为空)
+ * Output        : None
+ * Return        : static
+ * Others        : 打开后先以flock对文件加非阻塞的排他锁，已被其他链表打开时
+ 				   返回失败，锁随PersistUnmap关闭文件而释放；只有空文件才扩展
+ 				   到LIST_PERSIST_INITIAL_SIZE并视为新建，非空文件须以
+ 				   LIST_PERSIST_MAGIC开头，否则不做任何修改直接返回失败；
+ 				   未启用LIST_USE_MMAP时返回失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 加排他锁，只扩展空文件，映射前校验文件头
+*****************************************************************************/
+static int PersistMapFile(persist_t* pPersist, const char* pPath, int* pCreated)
+{
+#if LIST_USE_MMAP
+	struct stat info;
+	unsigned int magic = 0;
+	int fd = open(pPath, O_RDWR | O_CREAT, 0644);
+
+	if( 0 > fd )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 != flock(fd, LOCK_EX | LOCK_NB) || 0 != fstat(fd, &info) )
+	{
+		close(fd);
+		return OPERATE_FAIL;
+	}
+
+	*pCreated = ( 0 == info.st_size ) ? OPERATE_TRUE : OPERATE_FALSE;
+
+	if( *pCreated )
+	{
+		if( 0 != ftruncate(fd, LIST_PERSIST_INITIAL_SIZE) )
+		{
+			close(fd);
+			return OPERATE_FAIL;
+		}
+
+		info.st_size = LIST_PERSIST_INITIAL_SIZE;
+	}
+	else if( (off_t)sizeof(persist_header_t) > info.st_size
+		|| (ssize_t)sizeof(magic) != pread(fd, &magic, sizeof(magic), 0) || LIST_PERSIST_MAGIC != magic )
+	{
+		close(fd);
+		return OPERATE_FAIL;
+	}
+
+	pPersist->Fd = fd;
+	pPersist->MapSize = (unsigned long long)info.st_size;
+	pPersist->pBase = (char*)mmap(NULL, (size_t)pPersist->MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	if( MAP_FAILED == (void*)pPersist->pBase )
+	{
+		close(fd);
+		return OPERATE_FAIL;
+	}
+
+	return OPERATE_SUCC;
+#else
+	(void)pPersist;
+	(void)pPath;
+	(void)pCreated;
+
+	return OPERATE_FAIL;
+#endif
+}
+
+/*****************************************************************************
+ * Function      : PersistGrow
+ * Description   : 内部实现接口，将映射文件扩大一倍并重新映射
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 先映射新的区域再解除旧的映射，失败时原映射保持不变；
+ 				   成功后所有由偏移量转换得到的地址失效
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistGrow(list_t* pList)
+{
+#if LIST_USE_MMAP
+	persist_t* pPersist = pList->pPersist;
+	unsigned long long size = pPersist->MapSize * 2;
+	char* pBase = NULL;
+
+	if( size < pPersist->MapSize || (unsigned long long)(size_t)size != size || (unsigned long long)(off_t)size != size )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 != ftruncate(pPersist->Fd, (off_t)size) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pBase = (char*)mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, pPersist->Fd, 0);
+
+	if( MAP_FAILED == (void*)pBase )
+	{
+		return OPERATE_FAIL;
+	}
+
+	munmap(pPersist->pBase, (size_t)pPersist->MapSize);
+	pPersist->pBase = pBase;
+	pPersist->MapSize = size;
+	PersistHeader(pList)->FileSize = size;
+
+	return OPERATE_SUCC;
+#else
+	(void)pList;
+
+	return OPERATE_FAIL;
+#endif
+}
+
+/*****************************************************************************
+ * Function      : PersistNewNode
+ * Description   : 内部实现接口，从文件内的节点池分配节点并拷贝用户数据
+ * Input         : list_t* pList  
+                const void* pData  可以指向本链表的元素
+ * Output        : None
+ * Return        : static
+ * Others        : 优先复用空闲链表中的节点，否则从未使用区域切分，空间不足时
+ 				   扩展文件；返回节点偏移量，next为0，尚未链接到链表；失败
+ 				   返回0
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned long long PersistNewNode(list_t* pList, const void* pData)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+	const char* pSource = (const char*)pData;
+	unsigned long long inside = 0;
+	unsigned long long offset = 0;
+
+	if( pSource >= pList->pPersist->pBase && pSource < pList->pPersist->pBase + pList->pPersist->MapSize )
+	{
+		inside = (unsigned long long)( pSource - pList->pPersist->pBase );
+	}
+
+	PersistMarkDirty(pList);
+
+	if( 0 != pHeader->Free )
+	{
+		offset = pHeader->Free;
+		pHeader->Free = PersistNode(pList, offset)->Next;
+	}
+	else
+	{
+		while( pHeader->Bump + pHeader->NodeSize > pList->pPersist->MapSize )
+		{
+			if( OPERATE_FAIL == PersistGrow(pList) )
+			{
+				return 0;
+			}
+
+			pHeader = PersistHeader(pList);
+		}
+
+		offset = pHeader->Bump;
+		pHeader->Bump += pHeader->NodeSize;
+	}
+
+	if( 0 != inside )
+	{
+		pSource = pList->pPersist->pBase + inside;
+	}
+
+	memcpy(PersistItem(pList, offset), pSource, pList->CarryDataSize);
+	PersistNode(pList, offset)->Next = 0;
+
+	return offset;
+}
+
+/*****************************************************************************
+ * Function      : PersistFreeChain
+ * Description   : 内部实现接口，将first到last的一串节点放回文件内的空闲链表
+ * Input         : list_t* pList  
+                unsigned long long first  
+                unsigned long long last  
+ * Output        : None
+ * Return        : static
+ * Others        : 节点须已不在链表中；空闲链表无需崩溃一致，恢复时会重建
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistFreeChain(list_t* pList, unsigned long long first, unsigned long long last)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+	unsigned long long next = 0;
+
+	while( 0 != first )
+	{
+		next = ( first == last ) ? 0 : PersistNode(pList, first)->Next;
+		PersistNode(pList, first)->Next = pHeader->Free;
+		pHeader->Free = first;
+		first = next;
+	}
+}
+
+/*****************************************************************************
+ * Function      : PersistLocate
+ * Description   : 内部实现接口，返回第index个节点的偏移量
+ * Input         : list_t* pList  
+                unsigned int index  小于size
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned long long PersistLocate(list_t* pList, unsigned int index)
+{
+	unsigned long long offset = PersistHeader(pList)->Head;
+
+	for( ; 0 < index; index-- )
+	{
+		offset = PersistNode(pList, offset)->Next;
+	}
+
+	return offset;
+}
+
+/*****************************************************************************
+ * Function      : PersistLinkChain
+ * Description   : 内部实现接口，将first到last的一串新节点链接到prev节点之后
+ * Input         : list_t* pList  
+                unsigned long long prev  为0时链接到表头
+                unsigned long long first  
+                unsigned long long last  
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 写入prev的链接是唯一的发布点，之前崩溃时新节点只是泄漏，
+ 				   恢复时回收
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistLinkChain(list_t* pList, unsigned long long prev, unsigned long long first, unsigned long long last, unsigned int count)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+	unsigned long long* pLink = PersistLink(pList, prev);
+
+	PersistMarkDirty(pList);
+	PersistNode(pList, last)->Next = *pLink;
+	LIST_ATOMIC_STORE(pLink, first);
+
+	if( 0 == PersistNode(pList, last)->Next )
+	{
+		pHeader->Tail = last;
+	}
+
+	pHeader->Size += count;
+	pList->Size = pHeader->Size;
+	pList->Revision++;
+}
+
+/*****************************************************************************
+ * Function      : PersistUnlink
+ * Description   : 内部实现接口，删除prev节点之后的节点
+ * Input         : list_t* pList  
+                unsigned long long prev  为0时删除第一个节点
+ * Output        : None
+ * Return        : static
+ * Others        : 写入prev的链接是唯一的发布点
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistUnlink(list_t* pList, unsigned long long prev)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+	unsigned long long* pLink = PersistLink(pList, prev);
+	unsigned long long erase = *pLink;
+
+	if( 0 == erase )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PersistMarkDirty(pList);
+	LIST_ATOMIC_STORE(pLink, PersistNode(pList, erase)->Next);
+
+	if( pHeader->Tail == erase )
+	{
+		pHeader->Tail = prev;
+	}
+
+	pHeader->Size--;
+	pList->Size = pHeader->Size;
+	pList->Revision++;
+	PersistFreeChain(pList, erase, erase);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistReplace
+ * Description   : 内部实现接口，用新的一串节点替换prev节点之后从oldFirst到
+ 				   oldLast的一串节点，两者个数相同
+ * Input         : list_t* pList  
+                unsigned long long prev  为0时从表头开始替换
+                unsigned long long oldFirst  
+                unsigned long long oldLast  
+                unsigned long long newFirst  
+                unsigned long long newLast  
+ * Output        : None
+ * Return        : static
+ * Others        : 写入prev的链接是唯一的发布点，崩溃后链表要么是替换前的
+ 				   内容，要么是替换后的内容；旧节点在发布之后回收
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistReplace(list_t* pList, unsigned long long prev, unsigned long long oldFirst, unsigned long long oldLast,
+	unsigned long long newFirst, unsigned long long newLast)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+
+	PersistMarkDirty(pList);
+	PersistNode(pList, newLast)->Next = PersistNode(pList, oldLast)->Next;
+	LIST_ATOMIC_STORE(PersistLink(pList, prev), newFirst);
+
+	if( pHeader->Tail == oldLast )
+	{
+		pHeader->Tail = newLast;
+	}
+
+	pList->Revision++;
+	PersistFreeChain(pList, oldFirst, oldLast);
+}
+
+/*****************************************************************************
+ * Function      : PersistRecover
+ * Description   : 内部实现接口，打开未正常flush的映射文件时重建派生信息
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 从头链接开始遍历，检查每个偏移量是否在已分配区域内、是否
+ 				   对齐到节点以及是否成环，据此重新计算Size与尾节点，并把
+ 				   所有不可达的节点重建为空闲链表；链接无效时返回失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistRecover(list_t* pList)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+	unsigned long long slots = ( pHeader->Bump - LIST_PERSIST_DATA_START ) / pHeader->NodeSize;
+	unsigned long long offset = pHeader->Head;
+	unsigned long long prev = 0;
+	unsigned long long slot = 0;
+	unsigned int count = 0;
+	unsigned char* pReached = NULL;
+
+	if( slots / 8 + 1 > (size_t)-1 )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pReached = (unsigned char*)pList->Allocator.alloc(pList->Allocator.pContext, (size_t)( slots / 8 + 1 ));
+
+	if( NULL == pReached )
+	{
+		return OPERATE_FAIL;
+	}
+
+	memset(pReached, 0, (size_t)( slots / 8 + 1 ));
+
+	while( 0 != offset )
+	{
+		slot = ( offset - LIST_PERSIST_DATA_START ) / pHeader->NodeSize;
+
+		if( LIST_PERSIST_DATA_START > offset || pHeader->Bump <= offset
+			|| 0 != ( offset - LIST_PERSIST_DATA_START ) % pHeader->NodeSize
+			|| 0 != ( pReached[slot / 8] & ( 1U << ( slot % 8 ) ) ) )
+		{
+			pList->Allocator.release(pList->Allocator.pContext, pReached);
+			return OPERATE_FAIL;
+		}
+
+		pReached[slot / 8] |= (unsigned char)( 1U << ( slot % 8 ) );
+		prev = offset;
+		count++;
+		offset = PersistNode(pList, offset)->Next;
+	}
+
+	pHeader->Tail = prev;
+	pHeader->Size = count;
+	pHeader->Free = 0;
+
+	for( slot = slots; 0 < slot; slot-- )
+	{
+		if( 0 == ( pReached[( slot - 1 ) / 8] & ( 1U << ( ( slot - 1 ) % 8 ) ) ) )
+		{
+			offset = LIST_PERSIST_DATA_START + ( slot - 1 ) * pHeader->NodeSize;
+			PersistNode(pList, offset)->Next = pHeader->Free;
+			pHeader->Free = offset;
+		}
+	}
+
+	pList->Allocator.release(pList->Allocator.pContext, pReached);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistUnmap
+ * Description   : 内部实现接口，解除映射并关闭文件，不做持久化
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistUnmap(list_t* pList)
+{
+	persist_t* pPersist = pList->pPersist;
+
+	if( NULL == pPersist )
+	{
+		return;
+	}
+
+#if LIST_USE_MMAP
+	munmap(pPersist->pBase, (size_t)pPersist->MapSize);
+	close(pPersist->Fd);
+#endif
+	pList->Allocator.release(pList->Allocator.pContext, pPersist);
+	pList->pPersist = NULL;
+	pList->Size = 0;
+}
+
+/*****************************************************************************
+ * Function      : PersistFlush
+ * Description   : 持久化链表的flush，将映射区域同步写回文件并标记为clean
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 先同步全部数据，再清除dirty并同步文件头，之后到下一次修改
+ 				   前掉电不丢数据，重新打开无需恢复
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistFlush(list_t* pList)
+{
+#if LIST_USE_MMAP
+	persist_header_t* pHeader = PersistHeader(pList);
+
+	if( pHeader->MaxSize != pList->MaxSize )
+	{
+		PersistMarkDirty(pList);
+		pHeader->MaxSize = pList->MaxSize;
+	}
+
+	if( 0 == pHeader->Dirty )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( 0 != msync(pList->pPersist->pBase, (size_t)pList->pPersist->MapSize, MS_SYNC) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pHeader->Dirty = 0;
+
+	return ( ( 0 == msync(pHeader, sizeof(persist_header_t), MS_SYNC) ) ? OPERATE_SUCC : OPERATE_FAIL );
+#else
+	(void)pList;
+
+	return OPERATE_FAIL;
+#endif
+}
+
+/*****************************************************************************
+ * Function      : PersistFront
+ * Description   : 持久化链表的front
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 返回的地址在下一次插入元素之前有效(文件扩展会重新映射)，
+ 				   其他返回用户数据地址的接口相同
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* PersistFront(list_t* pList)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+
+	return ( ( 0 == pHeader->Head ) ? NULL : PersistItem(pList, pHeader->Head) );
+}
+
+/*****************************************************************************
+ * Function      : PersistBack
+ * Description   : 持久化链表的back
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* PersistBack(list_t* pList)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+
+	return ( ( 0 == pHeader->Head ) ? NULL : PersistItem(pList, pHeader->Tail) );
+}
+
+/*****************************************************************************
+ * Function      : PersistPushFront
+ * Description   : 持久化链表的pushfront
+ * Input         : list_t* pList  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistPushFront(list_t* pList, const void* pData)
+{
+	unsigned long long offset = 0;
+
+	if( pList->full(pList) || 0 == ( offset = PersistNewNode(pList, pData) ) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PersistLinkChain(pList, 0, offset, offset, 1);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistPushBack
+ * Description   : 持久化链表的pushback
+ * Input         : list_t* pList  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistPushBack(list_t* pList, const void* pData)
+{
+	unsigned long long offset = 0;
+
+	if( pList->full(pList) || 0 == ( offset = PersistNewNode(pList, pData) ) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PersistLinkChain(pList, PersistHeader(pList)->Tail, offset, offset, 1);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistPopFront
+ * Description   : 持久化链表的popfront
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistPopFront(list_t* pList)
+{
+	return PersistUnlink(pList, 0);
+}
+
+/*****************************************************************************
+ * Function      : PersistPopBack
+ * Description   : 持久化链表的popback
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 时间复杂度为O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistPopBack(list_t* pList)
+{
+	if( pList->empty(pList) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return PersistUnlink(pList, ( 1 < pList->Size ) ? PersistLocate(pList, pList->Size - 2) : 0);
+}
+
+/*****************************************************************************
+ * Function      : PersistGet
+ * Description   : 持久化链表的get
+ * Input         : list_t* pList  
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* PersistGet(list_t* pList, unsigned int index)
+{
+	if( pList->Size <= index )
+	{
+		return NULL;
+	}
+
+	return PersistItem(pList, PersistLocate(pList, index));
+}
+
+/*****************************************************************************
+ * Function      : PersistFindIf
+ * Description   : 持久化链表的findif
+ * Input         : list_t* pList  
+                unsigned int(*exec)(const void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* PersistFindIf(list_t* pList, unsigned int(*exec)(const void*))
+{
+	unsigned long long offset = PersistHeader(pList)->Head;
+
+	for( ; 0 != offset; offset = PersistNode(pList, offset)->Next )
+	{
+		if( OPERATE_TRUE == exec( PersistItem(pList, offset) ) )
+		{
+			return PersistItem(pList, offset);
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : PersistFindIf2
+ * Description   : 持久化链表的findif2
+ * Input         : list_t* pList  
+                unsigned int(*exec)(const void*, const void*)  
+                const void* pRef  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* PersistFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	unsigned long long offset = PersistHeader(pList)->Head;
+
+	for( ; 0 != offset; offset = PersistNode(pList, offset)->Next )
+	{
+		if( OPERATE_TRUE == exec( PersistItem(pList, offset), pRef ) )
+		{
+			return PersistItem(pList, offset);
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : PersistFindIndexIf
+ * Description   : 持久化链表的findindexif
+ * Input         : list_t* pList  
+                unsigned int(*exec)(const void*, const void*)  
+                const void* pRef  
+ * Output        : None
+ * Return        : static
+ * Others        : 与节点存储相同，链表为空时返回OPERATE_FAIL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int PersistFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	unsigned long long offset = PersistHeader(pList)->Head;
+	unsigned int counter = 0;
+
+	if( pList->empty(pList) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	for( ; 0 != offset; offset = PersistNode(pList, offset)->Next, counter++ )
+	{
+		if( OPERATE_TRUE == exec( PersistItem(pList, offset), pRef ) )
+		{
+			return counter;
+		}
+	}
+
+	return OPERATE_INVALID;
+}
+
+/*****************************************************************************
+ * Function      : PersistRemove
+ * Description   : 持久化链表的remove
+ * Input         : list_t* pList  
+                unsigned int index  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistRemove(list_t* pList, unsigned int index)
+{
+	if( pList->Size <= index )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return PersistUnlink(pList, ( 0 < index ) ? PersistLocate(pList, index - 1) : 0);
+}
+
+/*****************************************************************************
+ * Function      : PersistAssign
+ * Description   : 持久化链表的assign
+ * Input         : list_t* pList  
+                unsigned int index  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 写入新节点后替换原节点，崩溃时不会留下写了一半的数据；
+ 				   原地址的用户数据不再属于链表
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistAssign(list_t* pList, unsigned int index, const void* pData)
+{
+	unsigned long long offset = 0;
+	unsigned long long prev = 0;
+	unsigned long long old = 0;
+
+	if( pList->Size <= index || 0 == ( offset = PersistNewNode(pList, pData) ) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	prev = ( 0 < index ) ? PersistLocate(pList, index - 1) : 0;
+	old = *PersistLink(pList, prev);
+	PersistReplace(pList, prev, old, old, offset, offset);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistInsertAfter
+ * Description   : 持久化链表的insertafter
+ * Input         : list_t* pList  
+                unsigned int index  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistInsertAfter(list_t* pList, unsigned int index, const void* pData)
+{
+	unsigned long long offset = 0;
+
+	if( pList->full(pList) || pList->Size <= index || 0 == ( offset = PersistNewNode(pList, pData) ) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PersistLinkChain(pList, PersistLocate(pList, index), offset, offset, 1);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistSwap
+ * Description   : 持久化链表的swap
+ * Input         : list_t* pList  
+                unsigned int index1  
+                unsigned int index2  
+ * Output        : None
+ * Return        : static
+ * Others        : 复制两个位置之间(含)的一段并交换首尾数据后一次替换，
+ 				   崩溃时不会只交换了一半；时间与临时空间为O(|index1-index2|)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistSwap(list_t* pList, unsigned int index1, unsigned int index2)
+{
+	unsigned int low = ( index1 < index2 ) ? index1 : index2;
+	unsigned int span = ( index1 < index2 ) ? index2 - index1 : index1 - index2;
+	unsigned long long prev = 0;
+	unsigned long long oldFirst = 0;
+	unsigned long long oldLast = 0;
+	unsigned long long scan = 0;
+	unsigned long long source = 0;
+	unsigned long long first = 0;
+	unsigned long long last = 0;
+	unsigned long long offset = 0;
+	unsigned int counter = 0;
+
+	if( 0 == span || pList->Size <= index1 || pList->Size <= index2 )
+	{
+		return OPERATE_FAIL;
+	}
+
+	prev = ( 0 < low ) ? PersistLocate(pList, low - 1) : 0;
+	oldFirst = *PersistLink(pList, prev);
+
+	for( oldLast = oldFirst, counter = 0; counter < span; counter++ )
+	{
+		oldLast = PersistNode(pList, oldLast)->Next;
+	}
+
+	for( scan = oldFirst, counter = 0; counter <= span; counter++ )
+	{
+		source = ( 0 == counter ) ? oldLast : ( ( span == counter ) ? oldFirst : scan );
+		offset = PersistNewNode(pList, PersistItem(pList, source));
+
+		if( 0 == offset )
+		{
+			PersistFreeChain(pList, first, last);
+			return OPERATE_FAIL;
+		}
+
+		if( 0 == first )
+		{
+			first = offset;
+		}
+		else
+		{
+			PersistNode(pList, last)->Next = offset;
+		}
+
+		last = offset;
+		scan = PersistNode(pList, scan)->Next;
+	}
+
+	PersistReplace(pList, prev, oldFirst, oldLast, first, last);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistCopyOut
+ * Description   : 内部实现接口，将持久化链表的数据复制到内存中的链表容器
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 供排序使用，失败返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static list_t* PersistCopyOut(list_t* pList)
+{
+	list_t* pCopy = NULL;
+	list_attr_t attr;
+	unsigned long long offset = PersistHeader(pList)->Head;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &pList->Allocator;
+	pCopy = CreateListEx(pList->Size, pList->CarryDataSize, &attr);
+
+	if( NULL == pCopy )
+	{
+		return NULL;
+	}
+
+	for( ; 0 != offset; offset = PersistNode(pList, offset)->Next )
+	{
+		if( OPERATE_FAIL == pCopy->pushback(pCopy, PersistItem(pList, offset)) )
+		{
+			pCopy->destroy(&pCopy);
+			return NULL;
+		}
+	}
+
+	return pCopy;
+}
+
+/*****************************************************************************
+ * Function      : PersistRebuild
+ * Description   : 内部实现接口，按pSorted的顺序重建持久化链表
+ * Input         : list_t* pList  
+                list_t* pSorted  与pList元素个数相同
+ * Output        : None
+ * Return        : static
+ * Others        : 在文件中建好完整的新链后一次替换全部节点，崩溃时链表为
+ 				   排序前或排序后的内容；期间文件需要约两倍的节点空间
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistRebuild(list_t* pList, list_t* pSorted)
+{
+	node_t* pScan = pSorted->pHead;
+	unsigned long long first = 0;
+	unsigned long long last = 0;
+	unsigned long long offset = 0;
+
+	if( 0 == pList->Size )
+	{
+		return OPERATE_SUCC;
+	}
+
+	for( ; NULL != pScan; pScan = pScan->pNext )
+	{
+		offset = PersistNewNode(pList, pScan->item.pData);
+
+		if( 0 == offset )
+		{
+			PersistFreeChain(pList, first, last);
+			return OPERATE_FAIL;
+		}
+
+		if( 0 == first )
+		{
+			first = offset;
+		}
+		else
+		{
+			PersistNode(pList, last)->Next = offset;
+		}
+
+		last = offset;
+	}
+
+	PersistReplace(pList, 0, PersistHeader(pList)->Head, PersistHeader(pList)->Tail, first, last);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistSortIf
+ * Description   : 持久化链表的sortif
+ * Input         : list_t* pList  
+                unsigned int(*exec)(const void*, const void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 在内存中的副本上排序后经由PersistRebuild写回；内存或文件
+ 				   空间不足时链表保持不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*))
+{
+	list_t* pCopy = NULL;
+
+	if( 1 >= pList->Size || NULL == ( pCopy = PersistCopyOut(pList) ) )
+	{
+		return;
+	}
+
+	pCopy->sortif(pCopy, exec);
+	PersistRebuild(pList, pCopy);
+	pCopy->destroy(&pCopy);
+}
+
+/*****************************************************************************
+ * Function      : PersistSortByKey
+ * Description   : 持久化链表的sortbykey
+ * Input         : list_t* pList  
+                unsigned int key_offset  
+                unsigned int key_width  
+ * Output        : None
+ * Return        : static
+ * Others        : 同PersistSortIf
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width)
+{
+	list_t* pCopy = NULL;
+	int result = OPERATE_FAIL;
+
+	if( !IsValidKey(pList, key_offset, key_width) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 1 >= pList->Size )
+	{
+		return OPERATE_SUCC;
+	}
+
+	pCopy = PersistCopyOut(pList);
+
+	if( NULL == pCopy )
+	{
+		return OPERATE_FAIL;
+	}
+
+	result = pCopy->sortbykey(pCopy, key_offset, key_width);
+
+	if( OPERATE_SUCC == result )
+	{
+		result = PersistRebuild(pList, pCopy);
+	}
+
+	pCopy->destroy(&pCopy);
+
+	return result;
+}
+
+/*****************************************************************************
+ * Function      : PersistParallelSortIf
+ * Description   : 持久化链表的parallelsortif
+ * Input         : list_t* pList  
+                unsigned int(*exec)(const void*, const void*)  
+                unsigned int thread_count  
+                unsigned int serial_threshold  
+ * Output        : None
+ * Return        : static
+ * Others        : 同PersistSortIf，副本上并行排序
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold)
+{
+	list_t* pCopy = NULL;
+
+	if( 1 >= pList->Size || NULL == ( pCopy = PersistCopyOut(pList) ) )
+	{
+		return;
+	}
+
+	pCopy->parallelsortif(pCopy, exec, thread_count, serial_threshold);
+	PersistRebuild(pList, pCopy);
+	pCopy->destroy(&pCopy);
+}
+
+/*****************************************************************************
+ * Function      : PersistForeach
+ * Description   : 持久化链表的foreach
+ * Input         : list_t* pList  
+                void(*exec)(void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 回调中对数据的原地修改不具备崩溃一致性，需要时使用assign
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void PersistForeach(list_t* pList, void(*exec)(void*))
+{
+	unsigned long long offset = PersistHeader(pList)->Head;
+
+	for( ; 0 != offset; offset = PersistNode(pList, offset)->Next )
+	{
+		exec(PersistItem(pList, offset));
+	}
+}
+
+/*****************************************************************************
+ * Function      : PersistClear
+ * Description   : 持久化链表的clear
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 时间复杂度为O(1)，清空头链接后整体回收节点池，不缩小文件
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistClear(list_t* pList)
+{
+	persist_header_t* pHeader = PersistHeader(pList);
+
+	PersistMarkDirty(pList);
+	LIST_ATOMIC_STORE(&pHeader->Head, 0ULL);
+	pHeader->Tail = 0;
+	pHeader->Size = 0;
+	pHeader->Free = 0;
+	pHeader->Bump = LIST_PERSIST_DATA_START;
+	pList->Size = 0;
+	pList->Revision++;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistDestroy
+ * Description   : 持久化链表的destroy，flush后关闭文件并销毁链表容器
+ * Input         : list_t** ppList  
+ * Output        : None
+ * Return        : static
+ * Others        : 只关闭链表，不删除文件中的数据
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistDestroy(list_t** ppList)
+{
+	if( NULL == *ppList )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( NULL != (*ppList)->pPersist )
+	{
+		PersistFlush(*ppList);
+		PersistUnmap(*ppList);
+	}
+
+	return OperateDestroy(ppList);
+}
+
+/*****************************************************************************
+ * Function      : PersistInsertRange
+ * Description   : 持久化链表的insertrange
+ * Input         : list_t* pList  
+                unsigned int index  
+                const void* pData  
+                unsigned int count  
+ * Output        : None
+ * Return        : static
+ * Others        : 先在文件中建好count个节点的链，再一次链接，崩溃时要么全部
+ 				   插入要么都未插入；pushfrontn/pushbackn经由此接口实现
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count)
+{
+	const char* pSource = (const char*)pData;
+	unsigned long long first = 0;
+	unsigned long long last = 0;
+	unsigned long long offset = 0;
+	unsigned int counter = 0;
+
+	if( pList->Size < index || pList->MaxSize < pList->Size || pList->MaxSize - pList->Size < count )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == count )
+	{
+		return OPERATE_SUCC;
+	}
+
+	for( counter = 0; counter < count; counter++, pSource += pList->CarryDataSize )
+	{
+		offset = PersistNewNode(pList, pSource);
+
+		if( 0 == offset )
+		{
+			PersistFreeChain(pList, first, last);
+			return OPERATE_FAIL;
+		}
+
+		if( 0 == first )
+		{
+			first = offset;
+		}
+		else
+		{
+			PersistNode(pList, last)->Next = offset;
+		}
+
+		last = offset;
+	}
+
+	PersistLinkChain(pList, ( 0 < index ) ? PersistLocate(pList, index - 1) : 0, first, last, count);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistToArray
+ * Description   : 持久化链表的toarray
+ * Input         : list_t* pList  
+                void* pBuffer  
+                unsigned int capacity  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int PersistToArray(list_t* pList, void* pBuffer, unsigned int capacity)
+{
+	unsigned long long offset = PersistHeader(pList)->Head;
+	char* pDst = (char*)pBuffer;
+	unsigned int counter = 0;
+
+	for( ; 0 != offset && counter < capacity; offset = PersistNode(pList, offset)->Next, counter++ )
+	{
+		memcpy(pDst, PersistItem(pList, offset), pList->CarryDataSize);
+		pDst += pList->CarryDataSize;
+	}
+
+	return counter;
+}
+
+/*****************************************************************************
+ * Function      : PersistNext
+ * Description   : 持久化链表的next
+ * Input         : list_t* pList  
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 迭代器保存节点偏移量，文件扩展重新映射后仍然有效
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistNext(list_t* pList, list_iter_t* pIter)
+{
+	if( OPERATE_INVALID == pIter->Index )
+	{
+		pIter->Position = PersistHeader(pList)->Head;
+	}
+	else if( 0 != pIter->Position )
+	{
+		pIter->Position = PersistNode(pList, pIter->Position)->Next;
+	}
+	else
+	{
+		return OPERATE_FALSE;
+	}
+
+	pIter->Index++;
+
+	return ( ( 0 != pIter->Position ) ? OPERATE_TRUE : OPERATE_FALSE );
+}
+
+/*****************************************************************************
+ * Function      : PersistDeref
+ * Description   : 持久化链表的deref
+ * Input         : list_t* pList  
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* PersistDeref(list_t* pList, list_iter_t* pIter)
+{
+	return ( ( 0 != pIter->Position ) ? PersistItem(pList, pIter->Position) : NULL );
+}
+
+/*****************************************************************************
+ * Function      : PersistIterInsertAfter
+ * Description   : 持久化链表的iterinsertafter
+ * Input         : list_t* pList  
+                list_iter_t* pIter  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData)
+{
+	unsigned long long offset = 0;
+
+	if( pList->full(pList) || ( 0 == pIter->Position && OPERATE_INVALID != pIter->Index )
+		|| 0 == ( offset = PersistNewNode(pList, pData) ) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	PersistLinkChain(pList, pIter->Position, offset, offset, 1);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : PersistIterEraseAfter
+ * Description   : 持久化链表的itereraseafter
+ * Input         : list_t* pList  
+                list_iter_t* pIter  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int PersistIterEraseAfter(list_t* pList, list_iter_t* pIter)
+{
+	if( 0 == pIter->Position && OPERATE_INVALID != pIter->Index )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return PersistUnlink(pList, pIter->Position);
+}
+
+/*****************************************************************************
+ * Function      : PersistRemoveIf
+ * Description   : 持久化链表的removeif
+ * Input         : list_t* pList  
+                unsigned int(*exec)(const void*, const void*)  
+                const void* pRef  
+ * Output        : None
+ * Return        : static
+ * Others        : 逐个删除，每次删除各自崩溃一致，崩溃时可能只删除了一部分
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int PersistRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	unsigned long long prev = 0;
+	unsigned long long offset = PersistHeader(pList)->Head;
+	unsigned long long next = 0;
+	unsigned int count = 0;
+
+	for( ; 0 != offset; offset = next )
+	{
+		next = PersistNode(pList, offset)->Next;
+
+		if( exec(PersistItem(pList, offset), pRef) )
+		{
+			PersistUnlink(pList, prev);
+			count++;
+		}
+		else
+		{
+			prev = offset;
+		}
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : BindPersistOperations
+ * Description   : 内部实现接口，将与存储结构相关的操作接口替换为持久化链表
+ 				   的实现
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : insert/size/empty/full/resize/pushfrontn/pushbackn/splice/
+ 				   foreach2/foreachbatch/findifbatch/并行遍历/popfrontcopy/
+ 				   savelist/loadlist经由上述接口或GatherItems实现，无需替换；
+ 				   不支持跳表、哈希索引、并发栈模式与读多写少模式
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void BindPersistOperations(list_t* pList)
+{
+	pList->front = PersistFront;
+	pList->back = PersistBack;
+	pList->pushfront = PersistPushFront;
+	pList->pushback = PersistPushBack;
+	pList->popfront = PersistPopFront;
+	pList->popback = PersistPopBack;
+	pList->get = PersistGet;
+	pList->findif = PersistFindIf;
+	pList->findif2 = PersistFindIf2;
+	pList->findindexif = PersistFindIndexIf;
+	pList->remove = PersistRemove;
+	pList->assign = PersistAssign;
+	pList->insertafter = PersistInsertAfter;
+	pList->swap = PersistSwap;
+	pList->sortif = PersistSortIf;
+	pList->sortbykey = PersistSortByKey;
+	pList->parallelsortif = PersistParallelSortIf;
+	pList->clear = PersistClear;
+	pList->destroy = PersistDestroy;
+	pList->foreach = PersistForeach;
+	pList->insertrange = PersistInsertRange;
+	pList->toarray = PersistToArray;
+	pList->next = PersistNext;
+	pList->deref = PersistDeref;
+	pList->iterinsertafter = PersistIterInsertAfter;
+	pList->itereraseafter = PersistIterEraseAfter;
+	pList->removeif = PersistRemoveIf;
+	pList->flush = PersistFlush;
+}
+
+/*****************************************************************************
+ * Function      : OperateCompact
+ * Description   : 整理链表容器的内存，将节点按遍历顺序复制到少数几个连续的
+ 				   大块内存中并重新链接
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 用户数据随节点移动，之前由front/get/findif等返回的地址全部
+ 				   失效；未启用节点池时会为链表容器启用节点池(每块
+ 				   LIST_COMPACT_SLAB_NODES个节点)，此后删除的节点回收复用，
+ 				   clear/destroy时整块释放；启用节点池时释放全部旧块；跳表与
+ 				   哈希索引重新建立；需要与现有节点等量的临时内存，分配失败时
+ 				   链表保持不变；并发栈模式、读多写少模式与持久化链表返回失败
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int OperateCompact(list_t* pList)
+{
+	pool_t* pPool = pList->pPool;
+	slab_t* pSlabs = NULL;
+	slab_t* pSlabTail = NULL;
+	slab_t* pSlab = NULL;
+	node_t* pScan = NULL;
+	node_t* pNext = NULL;
+	node_t* pNode = NULL;
+	node_t* pFirst = NULL;
+	node_t* pLast = NULL;
+	char* pCarve = NULL;
+	unsigned int header = LIST_POOL_ROUNDUP( sizeof(slab_t) );
+	unsigned int remaining = pList->Size;
+	unsigned int chunk = 0;
+	unsigned int left = 0;
+
+	if( LIST_STORAGE_NODE != pList->Storage || OPERATE_TRUE == pList->Concurrent || NULL != pList->pReclaim )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == pList->Size )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( NULL == pPool )
+	{
+		pPool = (pool_t*)pList->Allocator.alloc(pList->Allocator.pContext, sizeof(pool_t));
+
+		if( NULL == pPool )
+		{
+			return OPERATE_FAIL;
+		}
+
+		pPool->pSlabs = NULL;
+		pPool->pFreeNodes = NULL;
+		pPool->pCarve = NULL;
+		pPool->CarveLeft = 0;
+		pPool->NodeSize = LIST_POOL_ROUNDUP( sizeof(node_t) + pList->CarryDataSize );
+		pPool->NodesPerSlab = ( 0 != pList->MaxSize && pList->MaxSize < LIST_COMPACT_SLAB_NODES ) ? pList->MaxSize : LIST_COMPACT_SLAB_NODES;
+	}
+
+	chunk = ( UINT_MAX - header ) / pPool->NodeSize;
+
+	for( ; 0 < remaining; remaining -= left )
+	{
+		left = ( remaining < chunk ) ? remaining : chunk;
+		pSlab = (slab_t*)pList->Allocator.alloc(pList->Allocator.pContext, header + left * pPool->NodeSize);
+
+		if( NULL == pSlab )
+		{
+			for( ; NULL != pSlabs; pSlabs = pSlab )
+			{
+				pSlab = pSlabs->pNext;
+				pList->Allocator.release(pList->Allocator.pContext, pSlabs);
+			}
+
+			if( pPool != pList->pPool )
+			{
+				pList->Allocator.release(pList->Allocator.pContext, pPool);
+			}
+
+			return OPERATE_FAIL;
+		}
+
+		pSlab->pNext = NULL;
+
+		if( NULL == pSlabs )
+		{
+			pSlabs = pSlab;
+		}
+		else
+		{
+			pSlabTail->pNext = pSlab;
+		}
+
+		pSlabTail = pSlab;
+	}
+
+	remaining = pList->Size;
+	pSlab = pSlabs;
+	left = 0;
+
+	for( pScan = pList->pHead; NULL != pScan; pScan = pScan->pNext )
+	{
+		if( 0 == left )
+		{
+			pCarve = (char*)pSlab + header;
+			left = ( remaining < chunk ) ? remaining : chunk;
+			remaining -= left;
+			pSlab = pSlab->pNext;
+		}
+
+		pNode = (node_t*)pCarve;
+		pCarve += pPool->NodeSize;
+		left--;
+		PackageData(pNode, pScan->item.pData, pList);
+
+		if( NULL == pFirst )
+		{
+			pFirst = pNode;
+		}
+		else
+		{
+			pLast->pNext = pNode;
+		}
+
+		pLast = pNode;
+	}
+
+	pLast->pNext = NULL;
+
+	if( pPool == pList->pPool )
+	{
+		for( ; NULL != pPool->pSlabs; pPool->pSlabs = pSlab )
+		{
+			pSlab = pPool->pSlabs->pNext;
+			pList->Allocator.release(pList->Allocator.pContext, pPool->pSlabs);
+		}
+	}
+	else
+	{
+		for( pScan = pList->pHead; NULL != pScan; pScan = pNext )
+		{
+			pNext = pScan->pNext;
+			pList->Allocator.release(pList->Allocator.pContext, pScan);
+		}
+	}
+
+	pPool->pSlabs = pSlabs;
+	pPool->pFreeNodes = NULL;
+	pPool->pCarve = NULL;
+	pPool->CarveLeft = 0;
+	pList->pPool = pPool;
+	pList->pHead = pFirst;
+	pList->pTail = pLast;
+	pList->pCursor = NULL;
+	pList->CursorIndex = 0;
+	pList->Revision++;
+	RebuildSkipIndex(pList);
+	HashClear(pList);
+
+	for( pScan = pList->pHead; NULL != pScan; pScan = pScan->pNext )
+	{
+		HashInsertNode(pList, pScan);
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : LocalityCollect
+ * Description   : 内部实现接口，locality的foreachbatch回调，累加相邻元素
+ 				   用户数据地址的距离
+ * Input         : void** ppItems  
+                unsigned int count  
+                void* pContext  locality_t*
+ * Output        : None
+ * Return        : static
+ * Others        : 单个距离超过LIST_LOCALITY_MAX_DISTANCE时按该值计，避免
+ 				   累加溢出
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void LocalityCollect(void** ppItems, unsigned int count, void* pContext)
+{
+	locality_t* pLocality = (locality_t*)pContext;
+	const char* pItem = NULL;
+	unsigned long long distance = 0;
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		pItem = (const char*)ppItems[counter];
+
+		if( NULL != pLocality->pPrev )
+		{
+			distance = ( pItem > pLocality->pPrev ) ? (unsigned long long)( pItem - pLocality->pPrev )
+				: (unsigned long long)( pLocality->pPrev - pItem );
+			pLocality->Sum += ( distance < LIST_LOCALITY_MAX_DISTANCE ) ? distance : LIST_LOCALITY_MAX_DISTANCE;
+			pLocality->Count++;
+		}
+
+		pLocality->pPrev = pItem;
+	}
+}
+
+/*****************************************************************************
+ * Function      : OperateLocality
+ * Description   : 返回相邻元素的用户数据地址之间的平均距离(字节)，用于判断
+ 				   是否需要compact
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 元素少于2个时返回0；节点连续存放时约等于节点大小，展开链表
+ 				   块内约等于CarryDataSize，数值越大遍历时缓存未命中越多；
+ 				   时间复杂度为O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned long long OperateLocality(list_t* pList)
+{
+	locality_t locality;
+
+	locality.pPrev = NULL;
+	locality.Sum = 0;
+	locality.Count = 0;
+	pList->foreachbatch(pList, LocalityCollect, &locality);
+
+	return ( ( 0 == locality.Count ) ? 0 : locality.Sum / locality.Count );
+}
+
+/*****************************************************************************
+ * Function      : ShardLock
+ * Description   : 内部实现接口，锁定一个分片
+ * Input         : shard_t* pShard  
+                int blocking  OPERATE_FALSE时只尝试一次
+ * Output        : None
+ * Return        : static
+ * Others        : 成功锁定返回OPERATE_SUCC；未启用LIST_USE_PTHREAD时总是成功
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ShardLock(shard_t* pShard, int blocking)
+{
+#if LIST_USE_PTHREAD
+	if( !blocking )
+	{
+		return ( 0 == pthread_mutex_trylock(&pShard->Lock) ) ? OPERATE_SUCC : OPERATE_FAIL;
+	}
+
+	pthread_mutex_lock(&pShard->Lock);
+#else
+	(void)pShard;
+	(void)blocking;
+#endif
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : ShardUnlock
+ * Description   : 内部实现接口，解锁一个分片
+ * Input         : shard_t* pShard  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void ShardUnlock(shard_t* pShard)
+{
+#if LIST_USE_PTHREAD
+	pthread_mutex_unlock(&pShard->Lock);
+#else
+	(void)pShard;
+#endif
+}
+
+/*****************************************************************************
+ * Function      : ShardHint
+ * Description   : 内部实现接口，为调用线程选择首选分片
+ * Input         : shard_list_t* pShardList  
+ * Output        : None
+ * Return        : static
+ * Others        : 对线程标识做FNV-1a散列，同一线程总是从同一分片开始尝试；
+ 				   未启用LIST_USE_PTHREAD时轮流选择
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int ShardHint(shard_list_t* pShardList)
+{
+#if LIST_USE_PTHREAD
+	pthread_t self = pthread_self();
+	const unsigned char* pBytes = (const unsigned char*)&self;
+	unsigned int hash = LIST_HASH_FNV_BASIS;
+	unsigned int i = 0;
+
+	for( i = 0; i < sizeof(pthread_t); i++ )
+	{
+		hash = ( hash ^ pBytes[i] ) * LIST_HASH_FNV_PRIME;
+	}
+
+	return ( hash ^ ( hash >> 16 ) ) % pShardList->ShardCount;
+#else
+	return pShardList->NextShard++ % pShardList->ShardCount;
+#endif
+}
+
+/*****************************************************************************
+ * Function      : ShardPush
+ * Description   : 向分片容器插入一个元素
+ * Input         : shard_list_t* pShardList  
+                const void* pData  
+ * Output        : None
+ * Return        : static
+ * Others        : 按线程分散时先依次trylock各分片，都被占用或已满时再依次
+ 				   阻塞加锁；所有分片都已满时返回OPERATE_FAIL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ShardPush(shard_list_t* pShardList, const void* pData)
+{
+	shard_t* pShard = NULL;
+	unsigned int start = 0;
+	unsigned int probe = 0;
+	int blocking = OPERATE_FALSE;
+	int ret = OPERATE_FAIL;
+
+	if( NULL != pShardList->route )
+	{
+		pShard = &pShardList->pShards[pShardList->route(pData) % pShardList->ShardCount];
+		ShardLock(pShard, OPERATE_TRUE);
+		ret = pShard->pList->pushback(pShard->pList, pData);
+		ShardUnlock(pShard);
+
+		return ret;
+	}
+
+	start = ShardHint(pShardList);
+
+	for( blocking = OPERATE_FALSE; blocking <= OPERATE_TRUE; blocking++ )
+	{
+		for( probe = 0; probe < pShardList->ShardCount; probe++ )
+		{
+			pShard = &pShardList->pShards[( start + probe ) % pShardList->ShardCount];
+
+			if( OPERATE_FAIL == ShardLock(pShard, blocking) )
+			{
+				continue;
+			}
+
+			ret = pShard->pList->pushback(pShard->pList, pData);
+			ShardUnlock(pShard);
+
+			if( OPERATE_SUCC == ret )
+			{
+				return OPERATE_SUCC;
+			}
+		}
+	}
+
+	return OPERATE_FAIL;
+}
+
+/*****************************************************************************
+ * Function      : ShardSize
+ * Description   : 分片容器当前的元素总数
+ * Input         : shard_list_t* pShardList  
+ * Output        : None
+ * Return        : static
+ * Others        : 逐个分片加锁累加，并发插入时结果不是某一时刻的精确快照
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int ShardSize(shard_list_t* pShardList)
+{
+	shard_t* pShard = NULL;
+	unsigned int total = 0;
+	unsigned int i = 0;
+
+	for( i = 0; i < pShardList->ShardCount; i++ )
+	{
+		pShard = &pShardList->pShards[i];
+		ShardLock(pShard, OPERATE_TRUE);
+		total += pShard->pList->size(pShard->pList);
+		ShardUnlock(pShard);
+	}
+
+	return total;
+}
+
+/*****************************************************************************
+ * Function      : ShardForeach
+ * Description   : 将分片容器的每个用户数据及pContext依次传递至exec
+ * Input         : shard_list_t* pShardList  
+                void(*exec)(void*, void*)  
+                void* pContext  
+ * Output        : None
+ * Return        : static
+ * Others        : 逐个分片在锁内遍历，回调中不可再操作该分片容器
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void ShardForeach(shard_list_t* pShardList, void(*exec)(void*, void*), void* pContext)
+{
+	shard_t* pShard = NULL;
+	unsigned int i = 0;
+
+	for( i = 0; i < pShardList->ShardCount; i++ )
+	{
+		pShard = &pShardList->pShards[i];
+		ShardLock(pShard, OPERATE_TRUE);
+		pShard->pList->foreach2(pShard->pList, exec, pContext);
+		ShardUnlock(pShard);
+	}
+}
+
+/*****************************************************************************
+ * Function      : ShardDrain
+ * Description   : 取出分片容器的全部元素，依次与pContext一起传递至exec后删除
+ * Input         : shard_list_t* pShardList  
+                void(*exec)(void*, void*)  可为NULL，此时仅丢弃
+                void* pContext  
+ * Output        : None
+ * Return        : static
+ * Others        : 返回取出的元素个数；每个分片在锁内只与一个新建的空链表交换，
+ 				   回调在锁外执行，不阻塞并发插入；新建链表失败时退化为在锁内
+ 				   处理该分片
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int ShardDrain(shard_list_t* pShardList, void(*exec)(void*, void*), void* pContext)
+{
+	shard_t* pShard = NULL;
+	list_t* pFresh = NULL;
+	list_t* pDetached = NULL;
+	unsigned int total = 0;
+	unsigned int i = 0;
+
+	for( i = 0; i < pShardList->ShardCount; i++ )
+	{
+		pShard = &pShardList->pShards[i];
+		pFresh = CreateListEx(pShardList->ShardMaxSize, pShardList->CarryDataSize,
+			pShardList->HasAttr ? &pShardList->Attr : NULL);
+
+		ShardLock(pShard, OPERATE_TRUE);
+
+		if( NULL == pFresh )
+		{
+			if( NULL != exec )
+			{
+				pShard->pList->foreach2(pShard->pList, exec, pContext);
+			}
+
+			total += pShard->pList->size(pShard->pList);
+			pShard->pList->clear(pShard->pList);
+			ShardUnlock(pShard);
+			continue;
+		}
+
+		pDetached = pShard->pList;
+		pShard->pList = pFresh;
+		ShardUnlock(pShard);
+
+		if( NULL != exec )
+		{
+			pDetached->foreach2(pDetached, exec, pContext);
+		}
+
+		total += pDetached->size(pDetached);
+		pDetached->destroy(&pDetached);
+	}
+
+	return total;
+}
+
+/*****************************************************************************
+ * Function      : ShardDestroy
+ * Description   : 销毁分片容器
+ * Input         : shard_list_t** ppShardList  
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int ShardDestroy(shard_list_t** ppShardList)
+{
+	list_allocator_t allocator;
+	unsigned int i = 0;
+
+	if( NULL == *ppShardList )
+	{
+		return OPERATE_SUCC;
+	}
+
+	allocator = (*ppShardList)->Allocator;
+
+	for( i = 0; i < (*ppShardList)->ShardCount; i++ )
+	{
+		(*ppShardList)->pShards[i].pList->destroy(&(*ppShardList)->pShards[i].pList);
+#if LIST_USE_PTHREAD
+		pthread_mutex_destroy(&(*ppShardList)->pShards[i].Lock);
+#endif
+	}
+
+	allocator.release(allocator.pContext, (*ppShardList)->pShards);
+	allocator.release(allocator.pContext, *ppShardList);
+	*ppShardList = NULL;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : BindUnrolledOperations
+ * Description   : 内部实现接口，将链表容器的操作接口切换为展开链表(unrolled
+ 				   linked list)的实现
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 展开链表的每个块连续存放最多BlockItems个元素，遍历时每块只
+ 				   有一次指针跳转；size/capacity/resize/empty/full/insert/
+ 				   clear/destroy/pushfrontn/pushbackn/spliceafter/concat/
+ 				   beforebegin/begin/foreach2/foreachbatch/findifbatch/
+ 				   parallelforeach/countif/findall/popfrontcopy/readbegin/readend/
+ 				   savelist/loadlist/flush/locality与节点存储共用同一实现，
+ 				   setconcurrent/setreadmostly仅支持节点存储
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: setconcurrent与popfrontcopy共用节点存储实现
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: readbegin/readend/setreadmostly共用节点存储实现
+ * 4.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: savelist/loadlist共用节点存储实现
+ * 5.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 绑定compact
+*****************************************************************************/
+static void BindUnrolledOperations(list_t* pList)
+{
+	pList->front = UnrolledFront;
+	pList->back = UnrolledBack;
+	pList->pushfront = UnrolledPushFront;
+	pList->pushback = UnrolledPushBack;
+	pList->popfront = UnrolledPopFront;
+	pList->popback = UnrolledPopBack;
+	pList->get = UnrolledGet;
+	pList->findif = UnrolledFindIf;
+	pList->findif2 = UnrolledFindIf2;
+	pList->findindexif = UnrolledFindIndexIf;
+	pList->remove = UnrolledRemove;
+	pList->assign = UnrolledAssign;
+	pList->insertafter = UnrolledInsertAfter;
+	pList->swap = UnrolledSwap;
+	pList->sortif = UnrolledSortIf;
+	pList->sortbykey = UnrolledSortByKey;
+	pList->parallelsortif = UnrolledParallelSortIf;
+	pList->foreach = UnrolledForeach;
+	pList->insertrange = UnrolledInsertRange;
+	pList->toarray = UnrolledToArray;
+	pList->splice = UnrolledSplice;
+	pList->next = UnrolledNext;
+	pList->deref = UnrolledDeref;
+	pList->iterinsertafter = UnrolledIterInsertAfter;
+	pList->itereraseafter = UnrolledIterEraseAfter;
+	pList->removeif = UnrolledRemoveIf;
+	pList->findbykey = UnrolledFindByKey;
+	pList->compact = UnrolledCompact;
+}
+
+/*****************************************************************************
+ * Function      : AllocBlock
+ * Description   : 内部实现接口，为展开链表分配一个空块
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 块大小按size_t计算，超出size_t表示范围或分配失败时返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 块大小溢出时返回NULL
+*****************************************************************************/
+static block_t* AllocBlock(list_t* pList)
+{
+	block_t* pBlock = NULL;
+
+	if( 0 != pList->CarryDataSize
+		&& pList->BlockItems > ( (size_t)-1 - LIST_POOL_ROUNDUP( sizeof(block_t) ) ) / pList->CarryDataSize )
+	{
+		return NULL;
+	}
+
+	pBlock = (block_t*)pList->Allocator.alloc(pList->Allocator.pContext,
+		LIST_POOL_ROUNDUP( sizeof(block_t) ) + (size_t)pList->BlockItems * pList->CarryDataSize);
+
+	if( NULL == pBlock )
+	{
+		return NULL;
+	}
+
+	pBlock->pNext = NULL;
+	pBlock->Count = 0;
+
+	return pBlock;
+}
+
+/*****************************************************************************
+ * Function      : FreeBlock
+ * Description   : 内部实现接口，释放展开链表的一个块
+ * Input         : list_t* pList
+                block_t* pBlock
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void FreeBlock(list_t* pList, block_t* pBlock)
+{
+	pList->Allocator.release(pList->Allocator.pContext, pBlock);
+}
+
+/*****************************************************************************
+ * Function      : BlockItem
+ * Description   : 内部实现接口，返回块内第offset个元素的地址
+ * Input         : list_t* pList
+                block_t* pBlock
+                unsigned int offset
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static char* BlockItem(list_t* pList, block_t* pBlock, unsigned int offset)
+{
+	return (char*)pBlock + LIST_POOL_ROUNDUP( sizeof(block_t) ) + offset * pList->CarryDataSize;
+}
+
+/*****************************************************************************
+ * Function      : LocateBlock
+ * Description   : 内部实现接口，定位展开链表中指定index处元素所在的块及其在
+ 				   块内的偏移
+ * Input         : list_t* pList
+                unsigned int index
+                unsigned int* pOffset  返回块内偏移
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需保证index有效；与LocateNode相同，若游标块位于目标
+ 				   之前则从游标块开始查找，并将游标更新为本次定位的块，
+ 				   CursorIndex记录游标块首元素的index
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 仅在启用CursorCache时使用并更新游标
+ * 3.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 游标默认启用，经序列号读取与发布
+*****************************************************************************/
+static block_t* LocateBlock(list_t* pList, unsigned int index, unsigned int* pOffset)
+{
+	block_t* pScan = pList->pHeadBlock;
+	block_t* pCursor = NULL;
+	unsigned int cursor_index = 0;
+	unsigned int start = 0;
+	unsigned int seq = CursorLoadBegin(pList);
+
+	pCursor = LIST_ATOMIC_LOAD_RELAXED(&pList->pCursorBlock);
+	cursor_index = LIST_ATOMIC_LOAD_RELAXED(&pList->CursorIndex);
+
+	if( OPERATE_FALSE == CursorLoadValid(pList, seq) )
+	{
+		pCursor = NULL;
+	}
+
+	if( index >= pList->Size - pList->pTailBlock->Count )
+	{
+		pScan = pList->pTailBlock;
+		start = pList->Size - pList->pTailBlock->Count;
+	}
+	else if( NULL != pCursor && cursor_index <= index )
+	{
+		pScan = pCursor;
+		start = cursor_index;
+	}
+
+	while( index >= start + pScan->Count )
+	{
+		start += pScan->Count;
+		pScan = pScan->pNext;
+	}
+
+	if( ( pCursor != pScan || cursor_index != start ) && OPERATE_TRUE == CursorStoreBegin(pList, &seq) )
+	{
+		LIST_ATOMIC_STORE_RELAXED(&pList->pCursorBlock, pScan);
+		LIST_ATOMIC_STORE_RELAXED(&pList->CursorIndex, start);
+		CursorStoreEnd(pList, seq);
+	}
+
+	*pOffset = index - start;
+
+	return pScan;
+}
+
+/*****************************************************************************
+ * Function      : UnlinkBlock
+ * Description   : 内部实现接口，将一个空块从展开链表中摘除并释放
+ * Input         : list_t* pList
+                block_t* pBlock
+ * Output        : None
+ * Return        : static
+ * Others        : 需从首块开始查找前驱块，时间复杂度O(n/BlockItems)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void UnlinkBlock(list_t* pList, block_t* pBlock)
+{
+	block_t* pPrev = NULL;
+
+	if( pList->pHeadBlock == pBlock )
+	{
+		pList->pHeadBlock = pBlock->pNext;
+	}
+	else
+	{
+		for( pPrev = pList->pHeadBlock; pPrev->pNext != pBlock; pPrev = pPrev->pNext )
+		{
+		}
+
+		pPrev->pNext = pBlock->pNext;
+	}
+
+	if( pList->pTailBlock == pBlock )
+	{
+		pList->pTailBlock = pPrev;
+	}
+
+	if( pList->pCursorBlock == pBlock )
+	{
+		pList->pCursorBlock = NULL;
+	}
+
+	FreeBlock(pList, pBlock);
+}
+
+/*****************************************************************************
+ * Function      : SplitBlock
+ * Description   : 内部实现接口，将块中offset及其之后的元素移到紧随其后的新块中
+ * Input         : list_t* pList
+                block_t* pBlock
+                unsigned int offset  保留在原块中的元素个数
+ * Output        : None
+ * Return        : static
+ * Others        : 返回新块，失败返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static block_t* SplitBlock(list_t* pList, block_t* pBlock, unsigned int offset)
+{
+	block_t* pNewBlock = AllocBlock(pList);
+
+	if( NULL == pNewBlock )
+	{
+		return NULL;
+	}
+
+	memcpy(BlockItem(pList, pNewBlock, 0), BlockItem(pList, pBlock, offset),
+		( pBlock->Count - offset ) * pList->CarryDataSize);
+	pNewBlock->Count = pBlock->Count - offset;
+	pBlock->Count = offset;
+	pNewBlock->pNext = pBlock->pNext;
+	pBlock->pNext = pNewBlock;
+
+	if( pList->pTailBlock == pBlock )
+	{
+		pList->pTailBlock = pNewBlock;
+	}
+
+	return pNewBlock;
+}
+
+
+/*****************************************************************************
+ * Function      : UnrolledInsertAt
+ * Description   : 内部实现接口，在展开链表中插入一个元素，使其位于index处
+ * Input         : list_t* pList
+                unsigned int index  0~Size
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 目标块已满时将其后半部分拆分到新块中再插入
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 块拆分移至SplitBlock
+*****************************************************************************/
+static int UnrolledInsertAt(list_t* pList, unsigned int index, const void* pData)
+{
+	block_t* pBlock = NULL;
+	block_t* pNewBlock = NULL;
+	unsigned int offset = 0;
+	unsigned int half = pList->BlockItems / 2;
+
+	if( pList->full(pList) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( NULL == pList->pHeadBlock )
+	{
+		pBlock = AllocBlock(pList);
+
+		if( NULL == pBlock )
+		{
+			return OPERATE_FAIL;
+		}
+
+		pList->pHeadBlock = pBlock;
+		pList->pTailBlock = pBlock;
+	}
+	else if( index == pList->Size )
+	{
+		pBlock = pList->pTailBlock;
+		offset = pBlock->Count;
+
+		if( pList->BlockItems == offset )
+		{
+			pBlock = AllocBlock(pList);
+
+			if( NULL == pBlock )
+			{
+				return OPERATE_FAIL;
+			}
+
+			pList->pTailBlock->pNext = pBlock;
+			pList->pTailBlock = pBlock;
+			offset = 0;
+		}
+	}
+	else
+	{
+		pBlock = LocateBlock(pList, index, &offset);
+
+		if( pList->BlockItems == pBlock->Count )
+		{
+			pNewBlock = SplitBlock(pList, pBlock, half);
+
+			if( NULL == pNewBlock )
+			{
+				return OPERATE_FAIL;
+			}
+
+			if( offset > half )
+			{
+				pBlock = pNewBlock;
+				offset -= half;
+			}
+		}
+	}
+
+	memmove(BlockItem(pList, pBlock, offset + 1), BlockItem(pList, pBlock, offset),
+		( pBlock->Count - offset ) * pList->CarryDataSize);
+	memcpy(BlockItem(pList, pBlock, offset), pData, pList->CarryDataSize);
+	pBlock->Count++;
+	pList->Size++;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledRemoveAt
+ * Description   : 内部实现接口，删除展开链表index处的元素
+ * Input         : list_t* pList
+                unsigned int index
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者需保证index有效；块为空时摘除，块不足半满且可容纳后继
+ 				   块的全部元素时与后继块合并
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void UnrolledRemoveAt(list_t* pList, unsigned int index)
+{
+	block_t* pBlock = NULL;
+	block_t* pNext = NULL;
+	unsigned int offset = 0;
+
+	pBlock = LocateBlock(pList, index, &offset);
+	memmove(BlockItem(pList, pBlock, offset), BlockItem(pList, pBlock, offset + 1),
+		( pBlock->Count - offset - 1 ) * pList->CarryDataSize);
+	pBlock->Count--;
+	pList->Size--;
+
+	if( 0 == pBlock->Count )
+	{
+		UnlinkBlock(pList, pBlock);
+		return;
+	}
+
+	pNext = pBlock->pNext;
+
+	if( NULL != pNext && pBlock->Count < pList->BlockItems / 2
+		&& pBlock->Count + pNext->Count <= pList->BlockItems )
+	{
+		memcpy(BlockItem(pList, pBlock, pBlock->Count), BlockItem(pList, pNext, 0),
+			pNext->Count * pList->CarryDataSize);
+		pBlock->Count += pNext->Count;
+		pBlock->pNext = pNext->pNext;
+
+		if( pList->pTailBlock == pNext )
+		{
+			pList->pTailBlock = pBlock;
+		}
+
+		FreeBlock(pList, pNext);
+	}
+}
+
+/*****************************************************************************
+ * Function      : MergeSortItems
+ * Description   : 内部实现接口，对元素地址数组做稳定的自底向上归并排序
+ * Input         : char** ppItems  前count个为元素地址，后count个为辅助空间
+                unsigned int count  
+                unsigned int(*exec)(const void*, const void*)  
+ * Output        : None
+ * Return        : static
+ * Others        : 返回排好序的一半(ppItems或ppItems + count)，供展开链表与
+ 				   连续存储的排序共用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function, 由UnrolledSortIf中拆分
+*****************************************************************************/
+static char** MergeSortItems(char** ppItems, unsigned int count, unsigned int(*exec)(const void*, const void*))
+{
+	char** ppFrom = ppItems;
+	char** ppTo = ppItems + count;
+	char** ppSwap = NULL;
+	unsigned int width = 1;
+	unsigned int left = 0;
+	unsigned int mid = 0;
+	unsigned int right = 0;
+	unsigned int i = 0;
+	unsigned int j = 0;
+	unsigned int k = 0;
+
+	for( width = 1; width < count; width = ( width > count - width ) ? count : width * 2 )
+	{
+		for( left = 0; left < count; left = right )
+		{
+			mid = ( width < count - left ) ? left + width : count;
+			right = ( width < count - mid ) ? mid + width : count;
+
+			for( i = left, j = mid, k = left; k < right; k++ )
+			{
+				if( j < right && ( i >= mid || OPERATE_TRUE == exec( ppFrom[i], ppFrom[j] ) ) )
+				{
+					ppTo[k] = ppFrom[j++];
+				}
+				else
+				{
+					ppTo[k] = ppFrom[i++];
+				}
+			}
+		}
+
+		ppSwap = ppFrom;
+		ppFrom = ppTo;
+		ppTo = ppSwap;
+	}
+
+	return ppFrom;
+}
+
+/*****************************************************************************
+ * Function      : RadixSortItems
+ * Description   : 内部实现接口，按键对元素地址数组做稳定的LSD基数排序(每趟
+ 				   一个字节的计数排序)
+ * Input         : char** ppItems  前count个为元素地址，后count个为辅助空间
+                unsigned int count  
+                unsigned int key_offset  
+                unsigned int key_width  
+ * Output        : None
+ * Return        : static
+ * Others        : 所有元素在某一字节上相同时跳过该趟；返回排好序的一半
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function, 由UnrolledSortByKey中拆分
+*****************************************************************************/
+static char** RadixSortItems(char** ppItems, unsigned int count, unsigned int key_offset, unsigned int key_width)
+{
+	unsigned int counts[LIST_RADIX_BUCKETS];
+	char** ppFrom = ppItems;
+	char** ppTo = ppItems + count;
+	char** ppSwap = NULL;
+	unsigned long long keyOr = 0;
+	unsigned long long keyAnd = ~0ULL;
+	unsigned long long key = 0;
+	unsigned int shift = 0;
+	unsigned int bucket = 0;
+	unsigned int total = 0;
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		key = ReadKey(ppFrom[counter], key_offset, key_width);
+		keyOr |= key;
+		keyAnd &= key;
+	}
+
+	for( shift = 0; shift < key_width * 8; shift += LIST_RADIX_BITS )
+	{
+		if( 0 == ( ( ( keyOr ^ keyAnd ) >> shift ) & ( LIST_RADIX_BUCKETS - 1 ) ) )
+		{
+			continue;
+		}
+
+		memset(counts, 0, sizeof(counts));
+
+		for( counter = 0; counter < count; counter++ )
+		{
+			counts[( ReadKey(ppFrom[counter], key_offset, key_width) >> shift ) & ( LIST_RADIX_BUCKETS - 1 )]++;
+		}
+
+		for( bucket = 0, total = 0; bucket < LIST_RADIX_BUCKETS; bucket++ )
+		{
+			key = counts[bucket];
+			counts[bucket] = total;
+			total += (unsigned int)key;
+		}
+
+		for( counter = 0; counter < count; counter++ )
+		{
+			bucket = (unsigned int)( ( ReadKey(ppFrom[counter], key_offset, key_width) >> shift ) & ( LIST_RADIX_BUCKETS - 1 ) );
+			ppTo[counts[bucket]++] = ppFrom[counter];
+		}
+
+		ppSwap = ppFrom;
+		ppFrom = ppTo;
+		ppTo = ppSwap;
+	}
+
+	return ppFrom;
+}
+
+/*****************************************************************************
+ * Function      : CollectUnrolledItems
+ * Description   : 内部实现接口，申请一个指针数组并按顺序填入展开链表全部元素
+ 				   的地址，数组后半部分(同样为Size个指针)留作排序的辅助空间
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 返回的数组需由调用者通过链表的分配器释放，数组字节数超出
+ 				   size_t表示范围或分配失败时返回NULL
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 数组大小按size_t计算并检查溢出
+*****************************************************************************/
+static char** CollectUnrolledItems(list_t* pList)
+{
+	char** ppItems = NULL;
+	block_t* pBlock = NULL;
+	unsigned int counter = 0;
+	unsigned int offset = 0;
+
+	if( (unsigned long long)pList->Size * 2 * sizeof(char*) > (size_t)-1 )
+	{
+		return NULL;
+	}
+
+	ppItems = (char**)pList->Allocator.alloc(pList->Allocator.pContext, (size_t)2 * pList->Size * sizeof(char*));
+
+	if( NULL == ppItems )
+	{
+		return NULL;
+	}
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		for( offset = 0; offset < pBlock->Count; offset++ )
+		{
+			ppItems[counter++] = BlockItem(pList, pBlock, offset);
+		}
+	}
+
+	return ppItems;
+}
+
+/*****************************************************************************
+ * Function      : RebuildUnrolledBlocks
+ * Description   : 内部实现接口，按ppItems给出的顺序将元素拷贝到一组新的满块中，
+ 				   并释放原有的块
+ * Input         : list_t* pList
+                char** ppItems  Size个元素地址
+ * Output        : None
+ * Return        : static
+ * Others        : 申请新块失败时原有数据保持不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int RebuildUnrolledBlocks(list_t* pList, char** ppItems)
+{
+	block_t* pHead = NULL;
+	block_t* pTail = NULL;
+	block_t* pBlock = NULL;
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < pList->Size; counter++ )
+	{
+		if( NULL == pTail || pList->BlockItems == pTail->Count )
+		{
+			pBlock = AllocBlock(pList);
+
+			if( NULL == pBlock )
+			{
+				while( NULL != pHead )
+				{
+					pBlock = pHead;
+					pHead = pHead->pNext;
+					FreeBlock(pList, pBlock);
+				}
+
+				return OPERATE_FAIL;
+			}
+
+			if( NULL == pTail )
+			{
+				pHead = pBlock;
+			}
+			else
+			{
+				pTail->pNext = pBlock;
+			}
+
+			pTail = pBlock;
+		}
+
+		memcpy(BlockItem(pList, pTail, pTail->Count), ppItems[counter], pList->CarryDataSize);
+		pTail->Count++;
+	}
+
+	while( NULL != pList->pHeadBlock )
+	{
+		pBlock = pList->pHeadBlock;
+		pList->pHeadBlock = pBlock->pNext;
+		FreeBlock(pList, pBlock);
+	}
+
+	pList->pHeadBlock = pHead;
+	pList->pTailBlock = pTail;
+	pList->pCursorBlock = NULL;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledFront
+ * Description   : 展开链表版本的front
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledFront(list_t* pList)
+{
+	if(pList->empty(pList))
+	{
+		return NULL;
+	}
+
+	return BlockItem(pList, pList->pHeadBlock, 0);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledBack
+ * Description   : 展开链表版本的back
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledBack(list_t* pList)
+{
+	if(pList->empty(pList))
+	{
+		return NULL;
+	}
+
+	return BlockItem(pList, pList->pTailBlock, pList->pTailBlock->Count - 1);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledPushFront
+ * Description   : 展开链表版本的pushfront
+ * Input         : list_t* pList
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 需移动首块内的元素，时间复杂度O(BlockItems)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledPushFront(list_t* pList, const void* pData)
+{
+	return UnrolledInsertAt(pList, 0, pData);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledPushBack
+ * Description   : 展开链表版本的pushback
+ * Input         : list_t* pList
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledPushBack(list_t* pList, const void* pData)
+{
+	return UnrolledInsertAt(pList, pList->Size, pData);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledPopFront
+ * Description   : 展开链表版本的popfront
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledPopFront(list_t* pList)
+{
+	if(pList->empty(pList))
+	{
+		return OPERATE_FAIL;
+	}
+
+	UnrolledRemoveAt(pList, 0);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledPopBack
+ * Description   : 展开链表版本的popback
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 仅当尾块被删空时才需查找前驱块
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledPopBack(list_t* pList)
+{
+	if(pList->empty(pList))
+	{
+		return OPERATE_FAIL;
+	}
+
+	UnrolledRemoveAt(pList, pList->Size - 1);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledGet
+ * Description   : 展开链表版本的get
+ * Input         : list_t* pList
+                unsigned int index
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledGet(list_t* pList, unsigned int index)
+{
+	block_t* pBlock = NULL;
+	unsigned int offset = 0;
+
+	if(pList->empty(pList) || pList->Size <= index)
+	{
+		return NULL;
+	}
+
+	pBlock = LocateBlock(pList, index, &offset);
+
+	return BlockItem(pList, pBlock, offset);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledFindIf
+ * Description   : 展开链表版本的findif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*)
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledFindIf(list_t* pList, unsigned int(*exec)(const void*))
+{
+	block_t* pBlock = NULL;
+	char* pItem = NULL;
+	unsigned int offset = 0;
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		pItem = BlockItem(pList, pBlock, 0);
+
+		for( offset = 0; offset < pBlock->Count; offset++, pItem += pList->CarryDataSize )
+		{
+			if(OPERATE_TRUE == exec( pItem ))
+			{
+				return pItem;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledFindIf2
+ * Description   : 展开链表版本的findif2
+ * Input         : list_t* pList
+ 				unsigned int(*exec)(const void*, const void*)
+ 				const void* pRef
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	block_t* pBlock = NULL;
+	char* pItem = NULL;
+	unsigned int offset = 0;
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		pItem = BlockItem(pList, pBlock, 0);
+
+		for( offset = 0; offset < pBlock->Count; offset++, pItem += pList->CarryDataSize )
+		{
+			if(OPERATE_TRUE == exec( pItem, pRef ))
+			{
+				return pItem;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledFindIndexIf
+ * Description   : 展开链表版本的findindexif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                const void* pRef
+ * Output        : None
+ * Return        : static
+ * Others        : 空链表返回OPERATE_FAIL，与OperateFindIndexIf一致
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int UnrolledFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	block_t* pBlock = NULL;
+	char* pItem = NULL;
+	unsigned int offset = 0;
+	unsigned int counter = 0;
+
+	if(pList->empty(pList))
+	{
+		return OPERATE_FAIL;
+	}
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		pItem = BlockItem(pList, pBlock, 0);
+
+		for( offset = 0; offset < pBlock->Count; offset++, pItem += pList->CarryDataSize )
+		{
+			if(OPERATE_TRUE == exec( pItem, pRef ))
+			{
+				return counter + offset;
+			}
+		}
+
+		counter += pBlock->Count;
+	}
+
+	return OPERATE_INVALID;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledRemove
+ * Description   : 展开链表版本的remove
+ * Input         : list_t* pList
+                unsigned int index
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledRemove(list_t* pList, unsigned int index)
+{
+	if(pList->empty(pList) || pList->Size <= index)
+	{
+		return OPERATE_FAIL;
+	}
+
+	UnrolledRemoveAt(pList, index);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledAssign
+ * Description   : 展开链表版本的assign
+ * Input         : list_t* pList
+                unsigned int index
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledAssign(list_t* pList, unsigned int index, const void* pData)
+{
+	if(pList->empty(pList) || pList->Size <= index)
+	{
+		return OPERATE_FAIL;
+	}
+
+	memcpy( UnrolledGet(pList, index), pData, pList->CarryDataSize );
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledInsertAfter
+ * Description   : 展开链表版本的insertafter
+ * Input         : list_t* pList
+                unsigned int index
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledInsertAfter(list_t* pList, unsigned int index, const void* pData)
+{
+	if( pList->full(pList) || pList->empty(pList) || pList->Size <= index)
+	{
+		return OPERATE_FAIL;
+	}
+
+	return UnrolledInsertAt(pList, index + 1, pData);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledSwap
+ * Description   : 展开链表版本的swap
+ * Input         : list_t* pList
+                unsigned int index1
+                unsigned int index2
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledSwap(list_t* pList, unsigned int index1, unsigned int index2)
+{
+	if((index1 == index2) || (pList->Size <= index1) || (pList->Size <= index2) || (pList->Size <= 1))
+	{
+		return OPERATE_FAIL;
+	}
+
+	return SwapData(pList, UnrolledGet(pList, index1), UnrolledGet(pList, index2));
+}
+
+/*****************************************************************************
+ * Function      : UnrolledSortIf
+ * Description   : 展开链表版本的sortif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+ * Output        : None
+ * Return        : static
+ * Others        : 元素在块内连续存放而无法重新链接，因此先经由MergeSortItems对
+ 				   元素地址数组排序，再按序拷贝到新的满块中；需临时申请
+ 				   2*Size个指针及一份数据的空间，申请失败时链表保持不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 归并排序拆分至MergeSortItems
+*****************************************************************************/
+static void UnrolledSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*))
+{
+	char** ppItems = NULL;
+
+	if( 1 >= pList->size(pList) )
+	{
+		return;
+	}
+
+	ppItems = CollectUnrolledItems(pList);
+
+	if( NULL == ppItems )
+	{
+		return;
+	}
+
+	RebuildUnrolledBlocks(pList, MergeSortItems(ppItems, pList->Size, exec));
+	pList->Allocator.release(pList->Allocator.pContext, ppItems);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledSortByKey
+ * Description   : 展开链表版本的sortbykey
+ * Input         : list_t* pList
+                unsigned int key_offset
+                unsigned int key_width
+ * Output        : None
+ * Return        : static
+ * Others        : 经由RadixSortItems对元素地址数组排序，再按序拷贝到新的满块
+ 				   中；临时空间同UnrolledSortIf
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 基数排序拆分至RadixSortItems
+*****************************************************************************/
+static int UnrolledSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width)
+{
+	char** ppItems = NULL;
+	int result = OPERATE_SUCC;
+
+	if( !IsValidKey(pList, key_offset, key_width) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 1 >= pList->size(pList) )
+	{
+		return OPERATE_SUCC;
+	}
+
+	ppItems = CollectUnrolledItems(pList);
+
+	if( NULL == ppItems )
+	{
+		return OPERATE_FAIL;
+	}
+
+	result = RebuildUnrolledBlocks(pList, RadixSortItems(ppItems, pList->Size, key_offset, key_width));
+	pList->Allocator.release(pList->Allocator.pContext, ppItems);
+
+	return result;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledParallelSortIf
+ * Description   : 展开链表版本的parallelsortif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                unsigned int thread_count
+                unsigned int serial_threshold
+ * Output        : None
+ * Return        : static
+ * Others        : 展开链表的排序以拷贝数据为主，此处退化为sortif
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void UnrolledParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold)
+{
+	(void)thread_count;
+	(void)serial_threshold;
+
+	pList->sortif(pList, exec);
+}
+
+/*****************************************************************************
+ * Function      : UnrolledForeach
+ * Description   : 展开链表版本的foreach
+ * Input         : list_t* pList
+                void(*exec)(void*)
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void UnrolledForeach(list_t* pList, void(*exec)(void*))
+{
+	block_t* pBlock = NULL;
+	char* pItem = NULL;
+	unsigned int offset = 0;
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		pItem = BlockItem(pList, pBlock, 0);
+
+		for( offset = 0; offset < pBlock->Count; offset++, pItem += pList->CarryDataSize )
+		{
+			exec(pItem);
+		}
+	}
+}
+
+/*****************************************************************************
+ * Function      : UnrolledInsertRange
+ * Description   : 展开链表版本的insertrange
+ * Input         : list_t* pList
+                unsigned int index
+                const void* pData
+                unsigned int count
+ * Output        : None
+ * Return        : static
+ * Others        : 添加到尾部时按块整段拷贝；插入到中间时逐个插入，内存不足时
+ 				   可能只插入了前面的部分元素
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count)
+{
+	block_t* pBlock = NULL;
+	const char* pSrc = (const char*)pData;
+	unsigned int counter = 0;
+	unsigned int batch = 0;
+
+	if( pList->Size < index || pList->MaxSize < pList->Size || pList->MaxSize - pList->Size < count )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( index < pList->Size )
+	{
+		for( counter = 0; counter < count; counter++, pSrc += pList->CarryDataSize )
+		{
+			if( OPERATE_FAIL == UnrolledInsertAt(pList, index + counter, pSrc) )
+			{
+				return OPERATE_FAIL;
+			}
+		}
+
+		return OPERATE_SUCC;
+	}
+
+	while( counter < count )
+	{
+		if( NULL == pList->pTailBlock || pList->BlockItems == pList->pTailBlock->Count )
+		{
+			pBlock = AllocBlock(pList);
+
+			if( NULL == pBlock )
+			{
+				return OPERATE_FAIL;
+			}
+
+			if( NULL == pList->pTailBlock )
+			{
+				pList->pHeadBlock = pBlock;
+			}
+			else
+			{
+				pList->pTailBlock->pNext = pBlock;
+			}
+
+			pList->pTailBlock = pBlock;
+		}
+
+		pBlock = pList->pTailBlock;
+		batch = pList->BlockItems - pBlock->Count;
+
+		if( batch > count - counter )
+		{
+			batch = count - counter;
+		}
+
+		memcpy(BlockItem(pList, pBlock, pBlock->Count), pSrc, batch * pList->CarryDataSize);
+		pBlock->Count += batch;
+		pList->Size += batch;
+		pSrc += batch * pList->CarryDataSize;
+		counter += batch;
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledToArray
+ * Description   : 展开链表版本的toarray
+ * Input         : list_t* pList
+                void* pBuffer
+                unsigned int capacity
+ * Output        : None
+ * Return        : static
+ * Others        : 按块整段拷贝
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int UnrolledToArray(list_t* pList, void* pBuffer, unsigned int capacity)
+{
+	block_t* pBlock = NULL;
+	char* pDst = (char*)pBuffer;
+	unsigned int counter = 0;
+	unsigned int batch = 0;
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock && counter < capacity; pBlock = pBlock->pNext )
+	{
+		batch = ( pBlock->Count < capacity - counter ) ? pBlock->Count : capacity - counter;
+		memcpy(pDst, BlockItem(pList, pBlock, 0), batch * pList->CarryDataSize);
+		pDst += batch * pList->CarryDataSize;
+		counter += batch;
+	}
+
+	return counter;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledSplice
+ * Description   : 展开链表版本的splice
+ * Input         : list_t* pList
+                unsigned int index
+                list_t* pSource
+ * Output        : None
+ * Return        : static
+ * Others        : 直接链接pSource的块；index位于某块中间时先将该块拆分为两块
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 块拆分移至SplitBlock
+*****************************************************************************/
+static int UnrolledSplice(list_t* pList, unsigned int index, list_t* pSource)
+{
+	block_t* pPrev = NULL;
+	unsigned int offset = 0;
+
+	if( OPERATE_FALSE == IsSpliceValid(pList, index, pSource) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == pSource->Size )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( OPERATE_FALSE == IsRelinkable(pList, pSource) )
+	{
+		return SpliceByCopy(pList, index, pSource);
+	}
+
+	if( index == pList->Size )
+	{
+		pPrev = pList->pTailBlock;
+	}
+	else if( 0 != index )
+	{
+		pPrev = LocateBlock(pList, index - 1, &offset);
+
+		if( offset + 1 < pPrev->Count && NULL == SplitBlock(pList, pPrev, offset + 1) )
+		{
+			return OPERATE_FAIL;
+		}
+	}
+
+	if( NULL == pPrev )
+	{
+		pSource->pTailBlock->pNext = pList->pHeadBlock;
+		pList->pHeadBlock = pSource->pHeadBlock;
+	}
+	else
+	{
+		pSource->pTailBlock->pNext = pPrev->pNext;
+		pPrev->pNext = pSource->pHeadBlock;
+	}
+
+	if( NULL == pSource->pTailBlock->pNext )
+	{
+		pList->pTailBlock = pSource->pTailBlock;
+	}
+
+	pList->Size += pSource->Size;
+	pList->pCursorBlock = NULL;
+
+	pSource->pHeadBlock = NULL;
+	pSource->pTailBlock = NULL;
+	pSource->pCursorBlock = NULL;
+	pSource->Size = 0;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledNext
+ * Description   : 展开链表版本的next
+ * Input         : list_t* pList
+                list_iter_t* pIter
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledNext(list_t* pList, list_iter_t* pIter)
+{
+	if( OPERATE_INVALID == pIter->Index )
+	{
+		pIter->pBlock = pList->pHeadBlock;
+		pIter->Offset = 0;
+	}
+	else if( NULL != pIter->pBlock )
+	{
+		if( ++pIter->Offset == pIter->pBlock->Count )
+		{
+			pIter->pBlock = pIter->pBlock->pNext;
+			pIter->Offset = 0;
+		}
+	}
+	else
+	{
+		return OPERATE_FALSE;
+	}
+
+	pIter->Index++;
+
+	return ( ( NULL != pIter->pBlock ) ? OPERATE_TRUE : OPERATE_FALSE );
+}
+
+/*****************************************************************************
+ * Function      : UnrolledDeref
+ * Description   : 展开链表版本的deref
+ * Input         : list_t* pList
+                list_iter_t* pIter
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledDeref(list_t* pList, list_iter_t* pIter)
+{
+	return ( ( NULL != pIter->pBlock ) ? BlockItem(pList, pIter->pBlock, pIter->Offset) : NULL );
+}
+
+/*****************************************************************************
+ * Function      : UnrolledIterInsertAfter
+ * Description   : 展开链表版本的iterinsertafter
+ * Input         : list_t* pList
+                list_iter_t* pIter
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 直接在迭代器所在块中插入，块已满时先从插入位置将其拆分，
+ 				   时间复杂度O(BlockItems)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData)
+{
+	block_t* pBlock = pIter->pBlock;
+	block_t* pNewBlock = NULL;
+	unsigned int offset = pIter->Offset + 1;
+
+	if( OPERATE_INVALID == pIter->Index )
+	{
+		return UnrolledInsertAt(pList, 0, pData);
+	}
+
+	if( pList->full(pList) || NULL == pBlock )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( pList->BlockItems == pBlock->Count )
+	{
+		pNewBlock = SplitBlock(pList, pBlock, offset);
+
+		if( NULL == pNewBlock )
+		{
+			return OPERATE_FAIL;
+		}
+
+		if( pList->BlockItems == offset )
+		{
+			pBlock = pNewBlock;
+			offset = 0;
+		}
+	}
+
+	memmove(BlockItem(pList, pBlock, offset + 1), BlockItem(pList, pBlock, offset),
+		( pBlock->Count - offset ) * pList->CarryDataSize);
+	memcpy(BlockItem(pList, pBlock, offset), pData, pList->CarryDataSize);
+	pBlock->Count++;
+	pList->Size++;
+
+	if( NULL != pList->pCursorBlock && pList->CursorIndex > pIter->Index )
+	{
+		pList->pCursorBlock = NULL;
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledIterEraseAfter
+ * Description   : 展开链表版本的itereraseafter
+ * Input         : list_t* pList
+                list_iter_t* pIter
+ * Output        : None
+ * Return        : static
+ * Others        : 被删除元素位于后继块且该块变空时直接摘除该块；不做块合并
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledIterEraseAfter(list_t* pList, list_iter_t* pIter)
+{
+	block_t* pBlock = pIter->pBlock;
+	unsigned int offset = pIter->Offset + 1;
+
+	if( OPERATE_INVALID == pIter->Index )
+	{
+		if( 0 == pList->Size )
+		{
+			return OPERATE_FAIL;
+		}
+
+		UnrolledRemoveAt(pList, 0);
+		return OPERATE_SUCC;
+	}
+
+	if( NULL == pBlock )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( offset == pBlock->Count )
+	{
+		pBlock = pBlock->pNext;
+		offset = 0;
+
+		if( NULL == pBlock )
+		{
+			return OPERATE_FAIL;
+		}
+	}
+
+	memmove(BlockItem(pList, pBlock, offset), BlockItem(pList, pBlock, offset + 1),
+		( pBlock->Count - offset - 1 ) * pList->CarryDataSize);
+	pBlock->Count--;
+	pList->Size--;
+
+	if( NULL != pList->pCursorBlock && ( pList->CursorIndex > pIter->Index || pList->pCursorBlock == pBlock ) )
+	{
+		pList->pCursorBlock = NULL;
+	}
+
+	if( 0 == pBlock->Count )
+	{
+		pIter->pBlock->pNext = pBlock->pNext;
+
+		if( pList->pTailBlock == pBlock )
+		{
+			pList->pTailBlock = pIter->pBlock;
+		}
+
+		FreeBlock(pList, pBlock);
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledRemoveIf
+ * Description   : 展开链表版本的removeif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                const void* pRef
+ * Output        : None
+ * Return        : static
+ * Others        : 逐块原地压缩保留的元素，变空的块随即释放，不做块合并
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static unsigned int UnrolledRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+{
+	block_t* pBlock = pList->pHeadBlock;
+	block_t* pPrev = NULL;
+	block_t* pErase = NULL;
+	unsigned int count = 0;
+	unsigned int keep = 0;
+	unsigned int offset = 0;
+
+	while( NULL != pBlock )
+	{
+		for( offset = 0, keep = 0; offset < pBlock->Count; offset++ )
+		{
+			if( exec(BlockItem(pList, pBlock, offset), pRef) )
+			{
+				continue;
+			}
+
+			if( keep != offset )
+			{
+				memcpy(BlockItem(pList, pBlock, keep), BlockItem(pList, pBlock, offset), pList->CarryDataSize);
+			}
+
+			keep++;
+		}
+
+		count += pBlock->Count - keep;
+		pBlock->Count = keep;
+
+		if( 0 != keep )
+		{
+			pPrev = pBlock;
+			pBlock = pBlock->pNext;
+			continue;
+		}
+
+		pErase = pBlock;
+		pBlock = pBlock->pNext;
+
+		if( NULL == pPrev )
+		{
+			pList->pHeadBlock = pBlock;
+		}
+		else
+		{
+			pPrev->pNext = pBlock;
+		}
+
+		FreeBlock(pList, pErase);
+	}
+
+	pList->pTailBlock = pPrev;
+	pList->pCursorBlock = NULL;
+	pList->Size -= count;
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledFindByKey
+ * Description   : 展开链表版本的findbykey
+ * Input         : list_t* pList
+                const void* pKey
+ * Output        : None
+ * Return        : static
+ * Others        : 块内元素会被移动，无法建立指向元素的哈希索引，因此按键顺序
+ 				   查找，时间复杂度O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* UnrolledFindByKey(list_t* pList, const void* pKey)
+{
+	block_t* pBlock = NULL;
+	unsigned int offset = 0;
+
+	if( NULL == pList->pHash )
+	{
+		return NULL;
+	}
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		for( offset = 0; offset < pBlock->Count; offset++ )
+		{
+			if( HashKeyEqual(pList->pHash, BlockItem(pList, pBlock, offset) + pList->pHash->KeyOffset, pKey) )
+			{
+				return BlockItem(pList, pBlock, offset);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************
+ * Function      : UnrolledCompact
+ * Description   : 展开链表版本的compact，将元素按顺序重新装入尽量少的满块
+ * Input         : list_t* pList  
+ * Output        : None
+ * Return        : static
+ * Others        : 经过多次中间插入/删除后块的填充率会下降，整理后除最后一块
+ 				   外每块都是满的；用户数据地址全部失效；分配失败时链表保持
+ 				   不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int UnrolledCompact(list_t* pList)
+{
+	block_t* pFirst = NULL;
+	block_t* pLast = NULL;
+	block_t* pBlock = NULL;
+	block_t* pNext = NULL;
+	unsigned int offset = 0;
+	unsigned int count = 0;
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pBlock->pNext )
+	{
+		for( offset = 0; offset < pBlock->Count; offset += count )
+		{
+			if( NULL == pLast || pList->BlockItems == pLast->Count )
+			{
+				pNext = AllocBlock(pList);
+
+				if( NULL == pNext )
+				{
+					for( ; NULL != pFirst; pFirst = pNext )
+					{
+						pNext = pFirst->pNext;
+						FreeBlock(pList, pFirst);
+					}
+
+					return OPERATE_FAIL;
+				}
+
+				if( NULL == pFirst )
+				{
+					pFirst = pNext;
+				}
+				else
+				{
+					pLast->pNext = pNext;
+				}
+
+				pLast = pNext;
+			}
+
+			count = pBlock->Count - offset;
+
+			if( count > pList->BlockItems - pLast->Count )
+			{
+				count = pList->BlockItems - pLast->Count;
+			}
+
+			memcpy(BlockItem(pList, pLast, pLast->Count), BlockItem(pList, pBlock, offset), count * pList->CarryDataSize);
+			pLast->Count += count;
+		}
+	}
+
+	for( pBlock = pList->pHeadBlock; NULL != pBlock; pBlock = pNext )
+	{
+		pNext = pBlock->pNext;
+		FreeBlock(pList, pBlock);
+	}
+
+	pList->pHeadBlock = pFirst;
+	pList->pTailBlock = pLast;
+	pList->pCursorBlock = NULL;
+	pList->Revision++;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : BindVectorOperations
+ * Description   : 内部实现接口，将链表容器的操作接口切换为连续存储(vector)的
+ 				   实现
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 全部元素按顺序存放在一块可增长的连续内存中，get/back/
+ 				   pushback/popback为O(1)(pushback均摊)，遍历为顺序访存；
+ 				   pushfront/popfront/insert/remove需要搬移其后的元素，为O(n)；
+ 				   size/capacity/resize/empty/full/insert/clear/destroy/
+ 				   pushfrontn/pushbackn/spliceafter/concat/beforebegin/begin/
+ 				   foreach2/foreachbatch/findifbatch/parallelforeach/countif/
+ 				   findall/popfrontcopy/savelist/loadlist/flush/locality与节点
+ 				   存储共用同一实现，setconcurrent/setreadmostly仅支持节点存储
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void BindVectorOperations(list_t* pList)
+{
+	pList->front = VectorFront;
+	pList->back = VectorBack;
+	pList->pushfront = VectorPushFront;
+	pList->pushback = VectorPushBack;
+	pList->popfront = VectorPopFront;
+	pList->popback = VectorPopBack;
+	pList->get = VectorGet;
+	pList->findif = VectorFindIf;
+	pList->findif2 = VectorFindIf2;
+	pList->findindexif = VectorFindIndexIf;
+	pList->remove = VectorRemove;
+	pList->assign = VectorAssign;
+	pList->insertafter = VectorInsertAfter;
+	pList->swap = VectorSwap;
+	pList->sortif = VectorSortIf;
+	pList->sortbykey = VectorSortByKey;
+	pList->parallelsortif = VectorParallelSortIf;
+	pList->foreach = VectorForeach;
+	pList->insertrange = VectorInsertRange;
+	pList->toarray = VectorToArray;
+	pList->splice = VectorSplice;
+	pList->next = VectorNext;
+	pList->deref = VectorDeref;
+	pList->iterinsertafter = VectorIterInsertAfter;
+	pList->itereraseafter = VectorIterEraseAfter;
+	pList->removeif = VectorRemoveIf;
+	pList->findbykey = VectorFindByKey;
+	pList->compact = VectorCompact;
+}
+
+/*****************************************************************************
+ * Function      : VectorItem
+ * Description   : 内部实现接口，返回连续存储中第index个元素的地址
+ * Input         : list_t* pList
+                unsigned int index
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static char* VectorItem(list_t* pList, unsigned int index)
+{
+	return pList->pVector + (size_t)index * pList->CarryDataSize;
+}
+
+/*****************************************************************************
+ * Function      : VectorResize
+ * Description   : 内部实现接口，将连续存储的容量调整为capacity个元素
+ * Input         : list_t* pList
+                unsigned int capacity  不小于Size
+ * Output        : None
+ * Return        : static
+ * Others        : 分配器没有realloc，申请新内存并拷贝后释放原内存，失败时
+ 				   原内存保持不变；capacity为0时释放全部内存
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorResize(list_t* pList, unsigned int capacity)
+{
+	char* pVector = NULL;
+
+	if( 0 != capacity )
+	{
+		if( (unsigned long long)capacity * pList->CarryDataSize > UINT_MAX )
+		{
+			return OPERATE_FAIL;
+		}
+
+		pVector = (char*)pList->Allocator.alloc(pList->Allocator.pContext, capacity * pList->CarryDataSize);
+
+		if( NULL == pVector )
+		{
+			return OPERATE_FAIL;
+		}
+
+		if( 0 != pList->Size )
+		{
+			memcpy(pVector, pList->pVector, (size_t)pList->Size * pList->CarryDataSize);
+		}
+	}
+
+	if( NULL != pList->pVector )
+	{
+		pList->Allocator.release(pList->Allocator.pContext, pList->pVector);
+	}
+
+	pList->pVector = pVector;
+	pList->VectorCapacity = capacity;
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : VectorReserve
+ * Description   : 内部实现接口，保证连续存储至少能容纳count个元素
+ * Input         : list_t* pList
+                unsigned int count
+ * Output        : None
+ * Return        : static
+ * Others        : 容量按两倍增长(最少LIST_VECTOR_INITIAL_ITEMS个)，不超过
+ 				   MaxSize；增长后之前返回的元素地址全部失效
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorReserve(list_t* pList, unsigned int count)
+{
+	unsigned long long capacity = pList->VectorCapacity;
+
+	if( count <= pList->VectorCapacity )
+	{
+		return OPERATE_SUCC;
+	}
+
+	capacity = ( capacity < LIST_VECTOR_INITIAL_ITEMS ) ? LIST_VECTOR_INITIAL_ITEMS : capacity * 2;
+
+	if( capacity > pList->MaxSize )
+	{
+		capacity = pList->MaxSize;
+	}
+
+	if( capacity < count )
+	{
+		capacity = count;
+	}
+
+	if( OPERATE_SUCC == VectorResize(pList, (unsigned int)capacity) )
+	{
+		return OPERATE_SUCC;
+	}
+
+	return ( ( capacity > count ) ? VectorResize(pList, count) : OPERATE_FAIL );
+}
+
+/*****************************************************************************
+ * Function      : VectorInsertAt
+ * Description   : 内部实现接口，在index处插入count个连续存放的元素
+ * Input         : list_t* pList
+                unsigned int index  0~size
+                const void* pData  可以指向本容器中的元素
+                unsigned int count
+ * Output        : None
+ * Return        : static
+ * Others        : 调用者负责检查容量；pData位于本容器内时先拷贝出来，避免
+ 				   扩容或搬移后失效；失败时容器保持不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorInsertAt(list_t* pList, unsigned int index, const void* pData, unsigned int count)
+{
+	const char* pSource = (const char*)pData;
+	char* pCopy = NULL;
+	size_t bytes = (size_t)count * pList->CarryDataSize;
+
+	if( 0 == count )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( NULL != pList->pVector && pSource + bytes > pList->pVector
+		&& pSource < pList->pVector + (size_t)pList->VectorCapacity * pList->CarryDataSize )
+	{
+		pCopy = (char*)pList->Allocator.alloc(pList->Allocator.pContext, bytes);
+
+		if( NULL == pCopy )
+		{
+			return OPERATE_FAIL;
+		}
+
+		memcpy(pCopy, pSource, bytes);
+		pSource = pCopy;
+	}
+
+	if( OPERATE_FAIL == VectorReserve(pList, pList->Size + count) )
+	{
+		if( NULL != pCopy )
+		{
+			pList->Allocator.release(pList->Allocator.pContext, pCopy);
+		}
+
+		return OPERATE_FAIL;
+	}
+
+	memmove(VectorItem(pList, index + count), VectorItem(pList, index), (size_t)( pList->Size - index ) * pList->CarryDataSize);
+	memcpy(VectorItem(pList, index), pSource, bytes);
+	pList->Size += count;
+	pList->Revision++;
+
+	if( NULL != pCopy )
+	{
+		pList->Allocator.release(pList->Allocator.pContext, pCopy);
+	}
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : VectorRemoveAt
+ * Description   : 内部实现接口，删除index处的元素，其后的元素前移
+ * Input         : list_t* pList
+                unsigned int index  小于size
+ * Output        : None
+ * Return        : static
+ * Others        : 不缩小容量，需要时调用compact
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void VectorRemoveAt(list_t* pList, unsigned int index)
+{
+	memmove(VectorItem(pList, index), VectorItem(pList, index + 1), (size_t)( pList->Size - index - 1 ) * pList->CarryDataSize);
+	pList->Size--;
+	pList->Revision++;
+}
+
+/*****************************************************************************
+ * Function      : VectorFront
+ * Description   : 连续存储版本的front
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 返回的地址在下一次插入或删除元素之前有效，其他返回元素地址
+ 				   的接口相同
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* VectorFront(list_t* pList)
+{
+	return ( ( 0 == pList->Size ) ? NULL : pList->pVector );
+}
+
+/*****************************************************************************
+ * Function      : VectorBack
+ * Description   : 连续存储版本的back
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* VectorBack(list_t* pList)
+{
+	return ( ( 0 == pList->Size ) ? NULL : VectorItem(pList, pList->Size - 1) );
+}
+
+/*****************************************************************************
+ * Function      : VectorPushFront
+ * Description   : 连续存储版本的pushfront
+ * Input         : list_t* pList
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 时间复杂度为O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorPushFront(list_t* pList, const void* pData)
+{
+	if( pList->full(pList) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return VectorInsertAt(pList, 0, pData, 1);
+}
+
+/*****************************************************************************
+ * Function      : VectorPushBack
+ * Description   : 连续存储版本的pushback
+ * Input         : list_t* pList
+                const void* pData
+ * Output        : None
+ * Return        : static
+ * Others        : 均摊时间复杂度为O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorPushBack(list_t* pList, const void* pData)
+{
+	if( pList->full(pList) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( pList->Size < pList->VectorCapacity )
+	{
+		memcpy(VectorItem(pList, pList->Size), pData, pList->CarryDataSize);
+		pList->Size++;
+		pList->Revision++;
+
+		return OPERATE_SUCC;
+	}
+
+	return VectorInsertAt(pList, pList->Size, pData, 1);
+}
+
+/*****************************************************************************
+ * Function      : VectorPopFront
+ * Description   : 连续存储版本的popfront
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 时间复杂度为O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorPopFront(list_t* pList)
+{
+	if( 0 == pList->Size )
+	{
+		return OPERATE_FAIL;
+	}
+
+	VectorRemoveAt(pList, 0);
+
+	return OPERATE_SUCC;
+}
+
+/*****************************************************************************
+ * Function      : VectorPopBack
+ * Description   : 连续存储版本的popback
+ * Input         : list_t* pList
+ * Output        : None
+ * Return        : static
+ * Others        : 时间复杂度为O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
 *****************************************************************************/
-static int OperatePopFront(list_t* pList)
+static int VectorPopBack(list_t* pList)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList))
+	if( 0 == pList->Size )
 	{
 		return OPERATE_FAIL;
 	}
 
-	pList->pHead = pScan->pNext;
 	pList->Size--;
-	LIST_FREE(pScan);
-	UpdateAllItemIndex(pList);
-	
+	pList->Revision++;
+
 	return OPERATE_SUCC;
 }
 
 /*****************************************************************************
- * Function      : OperatePopBack
- * Description   : 删除链表容器尾元素
- * Input         : list_t* pList  
+ * Function      : VectorGet
+ * Description   : 连续存储版本的get
+ * Input         : list_t* pList
+                unsigned int index
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 时间复杂度为O(1)
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperatePopBack(list_t* pList)
+static void* VectorGet(list_t* pList, unsigned int index)
 {
-	node_t* pScan = pList->pHead;
-	node_t* pPrev = pScan;
-	
-	if(pList->empty(pList))
-	{
-		return OPERATE_FAIL;
-	}
+	return ( ( pList->Size <= index ) ? NULL : VectorItem(pList, index) );
+}
 
-	if( NULL == pScan->pNext )
-	{
-		pList->pHead = pScan->pNext;
-		pList->Size--;
-		LIST_FREE(pScan);
-		
-		return OPERATE_SUCC;
-	}
+/*****************************************************************************
+ * Function      : VectorFindIf
+ * Description   : 连续存储版本的findif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*)
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void* VectorFindIf(list_t* pList, unsigned int(*exec)(const void*))
+{
+	char* pItem = pList->pVector;
+	unsigned int counter = 0;
 
-	while(NULL != pScan->pNext)
+	for( counter = 0; counter < pList->Size; counter++, pItem += pList->CarryDataSize )
 	{
-		pPrev = pScan;
-		pScan = pScan->pNext;
+		if( OPERATE_TRUE == exec(pItem) )
+		{
+			return pItem;
+		}
 	}
 
-	pPrev->pNext = NULL;
-	pList->Size--;
-	LIST_FREE(pScan);
-	
-	return OPERATE_SUCC;
+	return NULL;
 }
 
 /*****************************************************************************
- * Function      : OperateGet
- * Description   : 获取链表容器指定index处的元素，index从0开始
- * Input         : list_t* pList       
-                unsigned int index  
+ * Function      : VectorFindIf2
+ * Description   : 连续存储版本的findif2
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                const void* pRef
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static void* OperateGet(list_t* pList, unsigned int index)
+static void* VectorFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList) || pList->Size <= index)
-	{
-		return NULL;
-	}
+	char* pItem = pList->pVector;
+	unsigned int counter = 0;
 
-	do
+	for( counter = 0; counter < pList->Size; counter++, pItem += pList->CarryDataSize )
 	{
-		if(index == pScan->item.Index)
-		{		
-			return pScan->item.pData;
+		if( OPERATE_TRUE == exec(pItem, pRef) )
+		{
+			return pItem;
 		}
-		
-		pScan = pScan->pNext;
-		
-	}while(NULL != pScan);
-	
+	}
+
 	return NULL;
 }
 
 /*****************************************************************************
- * Function      : OperateFindIf
- * Description   : 按用户传入的函数指针的匹配条件查找并返回元素,未找到返回NULL
- * Input         : list_t* pList               
-                unsigned int(*exec)(const void*)  
+ * Function      : VectorFindIndexIf
+ * Description   : 连续存储版本的findindexif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                const void* pRef
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 与节点存储相同，容器为空时返回OPERATE_FAIL
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static void* OperateFindIf(list_t* pList, unsigned int(*exec)(const void*))
+static unsigned int VectorFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList))
+	char* pItem = pList->pVector;
+	unsigned int counter = 0;
+
+	if( 0 == pList->Size )
 	{
-		return NULL;
+		return OPERATE_FAIL;
 	}
 
-	do
+	for( counter = 0; counter < pList->Size; counter++, pItem += pList->CarryDataSize )
 	{
-		if(OPERATE_TRUE == exec( pScan->item.pData ))
-		{		
-			return pScan->item.pData;
+		if( OPERATE_TRUE == exec(pItem, pRef) )
+		{
+			return counter;
 		}
-		
-		pScan = pScan->pNext;
-		
-	}while(NULL != pScan);
-	
-	return NULL;
+	}
+
+	return OPERATE_INVALID;
 }
 
 /*****************************************************************************
- * Function      : OperateFindIf2
- * Description   : 按用户传入的函数指针与待查找内容的匹配条件查找并返回元素,若
- 				未找到返回NULL
+ * Function      : VectorRemove
+ * Description   : 连续存储版本的remove
  * Input         : list_t* pList
- 				unsigned int(*exec)(const void*, const void*)
- 				const void* pRef                 
+                unsigned int index
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
-
 *****************************************************************************/
-static void* OperateFindIf2(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+static int VectorRemove(list_t* pList, unsigned int index)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList))
+	if( pList->Size <= index )
 	{
-		return NULL;
+		return OPERATE_FAIL;
 	}
 
-	do
-	{
-		if(OPERATE_TRUE == exec( pScan->item.pData, pRef ))
-		{		
-			return pScan->item.pData;
-		}
-		
-		pScan = pScan->pNext;
-		
-	}while(NULL != pScan);
-	
-	return NULL;
+	VectorRemoveAt(pList, index);
+
+	return OPERATE_SUCC;
 }
 
 /*****************************************************************************
- * Function      : OperateFindIndexIf
- * Description   : 按用户传入的函数指针与待查找内容的匹配条件查找并返回所查找
- 				元素的index, 若未找到返回OPERATE_INVALID
- * Input         : list_t* pList              
-                unsigned int(*exec)(const void*, const void*)                     
-                const void* pRef                 
+ * Function      : VectorAssign
+ * Description   : 连续存储版本的assign
+ * Input         : list_t* pList
+                unsigned int index
+                const void* pData
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : pData可以是本容器中的元素
  * Record
- * 1.Date        : 20170323
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static unsigned int OperateFindIndexIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
+static int VectorAssign(list_t* pList, unsigned int index, const void* pData)
 {
-	node_t* pScan = pList->pHead;
-	
-	if(pList->empty(pList))
+	if( pList->Size <= index )
 	{
 		return OPERATE_FAIL;
 	}
 
-	do
-	{
-		if(OPERATE_TRUE == exec( pScan->item.pData, pRef ))
-		{		
-			return pScan->item.Index;
-		}
-		
-		pScan = pScan->pNext;
-		
-	}while(NULL != pScan);
-	
-	return OPERATE_INVALID;
+	memmove(VectorItem(pList, index), pData, pList->CarryDataSize);
+
+	return OPERATE_SUCC;
 }
 
 /*****************************************************************************
- * Function      : OperateRemove
- * Description   : 删除链表容器指定index处的元素
- * Input         : list_t* pList       
-                unsigned int index  
+ * Function      : VectorInsertAfter
+ * Description   : 连续存储版本的insertafter
+ * Input         : list_t* pList
+                unsigned int index
+                const void* pData
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateRemove(list_t* pList, unsigned int index)
+static int VectorInsertAfter(list_t* pList, unsigned int index, const void* pData)
 {
-	node_t* pScan = pList->pHead;
-	node_t* pPrev = NULL;
-	
-	if(pList->empty(pList) || pList->Size <= index)
+	if( pList->full(pList) || pList->Size <= index )
 	{
 		return OPERATE_FAIL;
 	}
 
-	if(index == pScan->item.Index)
-	{
-		pList->pHead = pScan->pNext;
-		pList->Size--;
-		LIST_FREE(pScan);
-		UpdateAllItemIndex(pList);
-		
-		return OPERATE_SUCC;
-	}
+	return VectorInsertAt(pList, index + 1, pData, 1);
+}
 
-	while(NULL != pScan->pNext)
+/*****************************************************************************
+ * Function      : VectorSwap
+ * Description   : 连续存储版本的swap
+ * Input         : list_t* pList
+                unsigned int index1
+                unsigned int index2
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorSwap(list_t* pList, unsigned int index1, unsigned int index2)
+{
+	if((index1 == index2) || (pList->Size <= index1) || (pList->Size <= index2) || (pList->Size <= 1))
 	{
-		pPrev = pScan;
-		pScan = pScan->pNext;
-
-		if(index == pScan->item.Index)
-		{
-			pPrev->pNext = pScan->pNext;
-			pList->Size--;
-			LIST_FREE(pScan);
-			UpdateAllItemIndex(pList);
-
-			return OPERATE_SUCC;
-		}
+		return OPERATE_FAIL;
 	}
-	
-	return OPERATE_FAIL;
+
+	return SwapData(pList, VectorItem(pList, index1), VectorItem(pList, index2));
 }
 
 /*****************************************************************************
- * Function      : OperateAssign
- * Description   : 用新元素对链表容器指定index处的元素进行替换
- * Input         : list_t* pList       
-                unsigned int index  
-                const void* pData   
+ * Function      : CollectVectorItems
+ * Description   : 内部实现接口，申请一个指针数组并按顺序填入全部元素的地址，
+ 				   数组后半部分留作排序的辅助空间
+ * Input         : list_t* pList
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 同CollectUnrolledItems，数组字节数超出size_t表示范围或分配
+ 				   失败时返回NULL
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 数组大小按size_t计算并检查溢出
 *****************************************************************************/
-static int OperateAssign(list_t* pList, unsigned int index, const void* pData)
+static char** CollectVectorItems(list_t* pList)
 {
-	node_t* pScan = pList->pHead;
+	char** ppItems = NULL;
+	unsigned int counter = 0;
 
-	if(pList->empty(pList) || pList->Size <= index)
+	if( (unsigned long long)pList->Size * 2 * sizeof(char*) > (size_t)-1 )
 	{
-		return OPERATE_FAIL;
+		return NULL;
 	}
 
-	while( index != pScan->item.Index )
+	ppItems = (char**)pList->Allocator.alloc(pList->Allocator.pContext, (size_t)2 * pList->Size * sizeof(char*));
+
+	if( NULL == ppItems )
 	{
-		if(NULL == pScan->pNext)
-		{
-			return OPERATE_FAIL;
-		}
+		return NULL;
+	}
 
-		pScan = pScan->pNext;
+	for( counter = 0; counter < pList->Size; counter++ )
+	{
+		ppItems[counter] = VectorItem(pList, counter);
 	}
 
-	memcpy( pScan->item.pData, pData, pList->CarryDataSize );
-	return OPERATE_SUCC;
+	return ppItems;
 }
 
 /*****************************************************************************
- * Function      : OperateInsert
- * Description   : 在链表容器指定index处的元素之前插入一个元素
- * Input         : list_t* pList       
-                unsigned int index  
-                const void* pData   
+ * Function      : RebuildVector
+ * Description   : 内部实现接口，按ppItems给出的顺序将元素拷贝到新的连续内存，
+ 				   并释放原有的内存
+ * Input         : list_t* pList
+                char** ppItems  Size个元素地址
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 申请失败时原有数据保持不变
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 数据大小按size_t计算
 *****************************************************************************/
-static int OperateInsert(list_t* pList, unsigned int index, const void* pData)
+static int RebuildVector(list_t* pList, char** ppItems)
 {
-	node_t* pNewNode = (node_t*)LIST_MALLOC(sizeof(node_t) + pList->CarryDataSize);
-	item_t* pItem = NULL;
-	node_t* pScan = pList->pHead;
-	node_t* pPrev = NULL;
+	char* pVector = (char*)pList->Allocator.alloc(pList->Allocator.pContext, (size_t)pList->VectorCapacity * pList->CarryDataSize);
+	char* pDst = pVector;
+	unsigned int counter = 0;
 
-	if( NULL == pNewNode )
+	if( NULL == pVector )
 	{
 		return OPERATE_FAIL;
 	}
 
-	if( pList->full(pList) || pList->empty(pList) || pList->Size <= index)
+	for( counter = 0; counter < pList->Size; counter++, pDst += pList->CarryDataSize )
 	{
-		return OPERATE_FAIL;
+		memcpy(pDst, ppItems[counter], pList->CarryDataSize);
 	}
 
-	pItem = PackageDataWithAutoIndex( pNewNode, pData, pList );
-	CopyItemToNode(pNewNode, pItem);
-	pNewNode->pNext = NULL;
+	pList->Allocator.release(pList->Allocator.pContext, pList->pVector);
+	pList->pVector = pVector;
+	pList->Revision++;
 
-	while( index != pScan->item.Index )
-	{
-		if(NULL == pScan->pNext)
-		{
-			return OPERATE_FAIL;
-		}
+	return OPERATE_SUCC;
+}
 
-		pPrev = pScan;
-		pScan = pScan->pNext;
-	}
+/*****************************************************************************
+ * Function      : VectorSortIf
+ * Description   : 连续存储版本的sortif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+ * Output        : None
+ * Return        : static
+ * Others        : 经由MergeSortItems对元素地址排序后按序拷贝到新内存，稳定；
+ 				   需临时申请2*Size个指针及一份数据的空间，申请失败时容器保持
+ 				   不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void VectorSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*))
+{
+	char** ppItems = NULL;
 
-	if( NULL == pPrev )
-	{
-		pList->pushfront(pList, pData);
-	}
-	else
+	if( 1 >= pList->Size || NULL == ( ppItems = CollectVectorItems(pList) ) )
 	{
-		pList->insertafter(pList, pPrev->item.Index, pData);
+		return;
 	}
-	
-	return OPERATE_SUCC;
+
+	RebuildVector(pList, MergeSortItems(ppItems, pList->Size, exec));
+	pList->Allocator.release(pList->Allocator.pContext, ppItems);
 }
 
 /*****************************************************************************
- * Function      : OperateInsertAfter
- * Description   : 在链表容器指定index处的元素之后插入一个元素
- * Input         : list_t* pList       
-                unsigned int index  
-                const void* pData   
+ * Function      : VectorSortByKey
+ * Description   : 连续存储版本的sortbykey
+ * Input         : list_t* pList
+                unsigned int key_offset
+                unsigned int key_width
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 经由RadixSortItems排序，临时空间同VectorSortIf
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateInsertAfter(list_t* pList, unsigned int index, const void* pData)
+static int VectorSortByKey(list_t* pList, unsigned int key_offset, unsigned int key_width)
 {
-	node_t* pNewNode = (node_t*)LIST_MALLOC(sizeof(node_t) + pList->CarryDataSize);
-	item_t* pItem = NULL;
-	node_t* pScan = pList->pHead;
+	char** ppItems = NULL;
+	int result = OPERATE_SUCC;
 
-	if( NULL == pNewNode )
+	if( !IsValidKey(pList, key_offset, key_width) )
 	{
 		return OPERATE_FAIL;
 	}
 
-	if( pList->full(pList) || pList->empty(pList) || pList->Size <= index)
+	if( 1 >= pList->Size )
 	{
-		return OPERATE_FAIL;
+		return OPERATE_SUCC;
 	}
 
-	pItem = PackageDataWithAutoIndex( pNewNode, pData, pList );
-	CopyItemToNode(pNewNode, pItem);
-	pNewNode->pNext = NULL;
+	ppItems = CollectVectorItems(pList);
 
-	while( index != pScan->item.Index )
+	if( NULL == ppItems )
 	{
-		if(NULL == pScan->pNext)
-		{
-			return OPERATE_FAIL;
-		}
-
-		pScan = pScan->pNext;
+		return OPERATE_FAIL;
 	}
-	
-	pNewNode->pNext = pScan->pNext;
-	pScan->pNext = pNewNode;
-	
-	pList->Size++;
-	UpdateAllItemIndex(pList);
-	
-	return OPERATE_SUCC;
+
+	result = RebuildVector(pList, RadixSortItems(ppItems, pList->Size, key_offset, key_width));
+	pList->Allocator.release(pList->Allocator.pContext, ppItems);
+
+	return result;
 }
 
 /*****************************************************************************
- * Function      : OperateSwap
- * Description   : 交换链表容器指定的两个index处的元素的内容，以交换节点携带的
- 				   数据而非交换节点本身的方式实现
- * Input         : list_t* pList        
-                unsigned int index1  
-                unsigned int index2  
+ * Function      : VectorParallelSortIf
+ * Description   : 连续存储版本的parallelsortif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                unsigned int thread_count
+                unsigned int serial_threshold
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 同展开链表，退化为sortif
  * Record
- * 1.Date        : 20170322
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateSwap(list_t* pList, unsigned int index1, unsigned int index2)
+static void VectorParallelSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*), unsigned int thread_count, unsigned int serial_threshold)
 {
-	node_t* pScan1 = pList->pHead;
-	node_t* pScan2 = pList->pHead;
-	char* pTmpData = (char*)LIST_MALLOC(pList->CarryDataSize);
+	(void)thread_count;
+	(void)serial_threshold;
 
-	if((index1 == index2) || (pList->Size <= index1) || (pList->Size <= index2) || (pList->Size <= 1))
-	{
-		return OPERATE_FAIL;
-	}
+	pList->sortif(pList, exec);
+}
 
-	while( index1 != pScan1->item.Index )
-	{
-		if(NULL == pScan1->pNext)
-		{
-			return OPERATE_FAIL;
-		}
+/*****************************************************************************
+ * Function      : VectorForeach
+ * Description   : 连续存储版本的foreach
+ * Input         : list_t* pList
+                void(*exec)(void*)
+ * Output        : None
+ * Return        : static
+ * Others        : 
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static void VectorForeach(list_t* pList, void(*exec)(void*))
+{
+	char* pItem = pList->pVector;
+	unsigned int counter = 0;
 
-		pScan1 = pScan1->pNext;
+	for( counter = 0; counter < pList->Size; counter++, pItem += pList->CarryDataSize )
+	{
+		exec(pItem);
 	}
-	
-	memcpy(pTmpData, pScan1->item.pData, pList->CarryDataSize);
+}
 
-	while( index2 != pScan2->item.Index )
+/*****************************************************************************
+ * Function      : VectorInsertRange
+ * Description   : 连续存储版本的insertrange
+ * Input         : list_t* pList
+                unsigned int index
+                const void* pData
+                unsigned int count
+ * Output        : None
+ * Return        : static
+ * Others        : 一次扩容、一次搬移，全部插入或都不插入
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+static int VectorInsertRange(list_t* pList, unsigned int index, const void* pData, unsigned int count)
+{
+	if( pList->Size < index || pList->MaxSize < pList->Size || pList->MaxSize - pList->Size < count )
 	{
-		if(NULL == pScan2->pNext)
-		{
-			return OPERATE_FAIL;
-		}
-
-		pScan2 = pScan2->pNext;
+		return OPERATE_FAIL;
 	}
 
-	memcpy(pScan1->item.pData, pScan2->item.pData, pList->CarryDataSize);
-	memcpy(pScan2->item.pData, pTmpData, pList->CarryDataSize);
-	LIST_FREE(pTmpData);
-	
-	return OPERATE_SUCC;
+	return VectorInsertAt(pList, index, pData, count);
 }
 
 /*****************************************************************************
- * Function      : OperateSortIf
- * Description   : 按用户传入的函数指针指定的比较方法来重新排列链表容器
- * Input         : list_t* pList              
-                unsigned int(*exec)(const void*, const void*)                     
+ * Function      : VectorToArray
+ * Description   : 连续存储版本的toarray
+ * Input         : list_t* pList
+                void* pBuffer
+                unsigned int capacity
  * Output        : None
  * Return        : static
- * Others        : 节点携带数据容量较大时，本sort方法效率不高，因受制于swap方法
+ * Others        : 一次整段拷贝
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static void OperateSortIf(list_t* pList, unsigned int(*exec)(const void*, const void*))
+static unsigned int VectorToArray(list_t* pList, void* pBuffer, unsigned int capacity)
 {
-	node_t* pScan1 = pList->pHead;
-	node_t* pScan2 = NULL;
+	unsigned int count = ( capacity < pList->Size ) ? capacity : pList->Size;
 
-	if( 1 >= pList->size(pList) )
+	if( 0 != count )
 	{
-		return;
+		memcpy(pBuffer, pList->pVector, (size_t)count * pList->CarryDataSize);
 	}
 
-	for( ; NULL != pScan1->pNext; pScan1 = pScan1->pNext )
-	{
-		for( pScan2 = pScan1->pNext; NULL != pScan2; pScan2 = pScan2->pNext )
-		{
-			if( OPERATE_TRUE == exec( pScan1->item.pData, pScan2->item.pData ) )
-			{
-				pList->swap(pList, pScan1->item.Index, pScan2->item.Index);
-			}
-		}
-	}
+	return count;
 }
 
 /*****************************************************************************
- * Function      : OperateSize
- * Description   : 链表容器当前含有的元素个数
- * Input         : list_t* pList  
+ * Function      : VectorSplice
+ * Description   : 连续存储版本的splice
+ * Input         : list_t* pList
+                unsigned int index
+                list_t* pSource
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : pSource同为连续存储时整段插入后清空pSource；否则逐个拷贝
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static unsigned int OperateSize(list_t* pList)
+static int VectorSplice(list_t* pList, unsigned int index, list_t* pSource)
 {
-	return pList->Size;
+	if( OPERATE_FALSE == IsSpliceValid(pList, index, pSource) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	if( 0 == pSource->Size )
+	{
+		return OPERATE_SUCC;
+	}
+
+	if( LIST_STORAGE_VECTOR != pSource->Storage )
+	{
+		return SpliceByCopy(pList, index, pSource);
+	}
+
+	if( OPERATE_FAIL == VectorInsertAt(pList, index, pSource->pVector, pSource->Size) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	pSource->Size = 0;
+	pSource->Revision++;
+
+	return OPERATE_SUCC;
 }
 
 /*****************************************************************************
- * Function      : OperateCapacity
- * Description   : 链表容器最多可以携带的元素个数
- * Input         : list_t* pList  
+ * Function      : VectorNext
+ * Description   : 连续存储版本的next
+ * Input         : list_t* pList
+                list_iter_t* pIter
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 迭代器只保存下标，插入删除后仍指向同一位置
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static unsigned int OperateCapacity(list_t* pList)
+static int VectorNext(list_t* pList, list_iter_t* pIter)
 {
-	return pList->MaxSize;
+	if( OPERATE_INVALID != pIter->Index && pList->Size <= pIter->Index )
+	{
+		return OPERATE_FALSE;
+	}
+
+	pIter->Index++;
+
+	return ( ( pIter->Index < pList->Size ) ? OPERATE_TRUE : OPERATE_FALSE );
 }
 
 /*****************************************************************************
- * Function      : OperateResize
- * Description   : 重新设置链表容器最多可以携带的元素个数
- * Input         : list_t* pList          
-                unsigned int new_size  
+ * Function      : VectorDeref
+ * Description   : 连续存储版本的deref
+ * Input         : list_t* pList
+                list_iter_t* pIter
  * Output        : None
  * Return        : static
- * Others        : 从链表容器后面截断，此操作可能会导致元素丢失
+ * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static void OperateResize(list_t* pList, unsigned int new_size)
+static void* VectorDeref(list_t* pList, list_iter_t* pIter)
 {
-	pList->MaxSize = new_size;
-
-	while( pList->Size > pList->MaxSize )
-	{
-		pList->popback(pList);
-	}
+	return ( ( pIter->Index < pList->Size ) ? VectorItem(pList, pIter->Index) : NULL );
 }
 
 /*****************************************************************************
- * Function      : OperateEmpty
- * Description   : 链表容器当前是否为空
- * Input         : const list_t* pList  
+ * Function      : VectorIterInsertAfter
+ * Description   : 连续存储版本的iterinsertafter
+ * Input         : list_t* pList
+                list_iter_t* pIter
+                const void* pData
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateEmpty(list_t* pList)
+static int VectorIterInsertAfter(list_t* pList, list_iter_t* pIter, const void* pData)
 {
-	return ( ( 0 == pList->Size ) ? 1 : 0 );
+	if( pList->full(pList) || ( OPERATE_INVALID != pIter->Index && pList->Size <= pIter->Index ) )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return VectorInsertAt(pList, pIter->Index + 1, pData, 1);
 }
 
 /*****************************************************************************
- * Function      : OperateFull
- * Description   : 链表容器当前是否为满
- * Input         : list_t* pList  
+ * Function      : VectorIterEraseAfter
+ * Description   : 连续存储版本的itereraseafter
+ * Input         : list_t* pList
+                list_iter_t* pIter
  * Output        : None
  * Return        : static
  * Others        : 
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateFull(list_t* pList)
+static int VectorIterEraseAfter(list_t* pList, list_iter_t* pIter)
 {
-	return ( ( pList->size(pList) < pList->capacity(pList) ) ? 0 : 1 );
+	unsigned int index = pIter->Index + 1;
+
+	if( OPERATE_INVALID != pIter->Index && pList->Size <= pIter->Index )
+	{
+		return OPERATE_FAIL;
+	}
+
+	return VectorRemove(pList, index);
 }
 
 /*****************************************************************************
- * Function      : OperateClear
- * Description   : 清空链表容器数据，但不销毁链表
- * Input         : list_t* pList  
+ * Function      : VectorRemoveIf
+ * Description   : 连续存储版本的removeif
+ * Input         : list_t* pList
+                unsigned int(*exec)(const void*, const void*)
+                const void* pRef
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 一趟原地压缩保留的元素，时间复杂度O(n)
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateClear(list_t* pList)
+static unsigned int VectorRemoveIf(list_t* pList, unsigned int(*exec)(const void*, const void*), const void* pRef)
 {
-	node_t* pScan = pList->pHead;
-	node_t* pErase = NULL;
-	
-	if(NULL == pList)
+	unsigned int keep = 0;
+	unsigned int counter = 0;
+	unsigned int count = 0;
+
+	for( counter = 0; counter < pList->Size; counter++ )
 	{
-		return OPERATE_SUCC;
+		if( exec(VectorItem(pList, counter), pRef) )
+		{
+			continue;
+		}
+
+		if( keep != counter )
+		{
+			memcpy(VectorItem(pList, keep), VectorItem(pList, counter), pList->CarryDataSize);
+		}
+
+		keep++;
 	}
 
-	while(NULL != pScan)
+	count = pList->Size - keep;
+	pList->Size = keep;
+
+	if( 0 != count )
 	{
-		pErase = pScan;
-		pScan = pScan->pNext;
-		LIST_FREE(pErase);
+		pList->Revision++;
 	}
 
-	pList->Size = 0;
-	pList->pHead = NULL;
-	
-	return OPERATE_SUCC;	
+	return count;
 }
 
 /*****************************************************************************
- * Function      : OperateDestroy
- * Description   : 销毁链表容器
- * Input         : list_t** pList  
+ * Function      : VectorFindByKey
+ * Description   : 连续存储版本的findbykey
+ * Input         : list_t* pList
+                const void* pKey
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 同展开链表，元素会被移动，按键顺序查找，时间复杂度O(n)
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static int OperateDestroy(list_t** ppList)
+static void* VectorFindByKey(list_t* pList, const void* pKey)
 {
-	node_t* pScan = (*ppList)->pHead;
-	node_t* pErase = NULL;
-	
-	if(NULL == *ppList)
+	unsigned int counter = 0;
+
+	if( NULL == pList->pHash )
 	{
-		return OPERATE_SUCC;
+		return NULL;
 	}
 
-	while(NULL != pScan)
+	for( counter = 0; counter < pList->Size; counter++ )
 	{
-		pErase = pScan;
-		pScan = pScan->pNext;
-		LIST_FREE(pErase);
+		if( HashKeyEqual(pList->pHash, VectorItem(pList, counter) + pList->pHash->KeyOffset, pKey) )
+		{
+			return VectorItem(pList, counter);
+		}
 	}
 
-	(*ppList)->Size = 0;
-	(*ppList)->MaxSize = 0;
-	(*ppList)->CarryDataSize = 0;
-	(*ppList)->pHead = NULL;
-	LIST_FREE(*ppList);
-	*ppList = NULL;
-	
-	return OPERATE_SUCC;	
+	return NULL;
 }
 
 /*****************************************************************************
- * Function      : OperateForeach
- * Description   : 将链表容器的每个用户数据依次传递传递至用户传入的函数指针
- * Input         : list_t* pList       
-                void(*exec)(void*)  
+ * Function      : VectorCompact
+ * Description   : 连续存储版本的compact，将容量收缩到当前元素个数
+ * Input         : list_t* pList
  * Output        : None
  * Return        : static
- * Others        : 
+ * Others        : 元素本已连续存放，此处只归还多余的容量；元素地址全部失效
  * Record
- * 1.Date        : 20170321
- *   Author      : bingshuizhilian@yeah.net
+ * 1.Date        : 20261018
+ *   Author      : agent@local
  *   Modification: Created function
 *****************************************************************************/
-static void OperateForeach(list_t* pList, void(*exec)(void*))
+static int VectorCompact(list_t* pList)
 {
-	node_t* pScan = pList->pHead;
-
-	for( ; NULL != pScan; pScan = pScan->pNext )
+	if( pList->Size == pList->VectorCapacity )
 	{
-		exec(pScan->item.pData);
+		return OPERATE_SUCC;
 	}
+
+	return VectorResize(pList, pList->Size);
 }
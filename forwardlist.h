@@ -8,8 +8,44 @@
 #else //else of WIN32
 #include "limits.h"
 //insert your essential includes
+#ifndef LIST_USE_PTHREAD
+#define LIST_USE_PTHREAD 1
+#endif
+#ifndef LIST_USE_MMAP
+#define LIST_USE_MMAP 1
+#endif
 #endif //end of WIN32
 
+#ifndef LIST_USE_PTHREAD
+#define LIST_USE_PTHREAD 0
+#endif
+
+#ifndef LIST_USE_MMAP
+#define LIST_USE_MMAP 0
+#endif
+
+#include "stdio.h"
+
+#if LIST_USE_PTHREAD
+#include "pthread.h"
+#endif
+
+#ifndef LIST_MALLOC
+#define LIST_MALLOC malloc
+#endif
+
+#ifndef LIST_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define LIST_PREFETCH(addr) __builtin_prefetch( (addr) )
+#else
+#define LIST_PREFETCH(addr) ( (void)(addr) )
+#endif
+#endif
+
+#ifndef LIST_FREE
+#define LIST_FREE free
+#endif
+
 #define OPERATE_SUCC 1
 #define OPERATE_FAIL 0
 
@@ -18,9 +54,106 @@
 
 #define OPERATE_INVALID UINT_MAX
 
+#define LIST_RADIX_BITS 8
+#define LIST_RADIX_BUCKETS ( 1 << LIST_RADIX_BITS )
+
+#define LIST_SORT_MAX_THREADS 64
+
+#define LIST_STORAGE_NODE 0
+#define LIST_STORAGE_UNROLLED 1
+#define LIST_STORAGE_PERSIST 2
+#define LIST_STORAGE_VECTOR 3
+
+#define LIST_UNROLLED_DEFAULT_ITEMS 16
+
+#define LIST_VECTOR_INITIAL_ITEMS 16
+
+#define LIST_SKIP_MAX_LEVEL 16
+#define LIST_SKIP_CURSOR_WINDOW 16
+#define LIST_SKIP_SEED 2463534242U
+
+#define LIST_HASH_INITIAL_SLOTS 16
+#define LIST_HASH_FNV_BASIS 2166136261U
+#define LIST_HASH_FNV_PRIME 16777619U
+
+#define LIST_TRAVERSE_BATCH 16
+
+#define LIST_TRAVERSE_FOREACH 0
+#define LIST_TRAVERSE_COUNT 1
+#define LIST_TRAVERSE_COLLECT 2
+
+#define LIST_PARALLEL_CHUNKS_PER_THREAD 4
+#define LIST_PARALLEL_MAX_CHUNKS ( LIST_SORT_MAX_THREADS * LIST_PARALLEL_CHUNKS_PER_THREAD )
+
+#ifndef LIST_PARALLEL_MIN_CHUNK
+#define LIST_PARALLEL_MIN_CHUNK 1024
+#endif
+
+#ifndef LIST_HAS_ATOMIC
+#if defined(__GNUC__) || defined(__clang__)
+#define LIST_HAS_ATOMIC 1
+#else
+#define LIST_HAS_ATOMIC 0
+#endif
+#endif
+
+#if LIST_HAS_ATOMIC
+#define LIST_ATOMIC_LOAD(p) __atomic_load_n( (p), __ATOMIC_ACQUIRE )
+#define LIST_ATOMIC_LOAD_RELAXED(p) __atomic_load_n( (p), __ATOMIC_RELAXED )
+#define LIST_ATOMIC_STORE_RELAXED(p, v) __atomic_store_n( (p), (v), __ATOMIC_RELAXED )
+#define LIST_ATOMIC_CAS(p, pExpected, v) __atomic_compare_exchange_n( (p), (pExpected), (v), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+#define LIST_ATOMIC_ADD(p, v) __atomic_add_fetch( (p), (v), __ATOMIC_RELAXED )
+#define LIST_ATOMIC_SUB(p, v) __atomic_sub_fetch( (p), (v), __ATOMIC_RELAXED )
+#define LIST_ATOMIC_STORE(p, v) __atomic_store_n( (p), (v), __ATOMIC_RELEASE )
+#define LIST_ATOMIC_FENCE() __atomic_thread_fence( __ATOMIC_SEQ_CST )
+#define LIST_ATOMIC_FENCE_ACQUIRE() __atomic_thread_fence( __ATOMIC_ACQUIRE )
+#else //else of LIST_HAS_ATOMIC
+#define LIST_ATOMIC_LOAD(p) ( *(p) )
+#define LIST_ATOMIC_LOAD_RELAXED(p) ( *(p) )
+#define LIST_ATOMIC_STORE_RELAXED(p, v) ( *(p) = (v) )
+#define LIST_ATOMIC_CAS(p, pExpected, v) ( ( *(p) == *(pExpected) ) ? ( *(p) = (v), 1 ) : ( *(pExpected) = *(p), 0 ) )
+#define LIST_ATOMIC_ADD(p, v) ( *(p) += (v) )
+#define LIST_ATOMIC_SUB(p, v) ( *(p) -= (v) )
+#define LIST_ATOMIC_STORE(p, v) ( *(p) = (v) )
+#define LIST_ATOMIC_FENCE() ( (void)0 )
+#define LIST_ATOMIC_FENCE_ACQUIRE() ( (void)0 )
+#endif //end of LIST_HAS_ATOMIC
+
+//setconcurrent ABA tag: 16 bits on 64-bit platforms, wraps every 65536 head updates
+#if defined(__LP64__) || defined(_WIN64)
+#define LIST_TAG_SHIFT 48
+#else
+#define LIST_TAG_SHIFT 32
+#endif
+
+#define LIST_CACHE_LINE 64
+
+#define LIST_EBR_MAX_READERS 64
+#define LIST_EBR_BUCKETS 3
+#define LIST_EBR_COLLECT_THRESHOLD 64
+#define LIST_EBR_EPOCH_MASK 0x7FFFFFFFU
+
+#define LIST_SHARD_DEFAULT_COUNT 16
+
+#define LIST_SNAPSHOT_MAGIC 0x54534C46U
+#define LIST_SNAPSHOT_VERSION 1
+#define LIST_SNAPSHOT_BUFFER ( 1 << 20 )
+
+#define LIST_PERSIST_MAGIC 0x50534C46U
+#define LIST_PERSIST_VERSION 1
+#define LIST_PERSIST_DATA_START 128
+#define LIST_PERSIST_INITIAL_SIZE ( 1 << 16 )
+
+#define LIST_COMPACT_SLAB_NODES 256
+#define LIST_LOCALITY_MAX_DISTANCE ( 1ULL << 32 )
+
+#define LIST_POOL_ALIGN 8
+#define LIST_POOL_ROUNDUP(size) ( ( (size) + LIST_POOL_ALIGN - 1 ) & ~( LIST_POOL_ALIGN - 1 ) )
+
+#define LIST_STATS_HEADER 16
+
 typedef struct data
 {
-	unsigned int Index;
 	void* pData;
 }item_t;
 
@@ -30,6 +163,218 @@ typedef struct node
 	struct node* pNext;
 }node_t;
 
+typedef struct block
+{
+	struct block* pNext;
+	unsigned int Count;
+}block_t;
+
+typedef struct skip_link
+{
+	struct skip_tower* pNext;
+	unsigned int Span;
+}skip_link_t;
+
+typedef struct skip_tower
+{
+	node_t* pNode;
+	unsigned int Level;
+	skip_link_t Links[1];
+}skip_tower_t;
+
+typedef struct allocator
+{
+	void* (*alloc)(void*, size_t);
+	void (*release)(void*, void*);
+	void* pContext;
+}list_allocator_t;
+
+typedef struct list_alloc_stats
+{
+	list_allocator_t Inner;
+	unsigned long long Allocs;
+	unsigned long long Releases;
+	unsigned long long LiveBytes;
+	unsigned long long PeakBytes;
+}list_alloc_stats_t;
+
+typedef struct slab
+{
+	struct slab* pNext;
+}slab_t;
+
+typedef struct pool
+{
+	slab_t* pSlabs;
+	node_t* pFreeNodes;
+	char* pCarve;
+	unsigned int CarveLeft;
+	unsigned int NodeSize;
+	unsigned int NodesPerSlab;
+}pool_t;
+
+typedef struct hash_slot
+{
+	node_t* pNode;
+	unsigned int Hash;
+}hash_slot_t;
+
+typedef struct hash_index
+{
+	hash_slot_t* pSlots;
+	unsigned int Capacity;
+	unsigned int Count;
+	unsigned int KeyOffset;
+	unsigned int KeyWidth;
+	unsigned int (*hash)(const void*);
+	unsigned int (*keyequal)(const void*, const void*);
+}hash_index_t;
+
+typedef struct sort_task
+{
+	node_t* pHead;
+	node_t* pTail;
+	node_t* pRight;
+	unsigned int Count;
+	unsigned int(*exec)(const void*, const void*);
+}sort_task_t;
+
+typedef struct list_iter
+{
+	node_t* pNode;
+	block_t* pBlock;
+	unsigned int Offset;
+	unsigned int Index;
+	unsigned long long Position;
+}list_iter_t;
+
+typedef struct traverse_job
+{
+	struct list* pList;
+	list_iter_t Splits[LIST_PARALLEL_MAX_CHUNKS];
+	unsigned int ChunkCount;
+	unsigned int ThreadCount;
+	unsigned int Mode;
+	void (*exec)(void*, void*);
+	void* pContext;
+	unsigned int (*match)(const void*, const void*);
+	const void* pRef;
+	void** ppOutput;
+	unsigned int Capacity;
+	unsigned int Counts[LIST_PARALLEL_MAX_CHUNKS];
+	unsigned int Offsets[LIST_PARALLEL_MAX_CHUNKS];
+}traverse_job_t;
+
+#if LIST_USE_PTHREAD
+typedef struct worker_pool
+{
+	pthread_t Threads[LIST_SORT_MAX_THREADS];
+	unsigned int ThreadCount;
+	unsigned int Started;
+	unsigned int Active;
+	pthread_mutex_t Lock;
+	pthread_cond_t WakeCond;
+	pthread_cond_t DoneCond;
+	void (*run)(void*, unsigned int);
+	void* pJob;
+	unsigned int TaskCount;
+	unsigned int NextTask;
+	unsigned int Pending;
+	int Shutdown;
+}worker_pool_t;
+#endif //end of LIST_USE_PTHREAD
+
+typedef struct reader_slot
+{
+	unsigned int Epoch;
+	char Padding[LIST_CACHE_LINE - sizeof(unsigned int)];
+}reader_slot_t;
+
+typedef struct reclaim
+{
+	reader_slot_t Slots[LIST_EBR_MAX_READERS];
+	unsigned int GlobalEpoch;
+	unsigned int NextSlot;
+	unsigned int Bucket;
+	unsigned int PendingCount;
+	node_t** ppRetired[LIST_EBR_BUCKETS];
+	unsigned int RetiredCount[LIST_EBR_BUCKETS];
+	unsigned int RetiredCapacity[LIST_EBR_BUCKETS];
+}reclaim_t;
+
+typedef struct snapshot_header
+{
+	unsigned int Magic;
+	unsigned int Version;
+	unsigned int CarryDataSize;
+	unsigned int Size;
+	unsigned int MaxSize;
+	unsigned int Reserved;
+}snapshot_header_t;
+
+typedef struct snapshot
+{
+	FILE* pStream;
+	char* pBuffer;
+	unsigned int Capacity;
+	unsigned int Count;
+	unsigned int CarryDataSize;
+	unsigned long long Sum1;
+	unsigned long long Sum2;
+	int Failed;
+}snapshot_t;
+
+typedef struct persist_header
+{
+	unsigned int Magic;
+	unsigned int Version;
+	unsigned int CarryDataSize;
+	unsigned int NodeSize;
+	unsigned int MaxSize;
+	unsigned int Size;
+	unsigned int Dirty;
+	unsigned int Reserved;
+	unsigned long long Head;
+	unsigned long long Tail;
+	unsigned long long Free;
+	unsigned long long Bump;
+	unsigned long long FileSize;
+}persist_header_t;
+
+typedef struct persist_node
+{
+	unsigned long long Next;
+}persist_node_t;
+
+typedef struct persist
+{
+	int Fd;
+	char* pBase;
+	unsigned long long MapSize;
+}persist_t;
+
+typedef struct locality
+{
+	const char* pPrev;
+	unsigned long long Sum;
+	unsigned long long Count;
+}locality_t;
+
+typedef struct list_attr
+{
+	const list_allocator_t* pAllocator;
+	unsigned int PoolNodesPerSlab;
+	unsigned int Storage;
+	unsigned int BlockItems;
+	unsigned int SkipIndex;
+	unsigned int HashIndex;
+	unsigned int HashKeyOffset;
+	unsigned int HashKeyWidth;
+	unsigned int (*hash)(const void*);
+	unsigned int (*keyequal)(const void*, const void*);
+	unsigned int CursorCache;
+}list_attr_t;
+
 typedef struct list
 {
 //private:
@@ -37,6 +382,35 @@ typedef struct list
 	unsigned int MaxSize;
 	unsigned int CarryDataSize;
 	node_t* pHead;
+	node_t* pTail;
+	node_t* pCursor;
+	unsigned int CursorIndex;
+	unsigned int CursorSeq;
+	unsigned int CursorCache;
+	list_allocator_t Allocator;
+	pool_t* pPool;
+	unsigned int Storage;
+	unsigned int BlockItems;
+	block_t* pHeadBlock;
+	block_t* pTailBlock;
+	block_t* pCursorBlock;
+	skip_tower_t* pSkipHeader;
+	unsigned int SkipLevel;
+	unsigned int SkipSeed;
+	hash_index_t* pHash;
+	unsigned int Revision;
+	struct worker_pool* pWorkers;
+	list_iter_t* pSplits;
+	unsigned int SplitChunks;
+	unsigned int SplitRevision;
+	unsigned int SplitBuilding;
+	unsigned int Concurrent;
+	unsigned long long ConcurrentHead;
+	unsigned long long ConcurrentFree;
+	reclaim_t* pReclaim;
+	persist_t* pPersist;
+	char* pVector;
+	unsigned int VectorCapacity;
 //public:
 	void* (*front)(struct list*);
 	void* (*back)(struct list*);
@@ -54,6 +428,8 @@ typedef struct list
 	int (*insertafter)(struct list*, unsigned int, const void*);
 	int (*swap)(struct list*, unsigned int, unsigned int);
 	void (*sortif)(struct list*, unsigned int(*)(const void*, const void*));
+	int (*sortbykey)(struct list*, unsigned int, unsigned int);
+	void (*parallelsortif)(struct list*, unsigned int(*)(const void*, const void*), unsigned int, unsigned int);
 	unsigned int (*size)(struct list*);
 	unsigned int (*capacity)(struct list*);
 	void (*resize)(struct list*, unsigned int);
@@ -62,11 +438,83 @@ typedef struct list
 	int (*clear)(struct list*);
 	int (*destroy)(struct list**);
 	void (*foreach)(struct list*, void(*)(void*));
+	int (*pushfrontn)(struct list*, const void*, unsigned int);
+	int (*pushbackn)(struct list*, const void*, unsigned int);
+	int (*insertrange)(struct list*, unsigned int, const void*, unsigned int);
+	unsigned int (*toarray)(struct list*, void*, unsigned int);
+	//splice/spliceafter/concat relink nodes only when both lists share storage, allocator and
+	//pool usage (both pooled or both not; compact turns a pool on), otherwise they copy item by item
+	int (*splice)(struct list*, unsigned int, struct list*);
+	int (*spliceafter)(struct list*, unsigned int, struct list*);
+	int (*concat)(struct list*, struct list*);
+	void (*beforebegin)(struct list*, list_iter_t*);
+	int (*begin)(struct list*, list_iter_t*);
+	int (*next)(struct list*, list_iter_t*);
+	void* (*deref)(struct list*, list_iter_t*);
+	int (*iterinsertafter)(struct list*, list_iter_t*, const void*);
+	int (*itereraseafter)(struct list*, list_iter_t*);
+	unsigned int (*removeif)(struct list*, unsigned int(*)(const void*, const void*), const void*);
+	void* (*findbykey)(struct list*, const void*);
+	void (*foreach2)(struct list*, void(*)(void*, void*), void*);
+	void (*foreachbatch)(struct list*, void(*)(void**, unsigned int, void*), void*);
+	void* (*findifbatch)(struct list*, unsigned int(*)(void**, unsigned int, void*), void*);
+	void (*parallelforeach)(struct list*, void(*)(void*, void*), void*, unsigned int);
+	unsigned int (*countif)(struct list*, unsigned int(*)(const void*, const void*), const void*, unsigned int);
+	unsigned int (*findall)(struct list*, unsigned int(*)(const void*, const void*), const void*, void**, unsigned int, unsigned int);
+	int (*popfrontcopy)(struct list*, void*);
+	int (*setconcurrent)(struct list*, int);
+	unsigned int (*readbegin)(struct list*);
+	void (*readend)(struct list*, unsigned int);
+	int (*setreadmostly)(struct list*, int);
+	int (*savelist)(struct list*, FILE*);
+	int (*loadlist)(struct list*, FILE*);
+	int (*flush)(struct list*);
+	int (*compact)(struct list*);
+	unsigned long long (*locality)(struct list*);
 }list_t;
 
+typedef struct shard
+{
+	list_t* pList;
+#if LIST_USE_PTHREAD
+	pthread_mutex_t Lock;
+#endif
+	char Padding[LIST_CACHE_LINE];
+}shard_t;
+
+typedef struct shard_list
+{
+//private:
+	shard_t* pShards;
+	unsigned int ShardCount;
+	unsigned int ShardMaxSize;
+	unsigned int CarryDataSize;
+	unsigned int NextShard;
+	list_allocator_t Allocator;
+	list_attr_t Attr;
+	unsigned int HasAttr;
+	unsigned int (*route)(const void*);
+//public:
+	int (*push)(struct shard_list*, const void*);
+	unsigned int (*size)(struct shard_list*);
+	void (*foreach)(struct shard_list*, void(*)(void*, void*), void*);
+	unsigned int (*drain)(struct shard_list*, void(*)(void*, void*), void*);
+	int (*destroy)(struct shard_list**);
+}shard_list_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 list_t* CreateList( unsigned int max_size, unsigned int carry_data_size );
-static int UpdateAllItemIndex(list_t* pList);
-static item_t* PackageDataWithAutoIndex(node_t* pNode, const void* pData, list_t* pList);
+list_t* CreateListEx( unsigned int max_size, unsigned int carry_data_size, const list_attr_t* pAttr );
+shard_list_t* CreateShardList( unsigned int max_size, unsigned int carry_data_size, unsigned int shard_count,
+	const list_attr_t* pAttr, unsigned int (*route)(const void*) );
+list_t* OpenPersistList( const char* pPath, unsigned int max_size, unsigned int carry_data_size );
+void InitCountingAllocator( list_allocator_t* pAllocator, list_alloc_stats_t* pStats, const list_allocator_t* pInner );
+#ifdef __cplusplus
+}
+#endif
+static item_t* PackageData(node_t* pNode, const void* pData, list_t* pList);
 static void CopyItemToNode(node_t* pNode, const item_t* pItem);
 static void* OperateFront(list_t* pList);
 static void* OperateBack(list_t* pList);
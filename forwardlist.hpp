@@ -0,0 +1,1631 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : forwardlist.hpp
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 前向链表容器的C++模板实现，仅需包含本头文件
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 与forwardlist.h的list_t相比，元素类型在编译期确定，数据经由
+ 				   T的构造/移动而非memcpy搬移，谓词与比较器以模板参数传入，可被
+ 				   编译器内联；操作的名称、index语义以及sortif比较器的约定
+ 				   (comp(a, b)为true表示a应排在b之后)与list_t保持一致，返回
+ 				   OPERATE_SUCC/OPERATE_FAIL的操作在此返回true/false；
+ 				   并发、只读模式、持久化、快照、哈希索引、多线程遍历与排序、
+ 				   批量回调等依赖C运行时实现的操作不提供
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+
+#ifndef __FORWARDLIST_HPP__
+#define __FORWARDLIST_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename T, typename Alloc = std::allocator<T> >
+class forwardlist
+{
+private:
+	struct node_base
+	{
+		node_base* pNext;
+	};
+
+	struct node : node_base
+	{
+		T Data;
+
+		template <typename... Args>
+		explicit node(Args&&... args) : node_base(), Data(std::forward<Args>(args)...) {}
+	};
+
+	typedef typename std::allocator_traits<Alloc>::template rebind_alloc<node> node_allocator;
+	typedef std::allocator_traits<node_allocator> node_traits;
+
+	template <bool Const>
+	class iter
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef T value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef typename std::conditional<Const, const T*, T*>::type pointer;
+		typedef typename std::conditional<Const, const T&, T&>::type reference;
+
+		iter() : pNode(nullptr) {}
+		iter(const iter<false>& other) : pNode(other.pNode) {}
+
+		reference operator*() const { return static_cast<node*>(pNode)->Data; }
+		pointer operator->() const { return &static_cast<node*>(pNode)->Data; }
+		iter& operator++() { pNode = pNode->pNext; return *this; }
+		iter operator++(int) { iter old(*this); pNode = pNode->pNext; return old; }
+
+		friend bool operator==(const iter& lhs, const iter& rhs) { return lhs.pNode == rhs.pNode; }
+		friend bool operator!=(const iter& lhs, const iter& rhs) { return lhs.pNode != rhs.pNode; }
+
+	private:
+		explicit iter(node_base* pStart) : pNode(pStart) {}
+
+		node_base* pNode;
+
+		friend class forwardlist;
+		friend class iter<!Const>;
+	};
+
+public:
+	typedef T value_type;
+	typedef Alloc allocator_type;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef iter<false> iterator;
+	typedef iter<true> const_iterator;
+
+	static const size_type npos = static_cast<size_type>(-1);
+
+	explicit forwardlist(size_type max_size = npos, const Alloc& alloc = Alloc());
+	forwardlist(const forwardlist& other);
+	forwardlist(forwardlist&& other) noexcept;
+	~forwardlist();
+
+	forwardlist& operator=(const forwardlist& other);
+	forwardlist& operator=(forwardlist&& other);
+	void swap(forwardlist& other) noexcept;
+	allocator_type get_allocator() const { return allocator_type(Allocator); }
+
+	T* front();
+	const T* front() const;
+	T* back();
+	const T* back() const;
+	bool pushfront(const T& data) { return emplacefront(data); }
+	bool pushfront(T&& data) { return emplacefront(std::move(data)); }
+	bool pushback(const T& data) { return emplaceback(data); }
+	bool pushback(T&& data) { return emplaceback(std::move(data)); }
+	template <typename... Args> bool emplacefront(Args&&... args);
+	template <typename... Args> bool emplaceback(Args&&... args);
+	bool popfront();
+	bool popback();
+	bool popfrontcopy(T& out);
+	T* get(size_type index);
+	const T* get(size_type index) const;
+	template <typename Pred> T* findif(Pred pred);
+	template <typename Pred, typename Ref> T* findif2(Pred pred, const Ref& ref);
+	template <typename Pred, typename Ref> size_type findindexif(Pred pred, const Ref& ref) const;
+	bool remove(size_type index);
+	bool assign(size_type index, const T& data);
+	bool assign(size_type index, T&& data);
+	bool insert(size_type index, const T& data) { return emplace(index, data); }
+	bool insert(size_type index, T&& data) { return emplace(index, std::move(data)); }
+	template <typename... Args> bool emplace(size_type index, Args&&... args);
+	bool insertafter(size_type index, const T& data);
+	bool insertafter(size_type index, T&& data);
+	bool swap(size_type index1, size_type index2);
+	template <typename Compare> void sortif(Compare comp);
+	void sort() { sortif(std::greater<T>()); }
+	template <typename Key> void sortbykey(Key key);
+	size_type size() const { return Size; }
+	size_type capacity() const { return MaxSize; }
+	void resize(size_type new_size);
+	bool empty() const { return 0 == Size; }
+	bool full() const { return Size >= MaxSize; }
+	void clear();
+	template <typename Fn> void foreach(Fn fn);
+	bool pushfrontn(const T* pData, size_type count) { return insertrange(0, pData, count); }
+	bool pushbackn(const T* pData, size_type count) { return insertrange(Size, pData, count); }
+	bool insertrange(size_type index, const T* pData, size_type count);
+	size_type toarray(T* pBuffer, size_type capacity) const;
+	bool splice(size_type index, forwardlist& source);
+	bool spliceafter(size_type index, forwardlist& source);
+	bool concat(forwardlist& source) { return splice(Size, source); }
+	iterator beforebegin() { return iterator(&Head); }
+	const_iterator beforebegin() const { return const_iterator(const_cast<node_base*>(&Head)); }
+	iterator begin() { return iterator(Head.pNext); }
+	const_iterator begin() const { return const_iterator(Head.pNext); }
+	const_iterator cbegin() const { return begin(); }
+	iterator end() { return iterator(); }
+	const_iterator end() const { return const_iterator(); }
+	const_iterator cend() const { return end(); }
+	iterator iterinsertafter(const_iterator pos, const T& data) { return emplaceafter(pos, data); }
+	iterator iterinsertafter(const_iterator pos, T&& data) { return emplaceafter(pos, std::move(data)); }
+	template <typename... Args> iterator emplaceafter(const_iterator pos, Args&&... args);
+	iterator itereraseafter(const_iterator pos);
+	template <typename Pred, typename Ref> size_type removeif(Pred pred, const Ref& ref);
+	template <typename Pred, typename Ref> size_type countif(Pred pred, const Ref& ref) const;
+	template <typename Pred, typename Ref> size_type findall(Pred pred, const Ref& ref, T** ppOutput, size_type capacity);
+
+private:
+	template <typename... Args> node* CreateNode(Args&&... args);
+	void DestroyNode(node_base* pNode);
+	node_base* LocateNode(size_type index);
+	node_base* LocateNode(size_type index) const;
+	node_base* LocatePrev(size_type index);
+	void LinkAfter(node_base* pPrev, node_base* pFirst, node_base* pLast, size_type count);
+	void EraseAfter(node_base* pPrev);
+	void Steal(forwardlist& other);
+
+	node_allocator Allocator;
+	node_base Head;
+	node_base* pTail;
+	size_type Size;
+	size_type MaxSize;
+	node_base* pCursor;
+	size_type CursorIndex;
+};
+
+template <typename T, typename Alloc>
+const typename forwardlist<T, Alloc>::size_type forwardlist<T, Alloc>::npos;
+
+/*****************************************************************************
+ * Function      : forwardlist::forwardlist
+ * Description   : 创建容量为max_size的空链表容器，对应CreateList
+ * Input         : size_type max_size  缺省时不限制容量
+                const Alloc& alloc
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+forwardlist<T, Alloc>::forwardlist(size_type max_size, const Alloc& alloc)
+	: Allocator(alloc), pTail(&Head), Size(0), MaxSize(max_size), pCursor(nullptr), CursorIndex(0)
+{
+	Head.pNext = nullptr;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::forwardlist
+ * Description   : 拷贝构造，逐个拷贝other的元素，容量与other相同
+ * Input         : const forwardlist& other
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+forwardlist<T, Alloc>::forwardlist(const forwardlist& other)
+	: Allocator(node_traits::select_on_container_copy_construction(other.Allocator)),
+	  pTail(&Head), Size(0), MaxSize(other.MaxSize), pCursor(nullptr), CursorIndex(0)
+{
+	const node_base* pScan = other.Head.pNext;
+
+	Head.pNext = nullptr;
+
+	try
+	{
+		for( ; nullptr != pScan; pScan = pScan->pNext )
+		{
+			emplaceback(static_cast<const node*>(pScan)->Data);
+		}
+	}
+	catch( ... )
+	{
+		clear();
+		throw;
+	}
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::forwardlist
+ * Description   : 移动构造，直接接管other的全部节点，other变为空
+ * Input         : forwardlist&& other
+ * Output        : None
+ * Return        :
+ * Others        : 时间复杂度O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+forwardlist<T, Alloc>::forwardlist(forwardlist&& other) noexcept
+	: Allocator(std::move(other.Allocator)), pTail(&Head), Size(0), MaxSize(other.MaxSize), pCursor(nullptr), CursorIndex(0)
+{
+	Head.pNext = nullptr;
+	Steal(other);
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::~forwardlist
+ * Description   : 销毁链表容器，对应destroy
+ * Input         : None
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+forwardlist<T, Alloc>::~forwardlist()
+{
+	clear();
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::operator=
+ * Description   : 拷贝赋值，清空后逐个拷贝other的元素，容量与other相同
+ * Input         : const forwardlist& other
+ * Output        : None
+ * Return        :
+ * Others        : 不传播分配器
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+forwardlist<T, Alloc>& forwardlist<T, Alloc>::operator=(const forwardlist& other)
+{
+	const node_base* pScan = other.Head.pNext;
+
+	if( this == &other )
+	{
+		return *this;
+	}
+
+	clear();
+	MaxSize = other.MaxSize;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		emplaceback(static_cast<const node*>(pScan)->Data);
+	}
+
+	return *this;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::operator=
+ * Description   : 移动赋值，分配器相等时直接接管other的全部节点，否则逐个移动
+ 				   元素，完成后other为空
+ * Input         : forwardlist&& other
+ * Output        : None
+ * Return        :
+ * Others        : 不传播分配器
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+forwardlist<T, Alloc>& forwardlist<T, Alloc>::operator=(forwardlist&& other)
+{
+	node_base* pScan = other.Head.pNext;
+
+	if( this == &other )
+	{
+		return *this;
+	}
+
+	clear();
+	MaxSize = other.MaxSize;
+
+	if( Allocator == other.Allocator )
+	{
+		Steal(other);
+		return *this;
+	}
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		emplaceback(std::move(static_cast<node*>(pScan)->Data));
+	}
+
+	other.clear();
+
+	return *this;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::swap
+ * Description   : 交换两个链表容器的全部内容
+ * Input         : forwardlist& other
+ * Output        : None
+ * Return        :
+ * Others        : 时间复杂度O(1)，同时交换分配器
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::swap(forwardlist& other) noexcept
+{
+	using std::swap;
+
+	swap(Allocator, other.Allocator);
+	swap(Head.pNext, other.Head.pNext);
+	swap(pTail, other.pTail);
+	swap(Size, other.Size);
+	swap(MaxSize, other.MaxSize);
+
+	if( pTail == &other.Head )
+	{
+		pTail = &Head;
+	}
+
+	if( other.pTail == &Head )
+	{
+		other.pTail = &other.Head;
+	}
+
+	pCursor = nullptr;
+	other.pCursor = nullptr;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::front
+ * Description   : 返回首元素的地址，容器为空时返回NULL
+ * Input         : None
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+T* forwardlist<T, Alloc>::front()
+{
+	return ( ( nullptr == Head.pNext ) ? nullptr : &static_cast<node*>(Head.pNext)->Data );
+}
+
+template <typename T, typename Alloc>
+const T* forwardlist<T, Alloc>::front() const
+{
+	return const_cast<forwardlist*>(this)->front();
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::back
+ * Description   : 返回尾元素的地址，容器为空时返回NULL
+ * Input         : None
+ * Output        : None
+ * Return        :
+ * Others        : 时间复杂度O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+T* forwardlist<T, Alloc>::back()
+{
+	return ( ( 0 == Size ) ? nullptr : &static_cast<node*>(pTail)->Data );
+}
+
+template <typename T, typename Alloc>
+const T* forwardlist<T, Alloc>::back() const
+{
+	return const_cast<forwardlist*>(this)->back();
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::emplacefront
+ * Description   : 以args在头部原地构造一个元素
+ * Input         : Args&&... args
+ * Output        : None
+ * Return        :
+ * Others        : 容器已满时返回false；pushfront经由此实现
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename... Args>
+bool forwardlist<T, Alloc>::emplacefront(Args&&... args)
+{
+	node_base* pNode = nullptr;
+
+	if( full() )
+	{
+		return false;
+	}
+
+	pNode = CreateNode(std::forward<Args>(args)...);
+	LinkAfter(&Head, pNode, pNode, 1);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::emplaceback
+ * Description   : 以args在尾部原地构造一个元素
+ * Input         : Args&&... args
+ * Output        : None
+ * Return        :
+ * Others        : 容器已满时返回false；pushback经由此实现，时间复杂度O(1)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename... Args>
+bool forwardlist<T, Alloc>::emplaceback(Args&&... args)
+{
+	node_base* pNode = nullptr;
+
+	if( full() )
+	{
+		return false;
+	}
+
+	pNode = CreateNode(std::forward<Args>(args)...);
+	LinkAfter(pTail, pNode, pNode, 1);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::popfront
+ * Description   : 删除首元素
+ * Input         : None
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::popfront()
+{
+	if( 0 == Size )
+	{
+		return false;
+	}
+
+	EraseAfter(&Head);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::popback
+ * Description   : 删除尾元素
+ * Input         : None
+ * Output        : None
+ * Return        :
+ * Others        : 需定位尾元素的前驱，时间复杂度O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::popback()
+{
+	if( 0 == Size )
+	{
+		return false;
+	}
+
+	EraseAfter(LocatePrev(Size - 1));
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::popfrontcopy
+ * Description   : 将首元素移动到out后删除首元素
+ * Input         : T& out
+ * Output        : None
+ * Return        :
+ * Others        : 容器为空时返回false，out不变
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::popfrontcopy(T& out)
+{
+	if( 0 == Size )
+	{
+		return false;
+	}
+
+	out = std::move(static_cast<node*>(Head.pNext)->Data);
+	EraseAfter(&Head);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::get
+ * Description   : 返回index处元素的地址，index越界时返回NULL
+ * Input         : size_type index
+ * Output        : None
+ * Return        :
+ * Others        : 与list_t相同，记录上次定位的位置，顺序访问时均摊O(1)，此时
+ 				   get是修改容器的操作；const版本不读写该位置，每次从首节点
+ 				   开始查找，多个线程可同时经由const引用读取
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: const版本不再更新游标
+*****************************************************************************/
+template <typename T, typename Alloc>
+T* forwardlist<T, Alloc>::get(size_type index)
+{
+	return ( ( Size <= index ) ? nullptr : &static_cast<node*>(LocateNode(index))->Data );
+}
+
+template <typename T, typename Alloc>
+const T* forwardlist<T, Alloc>::get(size_type index) const
+{
+	return ( ( Size <= index ) ? nullptr : &static_cast<const node*>(LocateNode(index))->Data );
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::findif
+ * Description   : 返回第一个满足pred(元素)的元素地址，未找到时返回NULL
+ * Input         : Pred pred
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Pred>
+T* forwardlist<T, Alloc>::findif(Pred pred)
+{
+	node_base* pScan = Head.pNext;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		if( pred(static_cast<node*>(pScan)->Data) )
+		{
+			return &static_cast<node*>(pScan)->Data;
+		}
+	}
+
+	return nullptr;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::findif2
+ * Description   : 返回第一个满足pred(元素, ref)的元素地址，未找到时返回NULL
+ * Input         : Pred pred
+                const Ref& ref
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Pred, typename Ref>
+T* forwardlist<T, Alloc>::findif2(Pred pred, const Ref& ref)
+{
+	node_base* pScan = Head.pNext;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		if( pred(static_cast<node*>(pScan)->Data, ref) )
+		{
+			return &static_cast<node*>(pScan)->Data;
+		}
+	}
+
+	return nullptr;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::findindexif
+ * Description   : 返回第一个满足pred(元素, ref)的元素的index，未找到时返回npos
+ * Input         : Pred pred
+                const Ref& ref
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Pred, typename Ref>
+typename forwardlist<T, Alloc>::size_type forwardlist<T, Alloc>::findindexif(Pred pred, const Ref& ref) const
+{
+	const node_base* pScan = Head.pNext;
+	size_type index = 0;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext, index++ )
+	{
+		if( pred(static_cast<const node*>(pScan)->Data, ref) )
+		{
+			return index;
+		}
+	}
+
+	return npos;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::remove
+ * Description   : 删除index处的元素
+ * Input         : size_type index
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::remove(size_type index)
+{
+	if( Size <= index )
+	{
+		return false;
+	}
+
+	EraseAfter(LocatePrev(index));
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::assign
+ * Description   : 以data替换index处的元素
+ * Input         : size_type index
+                const T& data / T&& data
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::assign(size_type index, const T& data)
+{
+	if( Size <= index )
+	{
+		return false;
+	}
+
+	static_cast<node*>(LocateNode(index))->Data = data;
+
+	return true;
+}
+
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::assign(size_type index, T&& data)
+{
+	if( Size <= index )
+	{
+		return false;
+	}
+
+	static_cast<node*>(LocateNode(index))->Data = std::move(data);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::emplace
+ * Description   : 在index处的元素之前以args原地构造一个元素
+ * Input         : size_type index
+                Args&&... args
+ * Output        : None
+ * Return        :
+ * Others        : 与list_t的insert相同，要求index小于size；insert经由此实现
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename... Args>
+bool forwardlist<T, Alloc>::emplace(size_type index, Args&&... args)
+{
+	node_base* pNode = nullptr;
+
+	if( full() || Size <= index )
+	{
+		return false;
+	}
+
+	pNode = CreateNode(std::forward<Args>(args)...);
+	LinkAfter(LocatePrev(index), pNode, pNode, 1);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::insertafter
+ * Description   : 在index处的元素之后插入一个元素
+ * Input         : size_type index
+                const T& data / T&& data
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::insertafter(size_type index, const T& data)
+{
+	node_base* pNode = nullptr;
+
+	if( full() || Size <= index )
+	{
+		return false;
+	}
+
+	pNode = CreateNode(data);
+	LinkAfter(LocateNode(index), pNode, pNode, 1);
+
+	return true;
+}
+
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::insertafter(size_type index, T&& data)
+{
+	node_base* pNode = nullptr;
+
+	if( full() || Size <= index )
+	{
+		return false;
+	}
+
+	pNode = CreateNode(std::move(data));
+	LinkAfter(LocateNode(index), pNode, pNode, 1);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::swap
+ * Description   : 交换index1与index2处元素的内容
+ * Input         : size_type index1
+                size_type index2
+ * Output        : None
+ * Return        :
+ * Others        : 与list_t相同，两个index相同或越界时返回false；经由swap交换
+ 				   元素，T可移动时不拷贝
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::swap(size_type index1, size_type index2)
+{
+	using std::swap;
+	T* pData1 = nullptr;
+
+	if( index1 == index2 || Size <= index1 || Size <= index2 )
+	{
+		return false;
+	}
+
+	if( index1 > index2 )
+	{
+		swap(index1, index2);
+	}
+
+	pData1 = &static_cast<node*>(LocateNode(index1))->Data;
+	swap(*pData1, static_cast<node*>(LocateNode(index2))->Data);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::sortif
+ * Description   : 按comp指定的比较方法重新排列链表容器
+ * Input         : Compare comp  comp(a, b)为true表示a应排在b之后，例如
+                std::greater<T>得到升序
+ * Output        : None
+ * Return        :
+ * Others        : 与list_t相同，自底向上的归并排序，稳定，只重新链接节点，
+ 				   不移动元素、不申请内存，时间复杂度O(nlogn)；comp以模板参数
+ 				   传入，可被内联
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Compare>
+void forwardlist<T, Alloc>::sortif(Compare comp)
+{
+	node_base* pList = Head.pNext;
+	node_base* pLeft = nullptr;
+	node_base* pRight = nullptr;
+	node_base* pPick = nullptr;
+	node_base* pLast = nullptr;
+	node_base merged;
+	size_type width = 1;
+	size_type runs = 0;
+	size_type left = 0;
+	size_type right = 0;
+
+	if( 1 >= Size )
+	{
+		return;
+	}
+
+	do
+	{
+		pLeft = pList;
+		pLast = &merged;
+		runs = 0;
+
+		while( nullptr != pLeft )
+		{
+			runs++;
+			pRight = pLeft;
+
+			for( left = 0; left < width && nullptr != pRight; left++ )
+			{
+				pRight = pRight->pNext;
+			}
+
+			right = width;
+
+			while( 0 != left || ( 0 != right && nullptr != pRight ) )
+			{
+				if( 0 == left )
+				{
+					pPick = pRight;
+					pRight = pRight->pNext;
+					right--;
+				}
+				else if( 0 == right || nullptr == pRight
+					|| !comp(static_cast<node*>(pLeft)->Data, static_cast<node*>(pRight)->Data) )
+				{
+					pPick = pLeft;
+					pLeft = pLeft->pNext;
+					left--;
+				}
+				else
+				{
+					pPick = pRight;
+					pRight = pRight->pNext;
+					right--;
+				}
+
+				pLast->pNext = pPick;
+				pLast = pPick;
+			}
+
+			pLeft = pRight;
+		}
+
+		pLast->pNext = nullptr;
+		pList = merged.pNext;
+		width *= 2;
+	}while( runs > 1 );
+
+	Head.pNext = pList;
+	pTail = pLast;
+	pCursor = nullptr;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::sortbykey
+ * Description   : 按key(元素)的返回值升序重新排列链表容器
+ * Input         : Key key  返回值须支持operator<
+ * Output        : None
+ * Return        :
+ * Others        : list_t按字节键做基数排序，此处以投影函数代替键的偏移与宽度，
+ 				   经由sortif实现，稳定
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Key>
+void forwardlist<T, Alloc>::sortbykey(Key key)
+{
+	sortif([&key](const T& lhs, const T& rhs) { return key(rhs) < key(lhs); });
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::resize
+ * Description   : 将容量修改为new_size，元素个数超出时删除尾部多余的元素
+ * Input         : size_type new_size
+ * Output        : None
+ * Return        :
+ * Others        : list_t逐个popback，此处一次定位后截断，时间复杂度O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::resize(size_type new_size)
+{
+	node_base* pKeep = nullptr;
+
+	MaxSize = new_size;
+
+	if( Size <= new_size )
+	{
+		return;
+	}
+
+	pKeep = LocatePrev(new_size);
+
+	while( nullptr != pKeep->pNext )
+	{
+		EraseAfter(pKeep);
+	}
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::clear
+ * Description   : 清空链表容器，容量不变
+ * Input         : None
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::clear()
+{
+	node_base* pScan = Head.pNext;
+	node_base* pErase = nullptr;
+
+	while( nullptr != pScan )
+	{
+		pErase = pScan;
+		pScan = pScan->pNext;
+		DestroyNode(pErase);
+	}
+
+	Head.pNext = nullptr;
+	pTail = &Head;
+	Size = 0;
+	pCursor = nullptr;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::foreach
+ * Description   : 依次以每个元素调用fn
+ * Input         : Fn fn
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Fn>
+void forwardlist<T, Alloc>::foreach(Fn fn)
+{
+	node_base* pScan = Head.pNext;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		fn(static_cast<node*>(pScan)->Data);
+	}
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::insertrange
+ * Description   : 在index处的元素之前按顺序插入pData开始的count个元素，index
+ 				   等于size时添加到尾部
+ * Input         : size_type index  0~size
+                const T* pData
+                size_type count
+ * Output        : None
+ * Return        :
+ * Others        : 先构造好全部节点再一次链接，容量不足或构造失败时不插入任何
+ 				   元素；pushfrontn/pushbackn经由此实现
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::insertrange(size_type index, const T* pData, size_type count)
+{
+	node_base chain;
+	node_base* pLast = &chain;
+	size_type counter = 0;
+
+	if( Size < index || MaxSize < Size || MaxSize - Size < count )
+	{
+		return false;
+	}
+
+	if( 0 == count )
+	{
+		return true;
+	}
+
+	chain.pNext = nullptr;
+
+	try
+	{
+		for( counter = 0; counter < count; counter++ )
+		{
+			pLast->pNext = CreateNode(pData[counter]);
+			pLast = pLast->pNext;
+		}
+	}
+	catch( ... )
+	{
+		for( pLast = chain.pNext; nullptr != pLast; pLast = chain.pNext )
+		{
+			chain.pNext = pLast->pNext;
+			DestroyNode(pLast);
+		}
+
+		throw;
+	}
+
+	LinkAfter(LocatePrev(index), chain.pNext, pLast, count);
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::toarray
+ * Description   : 按顺序将元素拷贝到pBuffer，返回拷贝的个数
+ * Input         : T* pBuffer
+                size_type capacity  pBuffer最多可容纳的个数
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+typename forwardlist<T, Alloc>::size_type forwardlist<T, Alloc>::toarray(T* pBuffer, size_type capacity) const
+{
+	const node_base* pScan = Head.pNext;
+	size_type count = 0;
+
+	for( ; nullptr != pScan && count < capacity; pScan = pScan->pNext )
+	{
+		pBuffer[count++] = static_cast<const node*>(pScan)->Data;
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::splice
+ * Description   : 将source的全部元素按原顺序移动到index处的元素之前，index
+ 				   等于size时添加到尾部，完成后source为空
+ * Input         : size_type index  0~size
+                forwardlist& source
+ * Output        : None
+ * Return        :
+ * Others        : 分配器相等时只修改指针，除定位插入位置外为O(1)；否则逐个
+ 				   移动元素；容量不足时不移动任何元素；concat经由此实现
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::splice(size_type index, forwardlist& source)
+{
+	node_base* pPrev = nullptr;
+	node_base* pScan = nullptr;
+	node_base* pNode = nullptr;
+
+	if( this == &source || Size < index || MaxSize < Size || MaxSize - Size < source.Size )
+	{
+		return false;
+	}
+
+	if( 0 == source.Size )
+	{
+		return true;
+	}
+
+	pPrev = LocatePrev(index);
+
+	if( Allocator == source.Allocator )
+	{
+		LinkAfter(pPrev, source.Head.pNext, source.pTail, source.Size);
+		source.Head.pNext = nullptr;
+		source.pTail = &source.Head;
+		source.Size = 0;
+		source.pCursor = nullptr;
+
+		return true;
+	}
+
+	for( pScan = source.Head.pNext; nullptr != pScan; pScan = pScan->pNext )
+	{
+		pNode = CreateNode(std::move(static_cast<node*>(pScan)->Data));
+		LinkAfter(pPrev, pNode, pNode, 1);
+		pPrev = pNode;
+	}
+
+	source.clear();
+
+	return true;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::spliceafter
+ * Description   : 将source的全部元素按原顺序移动到index处的元素之后
+ * Input         : size_type index  0~size-1
+                forwardlist& source
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+bool forwardlist<T, Alloc>::spliceafter(size_type index, forwardlist& source)
+{
+	if( Size <= index )
+	{
+		return false;
+	}
+
+	return splice(index + 1, source);
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::emplaceafter
+ * Description   : 在迭代器pos所指元素之后以args原地构造一个元素，pos为
+ 				   beforebegin()时插入到头部
+ * Input         : const_iterator pos
+                Args&&... args
+ * Output        : None
+ * Return        :
+ * Others        : 返回指向新元素的迭代器，pos为end()或容器已满时返回end()；
+ 				   无需定位，时间复杂度O(1)；iterinsertafter经由此实现
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename... Args>
+typename forwardlist<T, Alloc>::iterator forwardlist<T, Alloc>::emplaceafter(const_iterator pos, Args&&... args)
+{
+	node_base* pNode = nullptr;
+
+	if( nullptr == pos.pNode || full() )
+	{
+		return end();
+	}
+
+	pNode = CreateNode(std::forward<Args>(args)...);
+	LinkAfter(pos.pNode, pNode, pNode, 1);
+
+	return iterator(pNode);
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::itereraseafter
+ * Description   : 删除迭代器pos所指元素之后的元素
+ * Input         : const_iterator pos
+ * Output        : None
+ * Return        :
+ * Others        : 返回指向被删除元素之后元素的迭代器；pos为end()或pos之后没有
+ 				   元素时不删除并返回end()
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+typename forwardlist<T, Alloc>::iterator forwardlist<T, Alloc>::itereraseafter(const_iterator pos)
+{
+	if( nullptr == pos.pNode || nullptr == pos.pNode->pNext )
+	{
+		return end();
+	}
+
+	EraseAfter(pos.pNode);
+
+	return iterator(pos.pNode->pNext);
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::removeif
+ * Description   : 删除所有满足pred(元素, ref)的元素，返回删除的个数
+ * Input         : Pred pred
+                const Ref& ref
+ * Output        : None
+ * Return        :
+ * Others        : 一次遍历，时间复杂度O(n)
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Pred, typename Ref>
+typename forwardlist<T, Alloc>::size_type forwardlist<T, Alloc>::removeif(Pred pred, const Ref& ref)
+{
+	node_base* pPrev = &Head;
+	size_type count = 0;
+
+	while( nullptr != pPrev->pNext )
+	{
+		if( pred(static_cast<node*>(pPrev->pNext)->Data, ref) )
+		{
+			EraseAfter(pPrev);
+			count++;
+		}
+		else
+		{
+			pPrev = pPrev->pNext;
+		}
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::countif
+ * Description   : 统计满足pred(元素, ref)的元素个数
+ * Input         : Pred pred
+                const Ref& ref
+ * Output        : None
+ * Return        :
+ * Others        : list_t的版本按thread_count分段多线程统计，此处为单线程
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Pred, typename Ref>
+typename forwardlist<T, Alloc>::size_type forwardlist<T, Alloc>::countif(Pred pred, const Ref& ref) const
+{
+	const node_base* pScan = Head.pNext;
+	size_type count = 0;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		if( pred(static_cast<const node*>(pScan)->Data, ref) )
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::findall
+ * Description   : 按顺序将所有满足pred(元素, ref)的元素地址写入ppOutput，返回
+ 				   满足条件的元素总数
+ * Input         : Pred pred
+                const Ref& ref
+                T** ppOutput
+                size_type capacity  ppOutput最多可容纳的个数
+ * Output        : None
+ * Return        :
+ * Others        : 超过capacity时只写入前capacity个；单线程，pred对每个元素只
+ 				   调用一次
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename Pred, typename Ref>
+typename forwardlist<T, Alloc>::size_type forwardlist<T, Alloc>::findall(Pred pred, const Ref& ref, T** ppOutput, size_type capacity)
+{
+	node_base* pScan = Head.pNext;
+	size_type count = 0;
+
+	for( ; nullptr != pScan; pScan = pScan->pNext )
+	{
+		if( pred(static_cast<node*>(pScan)->Data, ref) )
+		{
+			if( count < capacity )
+			{
+				ppOutput[count] = &static_cast<node*>(pScan)->Data;
+			}
+
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::CreateNode
+ * Description   : 内部实现接口，申请节点并以args原地构造元素
+ * Input         : Args&&... args
+ * Output        : None
+ * Return        :
+ * Others        : 构造抛出异常时释放节点内存后继续抛出
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+template <typename... Args>
+typename forwardlist<T, Alloc>::node* forwardlist<T, Alloc>::CreateNode(Args&&... args)
+{
+	node* pNode = node_traits::allocate(Allocator, 1);
+
+	try
+	{
+		node_traits::construct(Allocator, pNode, std::forward<Args>(args)...);
+	}
+	catch( ... )
+	{
+		node_traits::deallocate(Allocator, pNode, 1);
+		throw;
+	}
+
+	return pNode;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::DestroyNode
+ * Description   : 内部实现接口，析构元素并释放节点
+ * Input         : node_base* pNode
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::DestroyNode(node_base* pNode)
+{
+	node_traits::destroy(Allocator, static_cast<node*>(pNode));
+	node_traits::deallocate(Allocator, static_cast<node*>(pNode), 1);
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::LocateNode
+ * Description   : 内部实现接口，定位index处的节点，index须小于size
+ * Input         : size_type index
+ * Output        : None
+ * Return        :
+ * Others        : 与list_t的LocateNode相同，index不小于上次定位的位置时从该
+ 				   位置继续向后查找，尾节点直接返回；const版本不读写游标，从
+ 				   首节点开始查找，供const的get等只读接口使用
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+ * 2.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: 拆分出不使用游标的const版本
+*****************************************************************************/
+template <typename T, typename Alloc>
+typename forwardlist<T, Alloc>::node_base* forwardlist<T, Alloc>::LocateNode(size_type index)
+{
+	node_base* pScan = Head.pNext;
+	size_type counter = 0;
+
+	if( index + 1 == Size )
+	{
+		return pTail;
+	}
+
+	if( nullptr != pCursor && CursorIndex <= index )
+	{
+		pScan = pCursor;
+		counter = CursorIndex;
+	}
+
+	for( ; counter < index; counter++ )
+	{
+		pScan = pScan->pNext;
+	}
+
+	pCursor = pScan;
+	CursorIndex = index;
+
+	return pScan;
+}
+
+template <typename T, typename Alloc>
+typename forwardlist<T, Alloc>::node_base* forwardlist<T, Alloc>::LocateNode(size_type index) const
+{
+	node_base* pScan = Head.pNext;
+	size_type counter = 0;
+
+	if( index + 1 == Size )
+	{
+		return pTail;
+	}
+
+	for( ; counter < index; counter++ )
+	{
+		pScan = pScan->pNext;
+	}
+
+	return pScan;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::LocatePrev
+ * Description   : 内部实现接口，定位index处节点的前驱，index为0时返回头哨兵
+ * Input         : size_type index  0~size
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+typename forwardlist<T, Alloc>::node_base* forwardlist<T, Alloc>::LocatePrev(size_type index)
+{
+	return ( ( 0 == index ) ? &Head : LocateNode(index - 1) );
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::LinkAfter
+ * Description   : 内部实现接口，将pFirst~pLast共count个节点链接到pPrev之后
+ * Input         : node_base* pPrev
+                node_base* pFirst
+                node_base* pLast
+                size_type count
+ * Output        : None
+ * Return        :
+ * Others        : 添加到尾部时保留定位位置，否则使其失效
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::LinkAfter(node_base* pPrev, node_base* pFirst, node_base* pLast, size_type count)
+{
+	pLast->pNext = pPrev->pNext;
+	pPrev->pNext = pFirst;
+
+	if( pTail == pPrev )
+	{
+		pTail = pLast;
+	}
+	else
+	{
+		pCursor = nullptr;
+	}
+
+	Size += count;
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::EraseAfter
+ * Description   : 内部实现接口，删除pPrev之后的节点，该节点须存在
+ * Input         : node_base* pPrev
+ * Output        : None
+ * Return        :
+ * Others        :
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::EraseAfter(node_base* pPrev)
+{
+	node_base* pErase = pPrev->pNext;
+
+	pPrev->pNext = pErase->pNext;
+
+	if( pTail == pErase )
+	{
+		pTail = pPrev;
+	}
+
+	Size--;
+	pCursor = nullptr;
+	DestroyNode(pErase);
+}
+
+/*****************************************************************************
+ * Function      : forwardlist::Steal
+ * Description   : 内部实现接口，接管other的全部节点，other变为空
+ * Input         : forwardlist& other
+ * Output        : None
+ * Return        :
+ * Others        : 调用前本容器须为空
+ * Record
+ * 1.Date        : 20261018
+ *   Author      : agent@local
+ *   Modification: Created function
+*****************************************************************************/
+template <typename T, typename Alloc>
+void forwardlist<T, Alloc>::Steal(forwardlist& other)
+{
+	Head.pNext = other.Head.pNext;
+	pTail = ( 0 == other.Size ) ? &Head : other.pTail;
+	Size = other.Size;
+
+	other.Head.pNext = nullptr;
+	other.pTail = &other.Head;
+	other.Size = 0;
+	other.pCursor = nullptr;
+}
+
+template <typename T, typename Alloc>
+void swap(forwardlist<T, Alloc>& lhs, forwardlist<T, Alloc>& rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+#endif //end of __FORWARDLIST_HPP__
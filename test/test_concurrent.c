@@ -0,0 +1,225 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_concurrent.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 并发栈模式的多生产者多消费者压力测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 生产者并发pushfront，消费者并发popfrontcopy，检查
+ 				   每个元素恰好被取出一次；并检查并发模式下不支持的接口直接
+ 				   返回失败，退出并发模式后链表恢复可用
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include "sched.h"
+
+#define PRODUCER_COUNT 2
+#define CONSUMER_COUNT 2
+#define PRODUCER_ITEMS 50000
+#define STACK_CAPACITY 1000
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+typedef struct shared
+{
+	list_t* pList;
+	pthread_mutex_t Lock;
+	unsigned int Consumed;
+	unsigned char* pSeen;
+	unsigned int Duplicates;
+}shared_t;
+
+typedef struct worker
+{
+	shared_t* pShared;
+	unsigned int Id;
+}worker_t;
+
+static void* ProducerEntry(void* pArg)
+{
+	worker_t* pWorker = (worker_t*)pArg;
+	list_t* pList = pWorker->pShared->pList;
+	unsigned int counter = 0;
+	unsigned int value = 0;
+
+	for( counter = 0; counter < PRODUCER_ITEMS; counter++ )
+	{
+		value = pWorker->Id * PRODUCER_ITEMS + counter;
+
+		while( OPERATE_FAIL == pList->pushfront(pList, &value) )
+		{
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+static void* ConsumerEntry(void* pArg)
+{
+	worker_t* pWorker = (worker_t*)pArg;
+	shared_t* pShared = pWorker->pShared;
+	list_t* pList = pShared->pList;
+	unsigned int value = 0;
+	int done = OPERATE_FALSE;
+
+	while( !done )
+	{
+		if( OPERATE_FAIL == pList->popfrontcopy(pList, &value) )
+		{
+			pthread_mutex_lock(&pShared->Lock);
+			done = ( PRODUCER_COUNT * PRODUCER_ITEMS == pShared->Consumed );
+			pthread_mutex_unlock(&pShared->Lock);
+			sched_yield();
+			continue;
+		}
+
+		pthread_mutex_lock(&pShared->Lock);
+		if( value >= PRODUCER_COUNT * PRODUCER_ITEMS || 0 != pShared->pSeen[value] )
+		{
+			pShared->Duplicates++;
+		}
+		else
+		{
+			pShared->pSeen[value] = 1;
+		}
+		pShared->Consumed++;
+		done = ( PRODUCER_COUNT * PRODUCER_ITEMS == pShared->Consumed );
+		pthread_mutex_unlock(&pShared->Lock);
+	}
+
+	return NULL;
+}
+
+static void CountVisit(void* pData)
+{
+	(void)pData;
+
+	exit(1);
+}
+
+/* 并发模式下pHead/pTail不再有效，不支持的接口不能读取它们 */
+static void TestRejected(void)
+{
+	list_t* pList = CreateList(10, sizeof(unsigned int));
+	list_iter_t iter;
+	unsigned int value = 7;
+
+	CHECK(NULL != pList);
+	CHECK(OPERATE_SUCC == pList->setconcurrent(pList, OPERATE_TRUE));
+	CHECK(OPERATE_SUCC == pList->pushfront(pList, &value));
+	CHECK(1 == pList->size(pList));
+	CHECK(0 == pList->empty(pList));
+	CHECK(0 == pList->full(pList));
+
+	CHECK(NULL == pList->front(pList));
+	CHECK(NULL == pList->back(pList));
+	CHECK(NULL == pList->get(pList, 0));
+	CHECK(OPERATE_FAIL == pList->pushback(pList, &value));
+	CHECK(OPERATE_FAIL == pList->popback(pList));
+	CHECK(OPERATE_FAIL == pList->insert(pList, 0, &value));
+	CHECK(OPERATE_FAIL == pList->remove(pList, 0));
+	CHECK(0 == pList->toarray(pList, &value, 1));
+	pList->foreach(pList, CountVisit);
+	pList->resize(pList, 0);
+	CHECK(1 == pList->size(pList));
+
+	pList->beforebegin(pList, &iter);
+	CHECK(OPERATE_FAIL == pList->begin(pList, &iter));
+	CHECK(OPERATE_FAIL == pList->next(pList, &iter));
+
+	CHECK(OPERATE_SUCC == pList->setconcurrent(pList, OPERATE_FALSE));
+	CHECK(NULL != pList->front(pList));
+	CHECK(7 == *(unsigned int*)pList->front(pList));
+	CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+	CHECK(2 == pList->size(pList));
+	pList->destroy(&pList);
+	CHECK(NULL == pList);
+}
+
+static void TestStress(void)
+{
+	shared_t shared;
+	pthread_t producers[PRODUCER_COUNT];
+	pthread_t consumers[CONSUMER_COUNT];
+	worker_t workers[PRODUCER_COUNT + CONSUMER_COUNT];
+	unsigned int counter = 0;
+
+	shared.pList = CreateList(STACK_CAPACITY, sizeof(unsigned int));
+	shared.Consumed = 0;
+	shared.Duplicates = 0;
+	shared.pSeen = (unsigned char*)calloc(PRODUCER_COUNT * PRODUCER_ITEMS, 1);
+	CHECK(NULL != shared.pList && NULL != shared.pSeen);
+	CHECK(0 == pthread_mutex_init(&shared.Lock, NULL));
+	CHECK(OPERATE_SUCC == shared.pList->setconcurrent(shared.pList, OPERATE_TRUE));
+
+	for( counter = 0; counter < PRODUCER_COUNT + CONSUMER_COUNT; counter++ )
+	{
+		workers[counter].pShared = &shared;
+		workers[counter].Id = counter;
+	}
+
+	for( counter = 0; counter < CONSUMER_COUNT; counter++ )
+	{
+		CHECK(0 == pthread_create(&consumers[counter], NULL, ConsumerEntry, &workers[PRODUCER_COUNT + counter]));
+	}
+
+	for( counter = 0; counter < PRODUCER_COUNT; counter++ )
+	{
+		CHECK(0 == pthread_create(&producers[counter], NULL, ProducerEntry, &workers[counter]));
+	}
+
+	for( counter = 0; counter < PRODUCER_COUNT; counter++ )
+	{
+		pthread_join(producers[counter], NULL);
+	}
+
+	for( counter = 0; counter < CONSUMER_COUNT; counter++ )
+	{
+		pthread_join(consumers[counter], NULL);
+	}
+
+	CHECK(0 == shared.Duplicates);
+	CHECK(PRODUCER_COUNT * PRODUCER_ITEMS == shared.Consumed);
+	CHECK(0 == shared.pList->size(shared.pList));
+	CHECK(1 == shared.pList->empty(shared.pList));
+	CHECK(OPERATE_FAIL == shared.pList->popfront(shared.pList));
+
+	for( counter = 0; counter < STACK_CAPACITY; counter++ )
+	{
+		CHECK(OPERATE_SUCC == shared.pList->pushfront(shared.pList, &counter));
+	}
+	CHECK(OPERATE_FAIL == shared.pList->pushfront(shared.pList, &counter));
+	CHECK(1 == shared.pList->full(shared.pList));
+
+	CHECK(OPERATE_SUCC == shared.pList->setconcurrent(shared.pList, OPERATE_FALSE));
+	CHECK(STACK_CAPACITY == shared.pList->size(shared.pList));
+	CHECK(STACK_CAPACITY - 1 == *(unsigned int*)shared.pList->front(shared.pList));
+	CHECK(0 == *(unsigned int*)shared.pList->back(shared.pList));
+	shared.pList->destroy(&shared.pList);
+
+	pthread_mutex_destroy(&shared.Lock);
+	free(shared.pSeen);
+}
+
+int main(void)
+{
+	TestRejected();
+	TestStress();
+
+	printf("OK\n");
+
+	return 0;
+}
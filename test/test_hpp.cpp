@@ -0,0 +1,523 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_hpp.cpp
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : forwardlist<T, Alloc>的模型测试，随机操作后与std::vector
+ 				   逐项比对
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 元素类型为std::string，分配器带编号并统计未释放的内存块，
+ 				   用于覆盖不同分配器之间的splice与赋值；另含仅可移动类型
+ 				   与默认排序的检查
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d op %d\n", #cond, __LINE__, CurrentOp); exit(1); } }while(0)
+
+static const size_t Capacity = 60;
+static int CurrentOp;
+static long LiveBlocks;
+
+template <typename T>
+struct counted_allocator
+{
+	typedef T value_type;
+
+	int Id;
+
+	counted_allocator(int id = 0) : Id(id) {}
+	template <typename U> counted_allocator(const counted_allocator<U>& other) : Id(other.Id) {}
+
+	T* allocate(size_t count)
+	{
+		LiveBlocks++;
+		return static_cast<T*>(malloc(count * sizeof(T)));
+	}
+
+	void deallocate(T* pMemory, size_t)
+	{
+		LiveBlocks--;
+		free(pMemory);
+	}
+
+	template <typename U> bool operator==(const counted_allocator<U>& other) const { return Id == other.Id; }
+	template <typename U> bool operator!=(const counted_allocator<U>& other) const { return Id != other.Id; }
+};
+
+typedef counted_allocator<std::string> string_allocator;
+typedef forwardlist<std::string, string_allocator> string_list;
+typedef std::vector<std::string> model_t;
+
+static bool StringEqual(const std::string& value, const std::string& ref)
+{
+	return value == ref;
+}
+
+static bool HasChar(const std::string& value, const char& ch)
+{
+	return std::string::npos != value.find(ch);
+}
+
+static void Verify(string_list& list, const model_t& model)
+{
+	const string_list& constList = list;
+	size_t index = 0;
+
+	CHECK(list.size() == model.size());
+
+	for( const std::string& value : list )
+	{
+		CHECK(value == model[index]);
+		index++;
+	}
+	CHECK(index == model.size());
+
+	for( index = 0; index < model.size(); index++ )
+	{
+		CHECK(*list.get(index) == model[index]);
+	}
+	for( index = model.size(); index-- > 0; )
+	{
+		CHECK(*list.get(index) == model[index]);
+	}
+	for( index = 0; index < model.size(); index++ )
+	{
+		CHECK(*constList.get(index) == model[index]);
+	}
+	CHECK(nullptr == constList.get(model.size()));
+
+	if( !model.empty() )
+	{
+		CHECK(*list.front() == model.front());
+		CHECK(*list.back() == model.back());
+	}
+	else
+	{
+		CHECK(!list.front() && !list.back());
+	}
+
+	index = 0;
+	for( string_list::const_iterator it = constList.begin(); it != constList.end(); ++it, ++index )
+	{
+		CHECK(*it == model[index]);
+	}
+}
+
+static void RunSplice(string_list& list, model_t& model)
+{
+	string_list other(Capacity, string_allocator(rand() % 2 ? 1 : 2));
+	model_t values;
+	size_t count = rand() % 6;
+	int mode = rand() % 3;
+	size_t index = 0;
+	bool result = false;
+
+	for( size_t counter = 0; counter < count; counter++ )
+	{
+		values.push_back(std::to_string(rand() % 100));
+		other.pushback(values.back());
+	}
+
+	index = ( 2 == mode ) ? model.size() : rand() % ( model.size() + 1 );
+	if( 1 == mode && model.empty() )
+	{
+		mode = 0;
+	}
+
+	if( 0 == mode )
+	{
+		result = list.splice(index, other);
+	}
+	else if( 1 == mode )
+	{
+		result = list.spliceafter(index % model.size(), other);
+		index = index % model.size() + 1;
+	}
+	else
+	{
+		result = list.concat(other);
+	}
+
+	if( model.size() + count > Capacity )
+	{
+		CHECK(!result);
+	}
+	else
+	{
+		CHECK(result && other.empty() && 0 == other.size() && !other.front());
+		model.insert(model.begin() + index, values.begin(), values.end());
+		CHECK(other.pushback("q"));
+	}
+}
+
+static void RunIterators(string_list& list, model_t& model, const std::string& value)
+{
+	string_list::iterator it = ( rand() % 4 ) ? list.begin() : list.beforebegin();
+	size_t position = ( it == list.beforebegin() ) ? (size_t)-1 : 0;
+
+	while( it != list.end() )
+	{
+		int action = rand() % 6;
+		size_t next = position + 1;
+
+		if( 0 == action )
+		{
+			string_list::iterator inserted = list.iterinsertafter(it, value);
+
+			CHECK(( inserted != list.end() ) == ( model.size() < Capacity ));
+			if( inserted != list.end() )
+			{
+				CHECK(*inserted == value);
+				model.insert(model.begin() + next, value);
+			}
+		}
+		else if( 1 == action )
+		{
+			bool has = next < model.size();
+			string_list::iterator after = list.itereraseafter(it);
+
+			if( has )
+			{
+				model.erase(model.begin() + next);
+				CHECK(next < model.size() ? ( after != list.end() && *after == model[next] ) : after == list.end());
+			}
+			else
+			{
+				CHECK(after == list.end());
+			}
+		}
+
+		++it;
+		position++;
+	}
+
+	CHECK(list.itereraseafter(list.end()) == list.end());
+}
+
+static void RunRanges(string_list& list, model_t& model)
+{
+	std::string values[7];
+	std::string buffer[Capacity + 10];
+	size_t count = rand() % 8;
+	size_t index = rand() % ( model.size() + 1 );
+	size_t capacity = 0;
+	size_t copied = 0;
+
+	for( size_t counter = 0; counter < count; counter++ )
+	{
+		values[counter] = std::to_string(rand() % 100);
+	}
+
+	if( list.insertrange(index, values, count) )
+	{
+		model.insert(model.begin() + index, values, values + count);
+	}
+	else
+	{
+		CHECK(model.size() + count > Capacity);
+	}
+
+	if( 0 == rand() % 3 && list.pushbackn(values, count) )
+	{
+		model.insert(model.end(), values, values + count);
+	}
+
+	capacity = rand() % ( model.size() + 3 );
+	copied = list.toarray(buffer, capacity);
+	CHECK(copied == std::min(capacity, model.size()));
+	for( size_t counter = 0; counter < copied; counter++ )
+	{
+		CHECK(buffer[counter] == model[counter]);
+	}
+}
+
+static void RunSearch(string_list& list, model_t& model)
+{
+	char ch = (char)( '0' + rand() % 10 );
+	size_t expect = 0;
+	size_t before = model.size();
+	std::string* found[Capacity + 10];
+
+	for( const std::string& value : model )
+	{
+		expect += HasChar(value, ch);
+	}
+	CHECK(list.countif(HasChar, ch) == expect);
+	CHECK(list.findall(HasChar, ch, found, 3) == expect);
+	for( size_t counter = 0; counter < std::min<size_t>(3, expect); counter++ )
+	{
+		CHECK(HasChar(*found[counter], ch));
+	}
+
+	if( 0 == rand() % 5 )
+	{
+		CHECK(list.removeif(HasChar, ch) == expect);
+		model.erase(std::remove_if(model.begin(), model.end(),
+			[ch](const std::string& value) { return HasChar(value, ch); }), model.end());
+		CHECK(model.size() == before - expect);
+	}
+}
+
+static void RunCopies(string_list& list, model_t& model)
+{
+	string_list copied(list);
+	Verify(copied, model);
+
+	string_list moved(std::move(copied));
+	CHECK(copied.empty());
+	Verify(moved, model);
+
+	if( moved.pushback("y") )
+	{
+		copied = moved;
+		moved.popback();
+		copied.popback();
+	}
+	else
+	{
+		copied = moved;
+	}
+	Verify(copied, model);
+
+	string_list other(Capacity, string_allocator(2));
+	other = std::move(copied);
+	Verify(other, model);
+
+	string_list last;
+	last = std::move(other);
+	Verify(last, model);
+	swap(last, list);
+	Verify(list, model);
+	list.swap(last);
+	Verify(last, model);
+	CHECK(Capacity == list.capacity());
+}
+
+static void RunModel()
+{
+	string_list list(Capacity, string_allocator(1));
+	model_t model;
+	size_t index = 0;
+
+	for( CurrentOp = 0; CurrentOp < 30000; CurrentOp++ )
+	{
+		std::string value = std::to_string(rand() % 1000);
+
+		switch( rand() % 16 )
+		{
+		case 0:
+			if( list.pushfront(value) )
+			{
+				model.insert(model.begin(), value);
+			}
+			else
+			{
+				CHECK(Capacity == model.size());
+			}
+			break;
+		case 1:
+		{
+			std::string temp = value;
+
+			if( list.pushback(std::move(temp)) )
+			{
+				model.push_back(value);
+			}
+			else
+			{
+				CHECK(Capacity == model.size());
+			}
+			break;
+		}
+		case 2:
+			if( list.emplacefront(3, 'x') )
+			{
+				model.insert(model.begin(), "xxx");
+			}
+			break;
+		case 3:
+			CHECK(list.popfront() == !model.empty());
+			if( !model.empty() )
+			{
+				model.erase(model.begin());
+			}
+			break;
+		case 4:
+			CHECK(list.popback() == !model.empty());
+			if( !model.empty() )
+			{
+				model.pop_back();
+			}
+			break;
+		case 5:
+			if( !model.empty() )
+			{
+				index = rand() % model.size();
+				CHECK(list.remove(index));
+				model.erase(model.begin() + index);
+			}
+			else
+			{
+				CHECK(!list.remove(0));
+			}
+			break;
+		case 6:
+			if( !model.empty() )
+			{
+				index = rand() % model.size();
+				CHECK(list.assign(index, value));
+				model[index] = value;
+			}
+			break;
+		case 7:
+			if( !model.empty() && model.size() < Capacity )
+			{
+				index = rand() % model.size();
+				CHECK(list.insert(index, value));
+				model.insert(model.begin() + index, value);
+			}
+			break;
+		case 8:
+			if( !model.empty() && model.size() < Capacity )
+			{
+				index = rand() % model.size();
+				CHECK(list.insertafter(index, value));
+				model.insert(model.begin() + index + 1, value);
+			}
+			break;
+		case 9:
+			if( model.size() > 1 )
+			{
+				size_t other = rand() % model.size();
+
+				index = rand() % model.size();
+				CHECK(list.swap(index, other) == ( index != other ));
+				std::swap(model[index], model[other]);
+			}
+			break;
+		case 10:
+			if( 0 == rand() % 10 )
+			{
+				list.sortif(std::greater<std::string>());
+				std::stable_sort(model.begin(), model.end());
+			}
+			if( 0 == rand() % 10 )
+			{
+				list.sortbykey([](const std::string& item) { return item.size(); });
+				std::stable_sort(model.begin(), model.end(),
+					[](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+			}
+			if( 0 == rand() % 50 )
+			{
+				list.clear();
+				model.clear();
+			}
+			if( 0 == rand() % 20 && model.size() > 3 )
+			{
+				list.resize(model.size() - 3);
+				model.resize(model.size() - 3);
+				CHECK(list.full());
+				list.resize(Capacity);
+			}
+			break;
+		case 11:
+			RunRanges(list, model);
+			break;
+		case 12:
+			RunSplice(list, model);
+			break;
+		case 13:
+			RunIterators(list, model, value);
+			break;
+		case 14:
+			RunSearch(list, model);
+			break;
+		case 15:
+			if( !model.empty() )
+			{
+				const std::string& ref = model[rand() % model.size()];
+				size_t found = list.findindexif(StringEqual, ref);
+
+				CHECK(found < model.size() && model[found] == ref);
+				CHECK(list.findif2(StringEqual, ref) == list.get(found));
+				CHECK(list.findif([&ref](const std::string& item) { return item == ref; }) == list.get(found));
+			}
+			CHECK(string_list::npos == list.findindexif(StringEqual, std::string("zz")));
+			if( 0 == rand() % 10 )
+			{
+				std::string popped;
+				bool empty = model.empty();
+
+				CHECK(list.popfrontcopy(popped) == !empty);
+				if( !empty )
+				{
+					CHECK(popped == model.front());
+					model.erase(model.begin());
+				}
+			}
+			if( 0 == rand() % 20 )
+			{
+				RunCopies(list, model);
+			}
+			break;
+		default:
+			break;
+		}
+
+		Verify(list, model);
+	}
+}
+
+int main()
+{
+	srand(3);
+	RunModel();
+	CHECK(0 == LiveBlocks);
+
+	{
+		forwardlist<std::unique_ptr<int> > owners;
+		std::unique_ptr<int> popped;
+
+		owners.emplaceback(new int(5));
+		owners.pushfront(std::unique_ptr<int>(new int(3)));
+		CHECK(owners.popfrontcopy(popped) && 3 == *popped);
+		CHECK(5 == **owners.front());
+	}
+
+	{
+		forwardlist<int> numbers;
+		int previous = -1;
+
+		for( int counter = 0; counter < 100; counter++ )
+		{
+			numbers.pushback(rand() % 50);
+		}
+		numbers.sort();
+		for( int value : numbers )
+		{
+			CHECK(value >= previous);
+			previous = value;
+		}
+		CHECK(std::is_sorted(numbers.begin(), numbers.end()));
+	}
+
+	printf("OK\n");
+
+	return 0;
+}
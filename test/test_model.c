@@ -0,0 +1,939 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_model.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 模型测试，对各存储方式的链表随机执行操作，并与同步维护的
+ 				   int数组逐项比对
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 覆盖节点、节点池、跳表索引、哈希索引、展开链表与顺序存储；
+ 				   自定义分配器统计未释放的内存块，每个用例结束时须为0；节点、
+ 				   节点池、哈希索引与跳表另检查compact前后内容一致且locality变小，
+ 				   两个整理过的链表之间splice直接链接节点；各配置下另检查排序
+ 				   是否稳定，以及以各种方式删除尾元素后back与pushback是否正确，
+ 				   哈希值大量冲突时的findbykey，以及removeif删除开头一段与全部
+ 				   元素
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+ * 2.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加compact的测试
+ * 3.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加启用节点池的链表之间splice的检查
+ * 4.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加sortif稳定性的检查
+ * 5.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加sortbykey稳定性的检查
+ * 6.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加parallelsortif稳定性的检查
+ * 7.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加删除尾元素后尾指针的检查
+ * 8.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加哈希值冲突时findbykey的检查
+ * 9.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加removeif删除开头一段与全部元素的检查
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#define MODEL_CAPACITY 500
+#define MODEL_ROUNDS 20000
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d op %d\n", #cond, __LINE__, CurrentOp); exit(1); } }while(0)
+
+typedef struct collect
+{
+	int* pBuffer;
+	unsigned int Count;
+}collect_t;
+
+static int Model[MODEL_CAPACITY + 100];
+static unsigned int ModelSize;
+static int CurrentOp;
+static long LiveBlocks;
+static int HashOn;
+static const list_attr_t* pCurrentAttr;
+
+static void* CountedAlloc(void* pContext, size_t size)
+{
+	(void)pContext;
+	LiveBlocks++;
+
+	return malloc(size);
+}
+
+static void CountedRelease(void* pContext, void* pMemory)
+{
+	(void)pContext;
+	LiveBlocks--;
+	free(pMemory);
+}
+
+static int CompareInt(const void* pData1, const void* pData2)
+{
+	return *(const int*)pData1 - *(const int*)pData2;
+}
+
+static unsigned int IntGreater(const void* pData1, const void* pData2)
+{
+	return *(const int*)pData1 > *(const int*)pData2;
+}
+
+static unsigned int GroupGreater(const void* pData1, const void* pData2)
+{
+	return ( *(const int*)pData1 >> 16 ) > ( *(const int*)pData2 >> 16 );
+}
+
+static unsigned int IntEqual(const void* pData1, const void* pData2)
+{
+	return *(const int*)pData1 == *(const int*)pData2;
+}
+
+static unsigned int IntLess(const void* pData, const void* pRef)
+{
+	return *(const int*)pData < *(const int*)pRef;
+}
+
+static unsigned int IntDivisible(const void* pData, const void* pRef)
+{
+	return 0 == *(const int*)pData % *(const int*)pRef;
+}
+
+static unsigned int IntHash(const void* pKey)
+{
+	return (unsigned int)*(const int*)pKey;
+}
+
+static unsigned int CollideHash(const void* pKey)
+{
+	return (unsigned int)*(const int*)pKey % 3;
+}
+
+static void CollectBatch(void** ppItems, unsigned int count, void* pContext)
+{
+	collect_t* pCollect = (collect_t*)pContext;
+	unsigned int counter = 0;
+
+	CHECK(0 != count && count <= LIST_TRAVERSE_BATCH);
+	for( counter = 0; counter < count; counter++ )
+	{
+		pCollect->pBuffer[pCollect->Count++] = *(int*)ppItems[counter];
+	}
+}
+
+static void CollectOne(void* pData, void* pContext)
+{
+	collect_t* pCollect = (collect_t*)pContext;
+
+	pCollect->pBuffer[pCollect->Count++] = *(int*)pData;
+}
+
+static unsigned int FindInBatch(void** ppItems, unsigned int count, void* pContext)
+{
+	unsigned int counter = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		if( *(int*)ppItems[counter] == *(int*)pContext )
+		{
+			return counter;
+		}
+	}
+
+	return count;
+}
+
+static void ModelInsert(unsigned int index, const int* pValues, unsigned int count)
+{
+	memmove(Model + index + count, Model + index, ( ModelSize - index ) * sizeof(int));
+	memcpy(Model + index, pValues, count * sizeof(int));
+	ModelSize += count;
+}
+
+static void ModelErase(unsigned int index)
+{
+	memmove(Model + index, Model + index + 1, ( ModelSize - index - 1 ) * sizeof(int));
+	ModelSize--;
+}
+
+static void Verify(list_t* pList)
+{
+	static int buffer[MODEL_CAPACITY + 100];
+	collect_t collect = { buffer, 0 };
+	unsigned int counter = 0;
+	int key = 0;
+	int* pItem = NULL;
+
+	CHECK(pList->size(pList) == ModelSize);
+
+	if( HashOn )
+	{
+		for( counter = 0; counter < ModelSize; counter++ )
+		{
+			pItem = (int*)pList->findbykey(pList, &Model[counter]);
+			CHECK(NULL != pItem && *pItem == Model[counter]);
+		}
+		key = 5000;
+		CHECK(NULL == pList->findbykey(pList, &key));
+		if( LIST_STORAGE_NODE == pList->Storage && 0 != ModelSize )
+		{
+			CHECK(pList->pHash->Count == ModelSize);
+		}
+	}
+
+	for( counter = 0; counter < ModelSize; counter++ )
+	{
+		pItem = (int*)pList->get(pList, counter);
+		CHECK(NULL != pItem && *pItem == Model[counter]);
+	}
+	for( counter = ModelSize; counter-- > 0; )
+	{
+		pItem = (int*)pList->get(pList, counter);
+		CHECK(NULL != pItem && *pItem == Model[counter]);
+	}
+
+	pList->foreachbatch(pList, CollectBatch, &collect);
+	CHECK(collect.Count == ModelSize && 0 == memcmp(buffer, Model, ModelSize * sizeof(int)));
+	collect.Count = 0;
+	pList->foreach2(pList, CollectOne, &collect);
+	CHECK(collect.Count == ModelSize && 0 == memcmp(buffer, Model, ModelSize * sizeof(int)));
+
+	if( 0 != ModelSize )
+	{
+		unsigned int first = 0;
+
+		key = Model[rand() % ModelSize];
+		while( Model[first] != key )
+		{
+			first++;
+		}
+		pItem = (int*)pList->findifbatch(pList, FindInBatch, &key);
+		CHECK(NULL != pItem && *pItem == key && pItem == pList->get(pList, first));
+		CHECK(*(int*)pList->front(pList) == Model[0]);
+		CHECK(*(int*)pList->back(pList) == Model[ModelSize - 1]);
+	}
+	else
+	{
+		CHECK(NULL == pList->back(pList));
+	}
+	key = -1;
+	CHECK(NULL == pList->findifbatch(pList, FindInBatch, &key));
+}
+
+static void RunSplice(list_t* pList)
+{
+	list_t* pOther = ( rand() % 2 ) ? CreateListEx(MODEL_CAPACITY, sizeof(int), pCurrentAttr) : CreateList(MODEL_CAPACITY, sizeof(int));
+	int values[8];
+	unsigned int count = rand() % 9;
+	unsigned int mode = rand() % 3;
+	unsigned int index = 0;
+	unsigned int counter = 0;
+	int result = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		values[counter] = rand() % 1000;
+		pOther->pushback(pOther, &values[counter]);
+	}
+
+	index = ( 2 == mode ) ? ModelSize : rand() % ( ModelSize + 1 );
+	if( 1 == mode && 0 == ModelSize )
+	{
+		mode = 0;
+	}
+
+	if( 0 == mode )
+	{
+		result = pList->splice(pList, index, pOther);
+	}
+	else if( 1 == mode )
+	{
+		result = pList->spliceafter(pList, index % ModelSize, pOther);
+		index = index % ModelSize + 1;
+	}
+	else
+	{
+		result = pList->concat(pList, pOther);
+	}
+
+	if( ModelSize + count > MODEL_CAPACITY )
+	{
+		CHECK(!result);
+	}
+	else
+	{
+		CHECK(result);
+		CHECK(0 == pOther->size(pOther) && NULL == pOther->front(pOther));
+		ModelInsert(index, values, count);
+		counter = 99;
+		CHECK(pOther->pushback(pOther, &counter));
+		CHECK(99 == *(int*)pOther->get(pOther, 0));
+	}
+
+	pOther->destroy(&pOther);
+}
+
+static void RunIterators(list_t* pList, int value)
+{
+	list_iter_t iter;
+	unsigned int position = 0;
+	int more = 0;
+
+	if( 0 == rand() % 4 )
+	{
+		pList->beforebegin(pList, &iter);
+		more = 1;
+		position = (unsigned int)-1;
+	}
+	else
+	{
+		more = pList->begin(pList, &iter);
+		CHECK(more == ( 0 != ModelSize ));
+	}
+
+	while( more )
+	{
+		int action = rand() % 8;
+		unsigned int next = position + 1;
+
+		if( (unsigned int)-1 != position )
+		{
+			CHECK(*(int*)pList->deref(pList, &iter) == Model[position]);
+		}
+		else
+		{
+			CHECK(NULL == pList->deref(pList, &iter));
+		}
+
+		if( 0 == action )
+		{
+			int result = pList->iterinsertafter(pList, &iter, &value);
+
+			CHECK(result == ( ModelSize < MODEL_CAPACITY ));
+			if( result )
+			{
+				ModelInsert(next, &value, 1);
+			}
+		}
+		else if( 1 == action )
+		{
+			int result = pList->itereraseafter(pList, &iter);
+
+			CHECK(result == ( next < ModelSize ));
+			if( result )
+			{
+				ModelErase(next);
+			}
+		}
+
+		more = pList->next(pList, &iter);
+		position++;
+		CHECK(more == ( position < ModelSize ));
+	}
+
+	CHECK(NULL == pList->deref(pList, &iter));
+	CHECK(!pList->iterinsertafter(pList, &iter, &value));
+	CHECK(!pList->itereraseafter(pList, &iter));
+}
+
+static void RunRanges(list_t* pList)
+{
+	static int buffer[MODEL_CAPACITY + 100];
+	int values[7];
+	unsigned int count = rand() % 8;
+	unsigned int index = rand() % ( ModelSize + 1 );
+	unsigned int counter = 0;
+	unsigned int capacity = 0;
+	unsigned int copied = 0;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		values[counter] = rand() % 1000;
+	}
+
+	if( pList->insertrange(pList, index, values, count) )
+	{
+		ModelInsert(index, values, count);
+	}
+	else
+	{
+		CHECK(ModelSize + count > MODEL_CAPACITY);
+	}
+
+	if( 0 == rand() % 3 && pList->pushfrontn(pList, values, count) )
+	{
+		ModelInsert(0, values, count);
+	}
+
+	if( 0 == rand() % 3 && pList->pushbackn(pList, values, count) )
+	{
+		ModelInsert(ModelSize, values, count);
+	}
+
+	capacity = rand() % ( ModelSize + 3 );
+	copied = pList->toarray(pList, buffer, capacity);
+	CHECK(copied == ( capacity < ModelSize ? capacity : ModelSize ));
+	CHECK(0 == memcmp(buffer, Model, copied * sizeof(int)));
+}
+
+static void RunModel(list_t* pList)
+{
+	unsigned int index = 0;
+	unsigned int other = 0;
+	int value = 0;
+	int temp = 0;
+
+	CHECK(NULL != pList);
+	srand(1);
+	ModelSize = 0;
+
+	for( CurrentOp = 0; CurrentOp < MODEL_ROUNDS; CurrentOp++ )
+	{
+		value = rand() % 1000;
+
+		switch( rand() % 17 )
+		{
+		case 0:
+			if( pList->pushfront(pList, &value) )
+			{
+				ModelInsert(0, &value, 1);
+			}
+			break;
+		case 1:
+		case 2:
+			if( pList->pushback(pList, &value) )
+			{
+				ModelInsert(ModelSize, &value, 1);
+			}
+			break;
+		case 3:
+			if( pList->popfront(pList) )
+			{
+				ModelErase(0);
+			}
+			break;
+		case 4:
+			if( pList->popback(pList) )
+			{
+				ModelSize--;
+			}
+			break;
+		case 5:
+			if( 0 != ModelSize )
+			{
+				index = rand() % ModelSize;
+				CHECK(pList->remove(pList, index));
+				ModelErase(index);
+			}
+			break;
+		case 6:
+			if( 0 != ModelSize )
+			{
+				index = rand() % ModelSize;
+				CHECK(pList->assign(pList, index, &value));
+				Model[index] = value;
+			}
+			break;
+		case 7:
+			if( 0 != ModelSize && ModelSize < MODEL_CAPACITY )
+			{
+				index = rand() % ModelSize;
+				CHECK(pList->insert(pList, index, &value));
+				ModelInsert(index, &value, 1);
+			}
+			break;
+		case 8:
+			if( 0 != ModelSize && ModelSize < MODEL_CAPACITY )
+			{
+				index = rand() % ModelSize;
+				CHECK(pList->insertafter(pList, index, &value));
+				ModelInsert(index + 1, &value, 1);
+			}
+			break;
+		case 9:
+			if( ModelSize > 1 )
+			{
+				index = rand() % ModelSize;
+				other = rand() % ModelSize;
+				if( index != other )
+				{
+					CHECK(pList->swap(pList, index, other));
+					temp = Model[index];
+					Model[index] = Model[other];
+					Model[other] = temp;
+				}
+			}
+			break;
+		case 10:
+			if( 0 == rand() % 50 )
+			{
+				pList->sortif(pList, IntGreater);
+				qsort(Model, ModelSize, sizeof(int), CompareInt);
+			}
+			if( 0 == rand() % 50 )
+			{
+				CHECK(pList->sortbykey(pList, 0, sizeof(int)));
+				qsort(Model, ModelSize, sizeof(int), CompareInt);
+			}
+			if( 0 == rand() % 50 )
+			{
+				pList->parallelsortif(pList, IntGreater, 3, 0);
+				qsort(Model, ModelSize, sizeof(int), CompareInt);
+			}
+			if( 0 == rand() % 200 )
+			{
+				pList->clear(pList);
+				ModelSize = 0;
+			}
+			if( 0 == rand() % 100 && ModelSize > 5 )
+			{
+				pList->resize(pList, ModelSize - 3);
+				ModelSize -= 3;
+				pList->resize(pList, MODEL_CAPACITY);
+			}
+			break;
+		case 11:
+			if( 0 != ModelSize )
+			{
+				index = rand() % ModelSize;
+				other = 0;
+				while( Model[other] != Model[index] )
+				{
+					other++;
+				}
+				CHECK(pList->findindexif(pList, IntEqual, &Model[index]) == other);
+			}
+			break;
+		case 12:
+			RunRanges(pList);
+			break;
+		case 14:
+			RunSplice(pList);
+			break;
+		case 15:
+			RunIterators(pList, value);
+			break;
+		case 16:
+			if( 0 == rand() % 4 )
+			{
+				int divisor = rand() % 7 + 1;
+				unsigned int removed = pList->removeif(pList, IntDivisible, &divisor);
+				unsigned int kept = 0;
+
+				for( index = 0; index < ModelSize; index++ )
+				{
+					if( 0 != Model[index] % divisor )
+					{
+						Model[kept++] = Model[index];
+					}
+				}
+				CHECK(removed == ModelSize - kept);
+				ModelSize = kept;
+			}
+			break;
+		default:
+			break;
+		}
+
+		Verify(pList);
+	}
+
+	pList->destroy(&pList);
+	CHECK(NULL == pList);
+	CHECK(0 == LiveBlocks);
+}
+
+/* 排序使遍历顺序与节点地址无关，compact后内容不变、相邻元素的距离变小；
+   两个整理过的链表之间splice直接链接节点 */
+static void RunCompact(const list_attr_t* pAttr)
+{
+	list_t* pList = CreateListEx(MODEL_CAPACITY, sizeof(int), pAttr);
+	list_t* pOther = CreateListEx(MODEL_CAPACITY, sizeof(int), pAttr);
+	unsigned long long before = 0;
+	unsigned long long after = 0;
+	int values[3] = { 11, 12, 13 };
+	int value = 0;
+	int* pItem = NULL;
+
+	CHECK(NULL != pList && NULL != pOther);
+	srand(2);
+	CurrentOp = -1;
+	ModelSize = 0;
+	HashOn = pAttr->HashIndex;
+
+	while( ModelSize < MODEL_CAPACITY - 10 )
+	{
+		value = rand() % 1000;
+		CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+		Model[ModelSize++] = value;
+	}
+	pList->sortif(pList, IntGreater);
+	qsort(Model, ModelSize, sizeof(int), CompareInt);
+	Verify(pList);
+
+	before = pList->locality(pList);
+	CHECK(OPERATE_SUCC == pList->compact(pList));
+	after = pList->locality(pList);
+	CHECK(after < before / 4);
+	Verify(pList);
+
+	/* 整理后仍可正常增删，删除的节点回收复用 */
+	CHECK(OPERATE_SUCC == pList->remove(pList, 7));
+	ModelErase(7);
+	CHECK(OPERATE_SUCC == pList->popfront(pList));
+	ModelErase(0);
+	value = 4321;
+	CHECK(OPERATE_SUCC == pList->insert(pList, 100, &value));
+	ModelInsert(100, &value, 1);
+	CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+	Model[ModelSize++] = value;
+	Verify(pList);
+	CHECK(OPERATE_SUCC == pList->compact(pList));
+	Verify(pList);
+
+	CHECK(OPERATE_SUCC == pOther->pushbackn(pOther, values, 3));
+	CHECK(OPERATE_SUCC == pOther->compact(pOther));
+	pItem = (int*)pOther->front(pOther);
+	CHECK(OPERATE_SUCC == pList->splice(pList, 5, pOther));
+	ModelInsert(5, values, 3);
+	CHECK(pItem == pList->get(pList, 5));
+	CHECK(0 == pOther->size(pOther));
+	Verify(pList);
+	CHECK(OPERATE_SUCC == pOther->pushback(pOther, &value));
+	pOther->destroy(&pOther);
+	CHECK(OPERATE_SUCC == pList->remove(pList, 6));
+	ModelErase(6);
+	Verify(pList);
+
+	pList->destroy(&pList);
+	CHECK(NULL == pList);
+	CHECK(0 == LiveBlocks);
+	HashOn = 0;
+}
+
+/* 以value结尾的操作须同步更新尾指针，随后的pushback接在新的尾部之后 */
+static void PushBackChecked(list_t* pList, int value)
+{
+	CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+	Model[ModelSize++] = value;
+	Verify(pList);
+}
+
+static void RunTail(const list_attr_t* pAttr)
+{
+	list_t* pList = CreateListEx(MODEL_CAPACITY, sizeof(int), pAttr);
+	list_iter_t iter;
+	int divisor = 9;
+	int value = 0;
+
+	CHECK(NULL != pList);
+	CurrentOp = -3;
+	ModelSize = 0;
+	HashOn = pAttr->HashIndex;
+
+	for( value = 1; value < 6; value++ )
+	{
+		PushBackChecked(pList, value);
+	}
+
+	CHECK(OPERATE_SUCC == pList->remove(pList, ModelSize - 1));
+	ModelErase(ModelSize - 1);
+	PushBackChecked(pList, 9);
+
+	CHECK(1 == pList->removeif(pList, IntDivisible, &divisor));
+	ModelErase(ModelSize - 1);
+	PushBackChecked(pList, 10);
+
+	pList->beforebegin(pList, &iter);
+	for( value = 0; value + 1 < (int)ModelSize; value++ )
+	{
+		CHECK(pList->next(pList, &iter));
+	}
+	CHECK(OPERATE_SUCC == pList->itereraseafter(pList, &iter));
+	ModelErase(ModelSize - 1);
+	PushBackChecked(pList, 11);
+
+	pList->resize(pList, 2);
+	ModelSize = 2;
+	pList->resize(pList, MODEL_CAPACITY);
+	PushBackChecked(pList, 12);
+
+	while( 0 != ModelSize )
+	{
+		CHECK(OPERATE_SUCC == pList->popback(pList));
+		ModelSize--;
+		Verify(pList);
+	}
+	PushBackChecked(pList, 13);
+	CHECK(pList->front(pList) == pList->back(pList));
+
+	pList->destroy(&pList);
+	CHECK(0 == LiveBlocks);
+}
+
+/* removeif删除开头的连续一段、不删除任何元素以及删除全部元素 */
+static void RunRemoveIf(const list_attr_t* pAttr)
+{
+	list_t* pList = CreateListEx(MODEL_CAPACITY, sizeof(int), pAttr);
+	int bound = 0;
+	int value = 0;
+
+	CHECK(NULL != pList);
+	CurrentOp = -5;
+	HashOn = pAttr->HashIndex;
+
+	for( ModelSize = 0; ModelSize < 300; ModelSize++ )
+	{
+		value = (int)ModelSize;
+		CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+		Model[ModelSize] = value;
+	}
+
+	bound = 120;
+	CHECK(120 == pList->removeif(pList, IntLess, &bound));
+	memmove(Model, Model + 120, ( ModelSize - 120 ) * sizeof(int));
+	ModelSize -= 120;
+	Verify(pList);
+
+	CHECK(0 == pList->removeif(pList, IntLess, &bound));
+	Verify(pList);
+
+	bound = 1000;
+	CHECK(180 == pList->removeif(pList, IntLess, &bound));
+	ModelSize = 0;
+	Verify(pList);
+	CHECK(0 == pList->removeif(pList, IntLess, &bound));
+
+	value = 7;
+	CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+	Model[ModelSize++] = value;
+	Verify(pList);
+
+	pList->destroy(&pList);
+	CHECK(0 == LiveBlocks);
+}
+
+/* 哈希值只有3种，查找须逐个比较键值，修改与删除后旧键不能再被找到 */
+static void RunHashCollisions(const list_attr_t* pAttr)
+{
+	list_attr_t attr = *pAttr;
+	list_t* pList = NULL;
+	int divisor = 2;
+	int value = 0;
+	unsigned int kept = 0;
+	unsigned int index = 0;
+
+	attr.HashIndex = 1;
+	attr.HashKeyWidth = 0;
+	attr.hash = CollideHash;
+	attr.keyequal = IntEqual;
+	pList = CreateListEx(MODEL_CAPACITY, sizeof(int), &attr);
+	CHECK(NULL != pList);
+	CurrentOp = -4;
+	HashOn = 1;
+
+	for( ModelSize = 0; ModelSize < 200; ModelSize++ )
+	{
+		value = (int)ModelSize * 7;
+		CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+		Model[ModelSize] = value;
+	}
+	Verify(pList);
+
+	value = Model[10];
+	Model[10] = 4999;
+	CHECK(OPERATE_SUCC == pList->assign(pList, 10, &Model[10]));
+	CHECK(NULL == pList->findbykey(pList, &value));
+	Verify(pList);
+
+	CHECK(99 == pList->removeif(pList, IntDivisible, &divisor));
+	for( index = 0; index < ModelSize; index++ )
+	{
+		if( 0 != Model[index] % divisor )
+		{
+			Model[kept++] = Model[index];
+		}
+	}
+	ModelSize = kept;
+	value = 14;
+	CHECK(NULL == pList->findbykey(pList, &value));
+	Verify(pList);
+
+	value = Model[0];
+	CHECK(OPERATE_SUCC == pList->popfront(pList));
+	ModelErase(0);
+	CHECK(NULL == pList->findbykey(pList, &value));
+	Verify(pList);
+
+	pList->destroy(&pList);
+	CHECK(0 == LiveBlocks);
+}
+
+/* 元素的高16位为分组、低16位为原位置，只按分组排序时稳定排序的结果与按
+   整个值排序相同 */
+static void FillGroups(list_t* pList)
+{
+	int value = 0;
+
+	pList->clear(pList);
+	for( ModelSize = 0; ModelSize < MODEL_CAPACITY; ModelSize++ )
+	{
+		value = ( rand() % 50 ) << 16 | (int)ModelSize;
+		CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+		Model[ModelSize] = value;
+	}
+	qsort(Model, ModelSize, sizeof(int), CompareInt);
+}
+
+static void RunStableSort(const list_attr_t* pAttr)
+{
+	list_t* pList = CreateListEx(MODEL_CAPACITY, sizeof(int), pAttr);
+	const int probe = 1;
+	unsigned int group_offset = ( 1 == *(const char*)&probe ) ? 2 : 0;
+	unsigned int threads = 0;
+
+	CHECK(NULL != pList);
+	srand(3);
+	CurrentOp = -2;
+	HashOn = pAttr->HashIndex;
+
+	FillGroups(pList);
+	pList->sortif(pList, GroupGreater);
+	Verify(pList);
+
+	/* 只以分组所在的2字节为键 */
+	FillGroups(pList);
+	CHECK(OPERATE_SUCC == pList->sortbykey(pList, group_offset, 2));
+	Verify(pList);
+
+	/* 段数为奇数时合并的最后一层留有单独的一段；同一链表反复调用复用线程池 */
+	for( threads = 2; threads < 9; threads++ )
+	{
+		FillGroups(pList);
+		pList->parallelsortif(pList, GroupGreater, threads, 0);
+		Verify(pList);
+	}
+	FillGroups(pList);
+	pList->parallelsortif(pList, GroupGreater, 4, MODEL_CAPACITY + 1);
+	Verify(pList);
+
+	pList->destroy(&pList);
+	CHECK(0 == LiveBlocks);
+}
+
+static void RunWith(const list_attr_t* pAttr)
+{
+	int hash_on = HashOn;
+
+	pCurrentAttr = pAttr;
+	RunModel(CreateListEx(MODEL_CAPACITY, sizeof(int), pAttr));
+	RunStableSort(pAttr);
+	RunTail(pAttr);
+	RunRemoveIf(pAttr);
+	RunHashCollisions(pAttr);
+	HashOn = hash_on;
+}
+
+int main(void)
+{
+	list_allocator_t allocator = { CountedAlloc, CountedRelease, NULL };
+	list_attr_t attr;
+	unsigned int block_items = 0;
+
+	pCurrentAttr = NULL;
+	RunModel(CreateList(MODEL_CAPACITY, sizeof(int)));
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &allocator;
+	RunWith(&attr);
+	attr.PoolNodesPerSlab = 16;
+	RunWith(&attr);
+	attr.PoolNodesPerSlab = 0;
+	attr.CursorCache = 1;
+	RunWith(&attr);
+	attr.CursorCache = 0;
+
+	attr.Storage = LIST_STORAGE_UNROLLED;
+	for( block_items = 1; block_items < 9; block_items++ )
+	{
+		attr.BlockItems = block_items;
+		RunWith(&attr);
+	}
+	attr.CursorCache = 1;
+	RunWith(&attr);
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &allocator;
+	attr.SkipIndex = 1;
+	RunWith(&attr);
+	attr.PoolNodesPerSlab = 8;
+	RunWith(&attr);
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &allocator;
+	attr.HashIndex = 1;
+	attr.HashKeyWidth = sizeof(int);
+	HashOn = 1;
+	RunWith(&attr);
+	attr.SkipIndex = 1;
+	attr.PoolNodesPerSlab = 8;
+	RunWith(&attr);
+	attr.hash = IntHash;
+	attr.keyequal = IntEqual;
+	attr.HashKeyWidth = 0;
+	RunWith(&attr);
+	attr.Storage = LIST_STORAGE_UNROLLED;
+	attr.BlockItems = 3;
+	RunWith(&attr);
+	attr.Storage = LIST_STORAGE_VECTOR;
+	RunWith(&attr);
+	HashOn = 0;
+
+	attr.Storage = LIST_STORAGE_UNROLLED;
+	attr.hash = NULL;
+	CHECK(NULL == CreateListEx(MODEL_CAPACITY, sizeof(int), &attr));
+	attr.keyequal = NULL;
+	attr.HashKeyWidth = sizeof(int);
+	attr.HashKeyOffset = 1;
+	CHECK(NULL == CreateListEx(MODEL_CAPACITY, sizeof(int), &attr));
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &allocator;
+	attr.Storage = LIST_STORAGE_VECTOR;
+	RunWith(&attr);
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &allocator;
+	RunCompact(&attr);
+	attr.PoolNodesPerSlab = 16;
+	RunCompact(&attr);
+	attr.PoolNodesPerSlab = 0;
+	attr.HashIndex = 1;
+	attr.HashKeyWidth = sizeof(int);
+	RunCompact(&attr);
+	attr.HashIndex = 0;
+	attr.HashKeyWidth = 0;
+	attr.SkipIndex = 1;
+	RunCompact(&attr);
+
+	printf("OK\n");
+
+	return 0;
+}
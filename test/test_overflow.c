@@ -0,0 +1,155 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_overflow.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 大块内存的字节数计算溢出的回归测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 分配器记录申请的字节数，累计超过LIMIT_BYTES时返回NULL，因此
+ 				   无需真的分配数GB内存；检查申请的大小没有回绕，且操作在
+ 				   分配失败时干净地返回失败
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#define LIMIT_BYTES ( 64U * 1024U * 1024U )
+#define PAYLOAD_BYTES 4096U
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+static size_t LargestRequest;
+static size_t GrantedBytes;
+static long LiveBlocks;
+
+static void* LimitedAlloc(void* pContext, size_t size)
+{
+	(void)pContext;
+
+	if( size > LargestRequest )
+	{
+		LargestRequest = size;
+	}
+
+	if( size > LIMIT_BYTES - GrantedBytes )
+	{
+		return NULL;
+	}
+
+	GrantedBytes += size;
+	LiveBlocks++;
+
+	return malloc(size);
+}
+
+static void LimitedRelease(void* pContext, void* pMemory)
+{
+	(void)pContext;
+	LiveBlocks--;
+	free(pMemory);
+}
+
+/* 每块1100000个4KiB节点，块大小按unsigned int计算时会回绕成约228MB */
+static void TestPoolSlab(const list_allocator_t* pAllocator)
+{
+	static char payload[PAYLOAD_BYTES];
+	list_attr_t attr;
+	list_t* pList = NULL;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = pAllocator;
+	attr.PoolNodesPerSlab = 1100000;
+	LargestRequest = 0;
+	GrantedBytes = 0;
+
+	pList = CreateListEx(2000000, PAYLOAD_BYTES, &attr);
+	CHECK(NULL != pList);
+	CHECK(OPERATE_FAIL == pList->pushback(pList, payload));
+	CHECK(LargestRequest > 0x80000000U && LargestRequest <= UINT_MAX);
+	CHECK(0 == pList->size(pList));
+	pList->destroy(&pList);
+
+	attr.PoolNodesPerSlab = 1000;
+	pList = CreateListEx(2000000, PAYLOAD_BYTES, &attr);
+	CHECK(NULL != pList);
+	CHECK(OPERATE_SUCC == pList->pushback(pList, payload));
+	pList->destroy(&pList);
+
+	CHECK(NULL == CreateListEx(10, UINT_MAX - 8, &attr));
+	CHECK(0 == LiveBlocks);
+}
+
+/* 每块1048576个8KiB元素，块大小按unsigned int计算时会回绕为0 */
+static void TestUnrolledBlock(const list_allocator_t* pAllocator)
+{
+	static char payload[8192];
+	list_attr_t attr;
+	list_t* pList = NULL;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = pAllocator;
+	attr.Storage = LIST_STORAGE_UNROLLED;
+	attr.BlockItems = 1U << 20;
+	LargestRequest = 0;
+	GrantedBytes = 0;
+
+	pList = CreateListEx(10, sizeof(payload), &attr);
+	CHECK(NULL != pList);
+	CHECK(OPERATE_FAIL == pList->pushback(pList, payload));
+	CHECK(LargestRequest > UINT_MAX || sizeof(size_t) <= sizeof(unsigned int));
+	CHECK(0 == pList->size(pList));
+	pList->destroy(&pList);
+	CHECK(0 == LiveBlocks);
+}
+
+/* pushbackn一次预留1100000个4KiB节点，块大小按unsigned int计算时会回绕 */
+static void TestPoolReserve(const list_allocator_t* pAllocator)
+{
+	char* pPayload = (char*)calloc(LIMIT_BYTES / PAYLOAD_BYTES, PAYLOAD_BYTES);
+	list_attr_t attr;
+	list_t* pList = NULL;
+
+	CHECK(NULL != pPayload);
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = pAllocator;
+	attr.PoolNodesPerSlab = 16;
+	LargestRequest = 0;
+	GrantedBytes = 0;
+
+	pList = CreateListEx(2000000, PAYLOAD_BYTES, &attr);
+	CHECK(NULL != pList);
+	CHECK(OPERATE_FAIL == pList->pushbackn(pList, pPayload, 1100000));
+	CHECK(LargestRequest > 0x80000000U && LargestRequest <= UINT_MAX);
+	CHECK(0 == pList->size(pList));
+	GrantedBytes = 0;
+	CHECK(OPERATE_SUCC == pList->pushbackn(pList, pPayload, 100));
+	CHECK(100 == pList->size(pList));
+	pList->destroy(&pList);
+	CHECK(0 == LiveBlocks);
+
+	free(pPayload);
+}
+
+int main(void)
+{
+	list_allocator_t allocator = { LimitedAlloc, LimitedRelease, NULL };
+
+	TestPoolSlab(&allocator);
+	TestUnrolledBlock(&allocator);
+	TestPoolReserve(&allocator);
+
+	printf("OK\n");
+
+	return 0;
+}
@@ -0,0 +1,342 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_persist.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 持久化链表的崩溃恢复测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 子进程对持久化链表执行随机操作，父进程在随机时刻以SIGKILL
+ 				   杀死子进程后重新打开文件，检查链表内容等于最后一个完成的
+ 				   操作之后(或正被执行的操作完成之后)的状态，且恢复后仍可使用；
+ 				   另检查非持久化链表的文件不会被打开或修改，同一文件不能同时
+ 				   被打开两次；未启用LIST_USE_MMAP时直接通过
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+ * 2.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 增加外来文件与重复打开的检查
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#if LIST_USE_MMAP
+#include "signal.h"
+#include "unistd.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
+#include "sys/wait.h"
+
+#define CRASH_ROUNDS 20
+#define CRASH_CAPACITY 100000
+#define CRASH_FLUSH_INTERVAL 1000
+#define PERSIST_PATH "test_persist.dat"
+#define FOREIGN_PATH "test_persist.foreign"
+#define FOREIGN_SIZE 4096
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+typedef struct record
+{
+	int Key;
+	int Value;
+}record_t;
+
+static record_t Actual[CRASH_CAPACITY];
+static record_t Expected[CRASH_CAPACITY];
+
+static unsigned int NextRandom(unsigned int* pSeed)
+{
+	*pSeed = *pSeed * 1103515245U + 12345U;
+
+	return ( *pSeed >> 8 );
+}
+
+static unsigned int KeyGreater(const void* pLeft, const void* pRight)
+{
+	return ( ( ((const record_t*)pLeft)->Key > ((const record_t*)pRight)->Key ) ? 1 : 0 );
+}
+
+/* 对链表执行一个随机操作，同样的种子序列在持久化链表与参照链表上得到相同结果 */
+static void ApplyRandom(list_t* pList, unsigned int* pSeed)
+{
+	unsigned int random = NextRandom(pSeed);
+	unsigned int size = pList->size(pList);
+	unsigned int first = ( 0 != size ) ? NextRandom(pSeed) % size : 0;
+	unsigned int second = ( 0 != size ) ? NextRandom(pSeed) % size : 0;
+	record_t value;
+	record_t range[5];
+	list_iter_t iter;
+	unsigned int counter = 0;
+
+	value.Key = (int)( NextRandom(pSeed) % 1000 );
+	value.Value = (int)( NextRandom(pSeed) % 1000 );
+
+	for( counter = 0; counter < 5; counter++ )
+	{
+		range[counter].Key = value.Key + (int)counter;
+		range[counter].Value = (int)counter;
+	}
+
+	switch( random % 16 )
+	{
+		case 0:
+		case 1:
+			pList->pushback(pList, &value);
+			break;
+		case 2:
+			pList->pushfront(pList, &value);
+			break;
+		case 3:
+			pList->popfront(pList);
+			break;
+		case 4:
+			if( size < 50 || 0 == random % 4 )
+			{
+				pList->popback(pList);
+			}
+			else
+			{
+				pList->pushback(pList, &value);
+			}
+			break;
+		case 5:
+			pList->remove(pList, first);
+			break;
+		case 6:
+			pList->assign(pList, first, &value);
+			break;
+		case 7:
+			pList->insertafter(pList, first, &value);
+			break;
+		case 8:
+			pList->insert(pList, first, &value);
+			break;
+		case 9:
+			pList->swap(pList, first, second);
+			break;
+		case 10:
+			pList->insertrange(pList, first, range, 1 + random % 5);
+			break;
+		case 11:
+			if( 0 == random % 8 )
+			{
+				pList->sortif(pList, KeyGreater);
+			}
+			else
+			{
+				pList->pushbackn(pList, range, 3);
+			}
+			break;
+		case 12:
+			if( 0 == random % 8 )
+			{
+				pList->sortbykey(pList, 0, 4);
+			}
+			else
+			{
+				pList->pushfrontn(pList, range, 2);
+			}
+			break;
+		case 13:
+			pList->beforebegin(pList, &iter);
+			for( counter = 0; counter < first % 4 && pList->next(pList, &iter); counter++ );
+			pList->iterinsertafter(pList, &iter, &value);
+			break;
+		case 14:
+			pList->beforebegin(pList, &iter);
+			for( counter = 0; counter < first % 4 && pList->next(pList, &iter); counter++ );
+			pList->itereraseafter(pList, &iter);
+			break;
+		default:
+			if( NULL != pList->get(pList, first) )
+			{
+				pList->assign(pList, second, pList->get(pList, first));
+			}
+			break;
+	}
+}
+
+/* 以同样的种子在内存链表上重放steps个操作，与persist的内容比较 */
+static int MatchReplay(list_t* pPersist, unsigned int seed, unsigned int steps)
+{
+	list_t* pModel = CreateList(CRASH_CAPACITY, sizeof(record_t));
+	unsigned int counter = 0;
+	unsigned int count = 0;
+	int match = OPERATE_FALSE;
+
+	CHECK(NULL != pModel);
+
+	for( counter = 0; counter < steps; counter++ )
+	{
+		ApplyRandom(pModel, &seed);
+	}
+
+	count = pPersist->toarray(pPersist, Actual, CRASH_CAPACITY);
+	match = ( count == pModel->toarray(pModel, Expected, CRASH_CAPACITY) && count == pPersist->size(pPersist)
+		&& 0 == memcmp(Actual, Expected, count * sizeof(record_t)) );
+	pModel->destroy(&pModel);
+
+	return match;
+}
+
+static void RunChild(unsigned int seed, volatile unsigned int* pDone)
+{
+	list_t* pList = OpenPersistList(PERSIST_PATH, CRASH_CAPACITY, sizeof(record_t));
+	unsigned int counter = 0;
+
+	if( NULL == pList )
+	{
+		_exit(1);
+	}
+
+	for( counter = 0; ; counter++ )
+	{
+		ApplyRandom(pList, &seed);
+
+		if( CRASH_FLUSH_INTERVAL - 1 == counter % CRASH_FLUSH_INTERVAL )
+		{
+			pList->flush(pList);
+		}
+
+		*pDone = counter + 1;
+	}
+}
+
+static void TestCrash(void)
+{
+	volatile unsigned int* pDone = (volatile unsigned int*)mmap(NULL, sizeof(unsigned int),
+		PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	unsigned int delay_seed = 1;
+	unsigned int round = 0;
+	unsigned int done = 0;
+	unsigned int counter = 0;
+	record_t value = { 9, 9 };
+	list_t* pList = NULL;
+	pid_t pid = 0;
+
+	CHECK(MAP_FAILED != (void*)pDone);
+
+	for( round = 0; round < CRASH_ROUNDS; round++ )
+	{
+		unlink(PERSIST_PATH);
+		*pDone = 0;
+		pid = fork();
+		CHECK(pid >= 0);
+
+		if( 0 == pid )
+		{
+			RunChild(1000 + round, pDone);
+		}
+
+		usleep(2000 + NextRandom(&delay_seed) % 30000);
+		kill(pid, SIGKILL);
+		waitpid(pid, NULL, 0);
+		done = *pDone;
+
+		pList = OpenPersistList(PERSIST_PATH, CRASH_CAPACITY, sizeof(record_t));
+		CHECK(NULL != pList);
+		CHECK(MatchReplay(pList, 1000 + round, done) || MatchReplay(pList, 1000 + round, done + 1));
+
+		for( counter = 0; counter < 1000; counter++ )
+		{
+			CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+		}
+
+		CHECK(OPERATE_SUCC == pList->destroy(&pList));
+		pList = OpenPersistList(PERSIST_PATH, CRASH_CAPACITY, sizeof(record_t));
+		CHECK(NULL != pList);
+		CHECK(0 == memcmp(pList->back(pList), &value, sizeof(record_t)));
+		pList->destroy(&pList);
+	}
+
+	munmap((void*)pDone, sizeof(unsigned int));
+	unlink(PERSIST_PATH);
+}
+
+/* 非空且不是持久化链表的文件不能被打开，也不能被修改 */
+static void TestForeignFile(void)
+{
+	static char original[FOREIGN_SIZE];
+	static char current[FOREIGN_SIZE];
+	unsigned int length = 0;
+	unsigned int counter = 0;
+	struct stat info;
+	FILE* pFile = NULL;
+
+	for( counter = 0; counter < 2; counter++ )
+	{
+		/* 一个短文本文件与一个开头为0的文件 */
+		length = ( 0 == counter ) ? 100 : FOREIGN_SIZE;
+		memset(original, ( 0 == counter ) ? 'x' : 0, length);
+		original[length - 1] = 'z';
+
+		pFile = fopen(FOREIGN_PATH, "wb");
+		CHECK(NULL != pFile);
+		CHECK(length == fwrite(original, 1, length, pFile));
+		fclose(pFile);
+
+		CHECK(NULL == OpenPersistList(FOREIGN_PATH, 10, sizeof(record_t)));
+
+		CHECK(0 == stat(FOREIGN_PATH, &info));
+		CHECK(length == (unsigned int)info.st_size);
+		pFile = fopen(FOREIGN_PATH, "rb");
+		CHECK(NULL != pFile);
+		CHECK(length == fread(current, 1, length, pFile));
+		fclose(pFile);
+		CHECK(0 == memcmp(original, current, length));
+	}
+
+	unlink(FOREIGN_PATH);
+}
+
+/* 同一文件同一时刻只能由一个链表打开 */
+static void TestSingleOpener(void)
+{
+	record_t value = { 1, 2 };
+	list_t* pList = NULL;
+
+	unlink(PERSIST_PATH);
+	pList = OpenPersistList(PERSIST_PATH, 10, sizeof(record_t));
+	CHECK(NULL != pList);
+	CHECK(OPERATE_SUCC == pList->pushback(pList, &value));
+
+	CHECK(NULL == OpenPersistList(PERSIST_PATH, 10, sizeof(record_t)));
+	CHECK(1 == pList->size(pList));
+	CHECK(OPERATE_SUCC == pList->destroy(&pList));
+
+	pList = OpenPersistList(PERSIST_PATH, 10, sizeof(record_t));
+	CHECK(NULL != pList);
+	CHECK(1 == pList->size(pList));
+	CHECK(0 == memcmp(pList->front(pList), &value, sizeof(record_t)));
+	pList->destroy(&pList);
+	unlink(PERSIST_PATH);
+}
+
+int main(void)
+{
+	TestForeignFile();
+	TestSingleOpener();
+	TestCrash();
+
+	printf("OK\n");
+
+	return 0;
+}
+#else //else of LIST_USE_MMAP
+int main(void)
+{
+	printf("OK\n");
+
+	return 0;
+}
+#endif //end of LIST_USE_MMAP
@@ -0,0 +1,141 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_readers.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 多个线程在读写锁的读锁下同时调用get，检查返回的元素正确
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 游标经序列号发布，读者之间只竞争游标的更新，不会读到不一致的
+ 				   游标；读者以顺序访问为主并夹杂随机访问，并不时以两个线程
+ 				   countif，分段信息不写容器，线程池被占用时在调用线程中执行；
+ 				   覆盖节点、跳表索引、展开链表与顺序存储
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+ * 2.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 默认启用游标后增加顺序访问
+ * 3.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: 读者同时调用并行countif
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#define READER_COUNT 4
+#define READER_ELEMENTS 4096
+#define READER_ROUNDS 20000
+#define READER_COUNTIF_INTERVAL 512
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+typedef struct reader
+{
+	list_t* pList;
+	pthread_rwlock_t* pLock;
+	unsigned int Seed;
+	unsigned int Errors;
+}reader_t;
+
+static unsigned int IsEven(const void* pData, const void* pRef)
+{
+	(void)pRef;
+
+	return ( 0 == *(const unsigned int*)pData % 2 ) ? 1 : 0;
+}
+
+static void* ReaderEntry(void* pArg)
+{
+	reader_t* pReader = (reader_t*)pArg;
+	unsigned int counter = 0;
+	unsigned int index = 0;
+	unsigned int* pValue = NULL;
+
+	for( counter = 0; counter < READER_ROUNDS; counter++ )
+	{
+		pReader->Seed = pReader->Seed * 1103515245U + 12345U;
+		index = ( 0 == ( pReader->Seed >> 8 ) % 4 ) ? ( pReader->Seed >> 10 ) % READER_ELEMENTS : ( index + 1 ) % READER_ELEMENTS;
+
+		pthread_rwlock_rdlock(pReader->pLock);
+		pValue = (unsigned int*)pReader->pList->get(pReader->pList, index);
+		if( NULL == pValue || *pValue != index )
+		{
+			pReader->Errors++;
+		}
+
+		if( 0 == counter % READER_COUNTIF_INTERVAL
+			&& READER_ELEMENTS / 2 != pReader->pList->countif(pReader->pList, IsEven, NULL, 2) )
+		{
+			pReader->Errors++;
+		}
+		pthread_rwlock_unlock(pReader->pLock);
+	}
+
+	return NULL;
+}
+
+static void RunReaders(const list_attr_t* pAttr)
+{
+	list_t* pList = CreateListEx(READER_ELEMENTS, sizeof(unsigned int), pAttr);
+	pthread_rwlock_t lock;
+	pthread_t threads[READER_COUNT];
+	reader_t readers[READER_COUNT];
+	unsigned int counter = 0;
+
+	CHECK(NULL != pList);
+	for( counter = 0; counter < READER_ELEMENTS; counter++ )
+	{
+		CHECK(pList->pushback(pList, &counter));
+	}
+
+	pthread_rwlock_init(&lock, NULL);
+	for( counter = 0; counter < READER_COUNT; counter++ )
+	{
+		readers[counter].pList = pList;
+		readers[counter].pLock = &lock;
+		readers[counter].Seed = counter + 1;
+		readers[counter].Errors = 0;
+		CHECK(0 == pthread_create(&threads[counter], NULL, ReaderEntry, &readers[counter]));
+	}
+
+	for( counter = 0; counter < READER_COUNT; counter++ )
+	{
+		pthread_join(threads[counter], NULL);
+		CHECK(0 == readers[counter].Errors);
+	}
+
+	pthread_rwlock_destroy(&lock);
+	pList->destroy(&pList);
+}
+
+int main(void)
+{
+	list_attr_t attr;
+
+	memset(&attr, 0, sizeof(attr));
+	RunReaders(NULL);
+	RunReaders(&attr);
+
+	attr.SkipIndex = 1;
+	RunReaders(&attr);
+
+	attr.SkipIndex = 0;
+	attr.Storage = LIST_STORAGE_UNROLLED;
+	RunReaders(&attr);
+
+	attr.Storage = LIST_STORAGE_VECTOR;
+	RunReaders(&attr);
+
+	printf("OK\n");
+
+	return 0;
+}
@@ -0,0 +1,283 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_readmostly.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 读多写少模式的读者/写者压力测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 一个写者不断增删改，多个读者在读临界区内get/front/back/
+ 				   foreach并校验元素，被删除的节点若未经宽限期就被释放，读者会
+ 				   读到被破坏的数据(在AddressSanitizer下直接报错)；并检查该模式
+ 				   下不支持的接口直接返回失败
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#define READER_COUNT 3
+#define WRITER_ROUNDS 200000
+#define LIST_LOW 64
+#define LIST_HIGH 256
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+typedef struct entry
+{
+	unsigned int Value;
+	unsigned int Check;
+}entry_t;
+
+typedef struct reader
+{
+	list_t* pList;
+	int* pStop;
+	unsigned int Seed;
+	unsigned int Reads;
+	unsigned int Errors;
+}reader_t;
+
+static unsigned int NextRandom(unsigned int* pSeed)
+{
+	*pSeed = *pSeed * 1103515245U + 12345U;
+
+	return ( *pSeed >> 8 );
+}
+
+static entry_t MakeItem(unsigned int value)
+{
+	entry_t item;
+
+	item.Value = value;
+	item.Check = ~value;
+
+	return item;
+}
+
+static unsigned int IsIntact(const entry_t* pItem)
+{
+	return ( NULL != pItem && pItem->Check == ~pItem->Value ) ? 1 : 0;
+}
+
+static unsigned int IsOdd(const void* pData, const void* pRef)
+{
+	(void)pRef;
+
+	return ( ((const entry_t*)pData)->Value & 1 ) ? 1 : 0;
+}
+
+static unsigned int ValueGreater(const void* pLeft, const void* pRight)
+{
+	return ( ((const entry_t*)pLeft)->Value > ((const entry_t*)pRight)->Value ) ? 1 : 0;
+}
+
+static void VerifyVisit(void* pData, void* pContext)
+{
+	if( !IsIntact((const entry_t*)pData) )
+	{
+		(*(unsigned int*)pContext)++;
+	}
+}
+
+static unsigned int ForeachErrors;
+
+static void VerifyForeach(void* pData)
+{
+	if( !IsIntact((const entry_t*)pData) )
+	{
+		LIST_ATOMIC_ADD(&ForeachErrors, 1);
+	}
+}
+
+static void* ReaderEntry(void* pArg)
+{
+	reader_t* pReader = (reader_t*)pArg;
+	list_t* pList = pReader->pList;
+	unsigned int slot = 0;
+	unsigned int index = 0;
+	entry_t* pItem = NULL;
+
+	while( !LIST_ATOMIC_LOAD(pReader->pStop) )
+	{
+		index = NextRandom(&pReader->Seed) % LIST_HIGH;
+
+		slot = pList->readbegin(pList);
+		pItem = (entry_t*)pList->get(pList, index);
+		if( NULL != pItem && !IsIntact(pItem) )
+		{
+			pReader->Errors++;
+		}
+
+		pItem = (entry_t*)pList->front(pList);
+		if( NULL != pItem && !IsIntact(pItem) )
+		{
+			pReader->Errors++;
+		}
+
+		pItem = (entry_t*)pList->back(pList);
+		if( NULL != pItem && !IsIntact(pItem) )
+		{
+			pReader->Errors++;
+		}
+		pList->readend(pList, slot);
+
+		if( 0 == pReader->Reads % 64 )
+		{
+			pList->foreach(pList, VerifyForeach);
+		}
+
+		pReader->Reads++;
+	}
+
+	return NULL;
+}
+
+static void RunWriter(list_t* pList)
+{
+	unsigned int seed = 7;
+	unsigned int round = 0;
+	unsigned int value = 0;
+	unsigned int size = 0;
+	entry_t item;
+
+	for( round = 0; round < WRITER_ROUNDS; round++ )
+	{
+		item = MakeItem(++value);
+		size = pList->size(pList);
+
+		if( size < LIST_LOW )
+		{
+			CHECK(pList->pushback(pList, &item));
+			continue;
+		}
+
+		switch( NextRandom(&seed) % 8 )
+		{
+			case 0:
+				CHECK(pList->pushback(pList, &item) || size >= LIST_HIGH);
+				break;
+			case 1:
+				CHECK(pList->pushfront(pList, &item) || size >= LIST_HIGH);
+				break;
+			case 2:
+				CHECK(pList->popfront(pList));
+				break;
+			case 3:
+				CHECK(pList->popback(pList));
+				break;
+			case 4:
+				CHECK(pList->assign(pList, NextRandom(&seed) % size, &item));
+				break;
+			case 5:
+				CHECK(pList->insertafter(pList, NextRandom(&seed) % size, &item) || size >= LIST_HIGH);
+				break;
+			case 6:
+				CHECK(pList->remove(pList, NextRandom(&seed) % size));
+				break;
+			default:
+				CHECK(pList->popfrontcopy(pList, &item));
+				CHECK(IsIntact(&item));
+				break;
+		}
+	}
+}
+
+/* 该模式下会立即释放节点或非原子地改写链接的接口必须被拒绝 */
+static void CheckRejected(list_t* pList)
+{
+	entry_t items[4];
+	unsigned int size = pList->size(pList);
+	unsigned int errors = 0;
+	list_iter_t iter;
+	list_t* pOther = CreateList(LIST_HIGH, sizeof(entry_t));
+
+	CHECK(NULL != pOther);
+	items[0] = MakeItem(1);
+	CHECK(OPERATE_SUCC == pOther->pushback(pOther, &items[0]));
+
+	CHECK(0 == pList->removeif(pList, IsOdd, NULL));
+	CHECK(OPERATE_FAIL == pList->swap(pList, 0, 1));
+	CHECK(OPERATE_FAIL == pList->pushbackn(pList, items, 1));
+	CHECK(OPERATE_FAIL == pList->splice(pList, 0, pOther));
+	CHECK(OPERATE_FAIL == pList->concat(pList, pOther));
+	CHECK(0 == pList->toarray(pList, items, 4));
+	CHECK(0 == pList->countif(pList, IsOdd, NULL, 2));
+	CHECK(OPERATE_FAIL == pList->compact(pList));
+	pList->sortif(pList, ValueGreater);
+	pList->resize(pList, 0);
+	pList->beforebegin(pList, &iter);
+	CHECK(OPERATE_FAIL == pList->itereraseafter(pList, &iter));
+	CHECK(size == pList->size(pList));
+	CHECK(1 == pOther->size(pOther));
+
+	pList->foreach2(pList, VerifyVisit, &errors);
+	CHECK(0 == errors);
+	pOther->destroy(&pOther);
+}
+
+static void TestReadersAndWriter(void)
+{
+	list_t* pList = CreateList(LIST_HIGH, sizeof(entry_t));
+	pthread_t threads[READER_COUNT];
+	reader_t readers[READER_COUNT];
+	unsigned int counter = 0;
+	unsigned int odd = 0;
+	int stop = 0;
+
+	CHECK(NULL != pList);
+
+	if( OPERATE_FAIL == pList->setreadmostly(pList, OPERATE_TRUE) )
+	{
+		CHECK(!LIST_HAS_ATOMIC);
+		pList->destroy(&pList);
+		return;
+	}
+
+	for( counter = 0; counter < READER_COUNT; counter++ )
+	{
+		readers[counter].pList = pList;
+		readers[counter].pStop = &stop;
+		readers[counter].Seed = counter + 1;
+		readers[counter].Reads = 0;
+		readers[counter].Errors = 0;
+		CHECK(0 == pthread_create(&threads[counter], NULL, ReaderEntry, &readers[counter]));
+	}
+
+	RunWriter(pList);
+	LIST_ATOMIC_STORE(&stop, 1);
+
+	for( counter = 0; counter < READER_COUNT; counter++ )
+	{
+		pthread_join(threads[counter], NULL);
+		CHECK(0 == readers[counter].Errors);
+		CHECK(0 != readers[counter].Reads);
+	}
+	CHECK(0 == ForeachErrors);
+
+	CheckRejected(pList);
+
+	CHECK(OPERATE_SUCC == pList->setreadmostly(pList, OPERATE_FALSE));
+	odd = pList->countif(pList, IsOdd, NULL, 1);
+	CHECK(odd == pList->removeif(pList, IsOdd, NULL));
+	CHECK(0 == pList->countif(pList, IsOdd, NULL, 1));
+	pList->destroy(&pList);
+}
+
+int main(void)
+{
+	TestReadersAndWriter();
+
+	printf("OK\n");
+
+	return 0;
+}
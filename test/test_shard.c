@@ -0,0 +1,178 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_shard.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 分片容器push/size/foreach/drain的测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 分配器在创建容器的函数返回后即离开作用域，drain新建分片链表时
+ 				   不能再访问它；启用LIST_USE_PTHREAD时另有多线程并发插入
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#define SHARD_COUNT 4
+#define SHARD_CAPACITY 4000
+#define PUSHER_COUNT 4
+#define PUSHER_ITEMS 1000
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+typedef struct tally
+{
+	unsigned int Count;
+	unsigned long long Sum;
+}tally_t;
+
+static list_alloc_stats_t Stats;
+
+static unsigned int RouteByValue(const void* pData)
+{
+	return *(const unsigned int*)pData;
+}
+
+static void Accumulate(void* pData, void* pContext)
+{
+	tally_t* pTally = (tally_t*)pContext;
+
+	pTally->Count++;
+	pTally->Sum += *(unsigned int*)pData;
+}
+
+/* 分配器与属性都是局部变量，函数返回后容器只能使用自己保存的副本 */
+static shard_list_t* CreateWithScopedAllocator(unsigned int (*route)(const void*))
+{
+	list_allocator_t allocator;
+	list_attr_t attr;
+
+	InitCountingAllocator(&allocator, &Stats, NULL);
+	memset(&attr, 0, sizeof(attr));
+	attr.pAllocator = &allocator;
+
+	return CreateShardList(SHARD_CAPACITY, sizeof(unsigned int), SHARD_COUNT, &attr, route);
+}
+
+static void TestRouted(void)
+{
+	shard_list_t* pShardList = CreateWithScopedAllocator(RouteByValue);
+	unsigned int value = 0;
+	tally_t tally = { 0, 0 };
+
+	CHECK(NULL != pShardList);
+
+	for( value = 0; value < SHARD_CAPACITY; value++ )
+	{
+		CHECK(OPERATE_SUCC == pShardList->push(pShardList, &value));
+	}
+
+	value = 0;
+	CHECK(OPERATE_FAIL == pShardList->push(pShardList, &value));
+	CHECK(SHARD_CAPACITY == pShardList->size(pShardList));
+
+	pShardList->foreach(pShardList, Accumulate, &tally);
+	CHECK(SHARD_CAPACITY == tally.Count);
+	CHECK((unsigned long long)SHARD_CAPACITY * ( SHARD_CAPACITY - 1 ) / 2 == tally.Sum);
+
+	tally.Count = 0;
+	tally.Sum = 0;
+	CHECK(SHARD_CAPACITY == pShardList->drain(pShardList, Accumulate, &tally));
+	CHECK(SHARD_CAPACITY == tally.Count);
+	CHECK((unsigned long long)SHARD_CAPACITY * ( SHARD_CAPACITY - 1 ) / 2 == tally.Sum);
+	CHECK(0 == pShardList->size(pShardList));
+
+	CHECK(OPERATE_SUCC == pShardList->push(pShardList, &value));
+	CHECK(1 == pShardList->drain(pShardList, NULL, NULL));
+	CHECK(0 == pShardList->drain(pShardList, Accumulate, &tally));
+
+	pShardList->destroy(&pShardList);
+	CHECK(NULL == pShardList);
+	CHECK(Stats.Allocs == Stats.Releases);
+	CHECK(0 == Stats.LiveBytes);
+}
+
+#if LIST_USE_PTHREAD
+typedef struct pusher
+{
+	shard_list_t* pShardList;
+	unsigned int Base;
+	unsigned int Failures;
+}pusher_t;
+
+static void* PusherEntry(void* pArg)
+{
+	pusher_t* pPusher = (pusher_t*)pArg;
+	unsigned int counter = 0;
+	unsigned int value = 0;
+
+	for( counter = 0; counter < PUSHER_ITEMS; counter++ )
+	{
+		value = pPusher->Base + counter;
+
+		if( OPERATE_FAIL == pPusher->pShardList->push(pPusher->pShardList, &value) )
+		{
+			pPusher->Failures++;
+		}
+	}
+
+	return NULL;
+}
+
+static void TestConcurrentPush(void)
+{
+	shard_list_t* pShardList = CreateWithScopedAllocator(NULL);
+	pthread_t threads[PUSHER_COUNT];
+	pusher_t pushers[PUSHER_COUNT];
+	unsigned int counter = 0;
+	unsigned int total = PUSHER_COUNT * PUSHER_ITEMS;
+	tally_t tally = { 0, 0 };
+
+	CHECK(NULL != pShardList);
+
+	for( counter = 0; counter < PUSHER_COUNT; counter++ )
+	{
+		pushers[counter].pShardList = pShardList;
+		pushers[counter].Base = counter * PUSHER_ITEMS;
+		pushers[counter].Failures = 0;
+		CHECK(0 == pthread_create(&threads[counter], NULL, PusherEntry, &pushers[counter]));
+	}
+
+	for( counter = 0; counter < PUSHER_COUNT; counter++ )
+	{
+		pthread_join(threads[counter], NULL);
+		CHECK(0 == pushers[counter].Failures);
+	}
+
+	CHECK(total == pShardList->size(pShardList));
+	CHECK(total == pShardList->drain(pShardList, Accumulate, &tally));
+	CHECK(total == tally.Count);
+	CHECK((unsigned long long)total * ( total - 1 ) / 2 == tally.Sum);
+	CHECK(0 == pShardList->size(pShardList));
+
+	pShardList->destroy(&pShardList);
+	CHECK(Stats.Allocs == Stats.Releases);
+}
+#endif //end of LIST_USE_PTHREAD
+
+int main(void)
+{
+	TestRouted();
+#if LIST_USE_PTHREAD
+	TestConcurrentPush();
+#endif
+
+	printf("OK\n");
+
+	return 0;
+}
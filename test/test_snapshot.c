@@ -0,0 +1,263 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_snapshot.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : savelist/loadlist二进制快照的测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 各存储方式下保存后加载得到相同的内容与容量；快照被截断、
+ 				   数据或校验和被改写、元素大小不符时loadlist返回失败，且目标
+ 				   链表的内容与容量保持不变；启用LIST_USE_MMAP时另检查持久化
+ 				   链表
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#if LIST_USE_MMAP
+#include "unistd.h"
+
+#define PERSIST_PATH "test_snapshot.dat"
+#endif
+
+#define SNAPSHOT_ITEMS 5000
+#define SNAPSHOT_MAX_SIZE 8000
+#define TARGET_ITEMS 37
+#define TARGET_MAX_SIZE 100
+#define STORAGE_CASES 6
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+typedef struct record
+{
+	int Key;
+	int Value;
+}record_t;
+
+static char Bytes[sizeof(record_t) * SNAPSHOT_ITEMS + 1024];
+static record_t Actual[SNAPSHOT_MAX_SIZE];
+
+static record_t MakeRecord(int key)
+{
+	record_t record;
+
+	record.Key = key;
+	record.Value = key * 7 + 3;
+
+	return record;
+}
+
+/* 第index种存储方式：节点、内存池、跳表、哈希索引、展开链表、连续存储 */
+static list_t* CreateCase(unsigned int index, unsigned int max_size)
+{
+	list_attr_t attr;
+
+	memset(&attr, 0, sizeof(attr));
+
+	switch( index )
+	{
+		case 1:
+			attr.PoolNodesPerSlab = 64;
+			break;
+		case 2:
+			attr.SkipIndex = 1;
+			break;
+		case 3:
+			attr.HashIndex = 1;
+			attr.HashKeyOffset = 0;
+			attr.HashKeyWidth = sizeof(int);
+			break;
+		case 4:
+			attr.Storage = LIST_STORAGE_UNROLLED;
+			attr.BlockItems = 16;
+			break;
+		case 5:
+			attr.Storage = LIST_STORAGE_VECTOR;
+			break;
+		default:
+			break;
+	}
+
+	return CreateListEx(max_size, sizeof(record_t), &attr);
+}
+
+static void Fill(list_t* pList, int base, unsigned int count)
+{
+	unsigned int counter = 0;
+	record_t record;
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		record = MakeRecord(base + (int)counter);
+		CHECK(OPERATE_SUCC == pList->pushback(pList, &record));
+	}
+}
+
+static void CheckContents(list_t* pList, int base, unsigned int count, unsigned int max_size)
+{
+	unsigned int counter = 0;
+	record_t record;
+	int key = base;
+
+	CHECK(count == pList->size(pList));
+	CHECK(max_size == pList->MaxSize);
+	CHECK(count == pList->toarray(pList, Actual, SNAPSHOT_MAX_SIZE));
+
+	for( counter = 0; counter < count; counter++ )
+	{
+		record = MakeRecord(base + (int)counter);
+		CHECK(0 == memcmp(&record, &Actual[counter], sizeof(record_t)));
+		CHECK(0 == memcmp(&record, pList->get(pList, counter), sizeof(record_t)));
+	}
+
+	if( NULL != pList->pHash && 0 != count )
+	{
+		CHECK(NULL != pList->findbykey(pList, &key));
+	}
+}
+
+/* 以bytes字节的内容调用loadlist */
+static int LoadBytes(list_t* pList, const char* pBytes, unsigned int bytes)
+{
+	FILE* pFile = tmpfile();
+	int result = OPERATE_FAIL;
+
+	CHECK(NULL != pFile);
+	CHECK(bytes == fwrite(pBytes, 1, bytes, pFile));
+	rewind(pFile);
+	result = pList->loadlist(pList, pFile);
+	fclose(pFile);
+
+	return result;
+}
+
+static unsigned int SaveBytes(list_t* pList)
+{
+	FILE* pFile = tmpfile();
+	unsigned int bytes = 0;
+
+	CHECK(NULL != pFile);
+	CHECK(OPERATE_SUCC == pList->savelist(pList, pFile));
+	bytes = (unsigned int)ftell(pFile);
+	CHECK(bytes <= sizeof(Bytes));
+	rewind(pFile);
+	CHECK(bytes == fread(Bytes, 1, bytes, pFile));
+	fclose(pFile);
+
+	return bytes;
+}
+
+static void TestStorage(unsigned int index)
+{
+	list_t* pSource = CreateCase(index, SNAPSHOT_MAX_SIZE);
+	list_t* pTarget = CreateCase(index, TARGET_MAX_SIZE);
+	list_t* pNarrow = CreateList(10, sizeof(int));
+	unsigned int bytes = 0;
+
+	CHECK(NULL != pSource && NULL != pTarget && NULL != pNarrow);
+	Fill(pSource, 0, SNAPSHOT_ITEMS);
+	Fill(pTarget, 100000, TARGET_ITEMS);
+	bytes = SaveBytes(pSource);
+
+	/* 截断在文件头、数据中间与校验和中间 */
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, 10));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, bytes / 2));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, bytes - 3));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+
+	/* 改写一个数据字节 */
+	Bytes[bytes / 2] ^= 0x5a;
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, bytes));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+	Bytes[bytes / 2] ^= 0x5a;
+
+	/* 改写校验和 */
+	Bytes[bytes - 1] ^= 0x01;
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, bytes));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+	Bytes[bytes - 1] ^= 0x01;
+
+	/* 元素大小不符 */
+	CHECK(OPERATE_FAIL == LoadBytes(pNarrow, Bytes, bytes));
+	CHECK(0 == pNarrow->size(pNarrow));
+	CHECK(10 == pNarrow->MaxSize);
+
+	CHECK(OPERATE_SUCC == LoadBytes(pTarget, Bytes, bytes));
+	CheckContents(pTarget, 0, SNAPSHOT_ITEMS, SNAPSHOT_MAX_SIZE);
+
+	/* 加载后仍可正常修改，并可再次加载 */
+	pTarget->popfront(pTarget);
+	Fill(pTarget, 0, 1);
+	pTarget->popback(pTarget);
+	CHECK(SNAPSHOT_ITEMS - 1 == pTarget->size(pTarget));
+	pSource->popfront(pSource);
+	bytes = SaveBytes(pSource);
+	CHECK(OPERATE_SUCC == LoadBytes(pTarget, Bytes, bytes));
+	CheckContents(pTarget, 1, SNAPSHOT_ITEMS - 1, SNAPSHOT_MAX_SIZE);
+
+	pSource->destroy(&pSource);
+	pTarget->destroy(&pTarget);
+	pNarrow->destroy(&pNarrow);
+}
+
+#if LIST_USE_MMAP
+/* 持久化链表先在内存中读入并校验，失败时文件中的链表保持不变 */
+static void TestPersist(void)
+{
+	list_t* pSource = CreateCase(0, SNAPSHOT_MAX_SIZE);
+	list_t* pTarget = NULL;
+	unsigned int bytes = 0;
+
+	unlink(PERSIST_PATH);
+	pTarget = OpenPersistList(PERSIST_PATH, TARGET_MAX_SIZE, sizeof(record_t));
+	CHECK(NULL != pSource && NULL != pTarget);
+	Fill(pSource, 0, SNAPSHOT_ITEMS);
+	Fill(pTarget, 100000, TARGET_ITEMS);
+	bytes = SaveBytes(pSource);
+
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, bytes - 3));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+	Bytes[bytes / 2] ^= 0x5a;
+	CHECK(OPERATE_FAIL == LoadBytes(pTarget, Bytes, bytes));
+	CheckContents(pTarget, 100000, TARGET_ITEMS, TARGET_MAX_SIZE);
+	Bytes[bytes / 2] ^= 0x5a;
+
+	CHECK(OPERATE_SUCC == LoadBytes(pTarget, Bytes, bytes));
+	CheckContents(pTarget, 0, SNAPSHOT_ITEMS, SNAPSHOT_MAX_SIZE);
+
+	pSource->destroy(&pSource);
+	pTarget->destroy(&pTarget);
+	unlink(PERSIST_PATH);
+}
+#endif //end of LIST_USE_MMAP
+
+int main(void)
+{
+	unsigned int index = 0;
+
+	for( index = 0; index < STORAGE_CASES; index++ )
+	{
+		TestStorage(index);
+	}
+
+#if LIST_USE_MMAP
+	TestPersist();
+#endif
+
+	printf("OK\n");
+
+	return 0;
+}
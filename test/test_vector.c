@@ -0,0 +1,110 @@
+/********************************************************************************
+
+      **** Copyright (C), 2017, bingshuizhilian@yeah.net               ****
+
+ ********************************************************************************
+ * File Name     : test_vector.c
+ * Author        : agent@local
+ * Date          : 2026-10-18
+ * Description   : 顺序存储后端的边界测试
+ * Version       : 1.0
+ * Function List :
+ *
+ * Record        :
+ * Others        : 覆盖源数据位于容器自身缓冲区内时的插入、容量收缩、保存与
+ 				   加载、并行遍历以及不支持的并发模式
+ * 1.Date        : 2026-10-18
+ *   Author      : agent@local
+ *   Modification: Created file
+
+********************************************************************************/
+#include "forwardlist.h"
+#include "stdlib.h"
+#include "stdio.h"
+
+#define CHECK(cond) do{ if( !(cond) ){ printf("FAIL %s line %d\n", #cond, __LINE__); exit(1); } }while(0)
+
+static void AddInt(void* pData, void* pContext)
+{
+	*(long*)pContext += *(int*)pData;
+}
+
+static unsigned int IsOdd(const void* pData, const void* pRef)
+{
+	(void)pRef;
+
+	return *(const int*)pData & 1;
+}
+
+int main(void)
+{
+	list_attr_t attr = { NULL, 0, LIST_STORAGE_VECTOR };
+	list_t* pList = CreateListEx(40, sizeof(int), &attr);
+	list_t* pOther = NULL;
+	FILE* pFile = NULL;
+	unsigned int counter = 0;
+	long sum = 0;
+	int value = 7;
+
+	CHECK(NULL != pList);
+	CHECK(pList->pushback(pList, &value));
+
+	/* 源数据指向容器自身，扩容后仍须读到正确的值 */
+	for( counter = 0; counter < 39; counter++ )
+	{
+		CHECK(pList->pushback(pList, pList->get(pList, 0)));
+	}
+	CHECK(40 == pList->size(pList));
+	CHECK(!pList->pushback(pList, &value));
+	CHECK(40 == pList->VectorCapacity);
+	for( counter = 0; counter < 40; counter++ )
+	{
+		CHECK(7 == *(int*)pList->get(pList, counter));
+	}
+
+	pList->clear(pList);
+	for( value = 0; value < 10; value++ )
+	{
+		pList->pushback(pList, &value);
+	}
+	CHECK(pList->insertrange(pList, 5, pList->get(pList, 0), 10));
+	for( counter = 0; counter < 20; counter++ )
+	{
+		int expect = (int)( counter < 5 ? counter : counter < 15 ? counter - 5 : counter - 10 );
+
+		CHECK(expect == *(int*)pList->get(pList, counter));
+	}
+
+	CHECK(pList->compact(pList));
+	CHECK(20 == pList->VectorCapacity);
+	CHECK(4 == pList->locality(pList));
+
+	pList->parallelforeach(pList, AddInt, &sum, 4);
+	CHECK(2 * 45 == sum);
+	CHECK(10 == pList->countif(pList, IsOdd, NULL, 3));
+
+	pFile = tmpfile();
+	CHECK(NULL != pFile);
+	CHECK(pList->savelist(pList, pFile));
+	rewind(pFile);
+	pOther = CreateList(0, sizeof(int));
+	CHECK(pOther->loadlist(pOther, pFile));
+	CHECK(20 == pOther->size(pOther));
+	rewind(pFile);
+	pList->clear(pList);
+	CHECK(pList->loadlist(pList, pFile));
+	CHECK(20 == pList->size(pList));
+	CHECK(9 == *(int*)pList->get(pList, 19));
+	CHECK(pList->splice(pList, 0, pOther));
+	CHECK(40 == pList->size(pList) && 0 == pOther->size(pOther));
+	pOther->destroy(&pOther);
+	fclose(pFile);
+
+	CHECK(!pList->setconcurrent(pList, 1));
+	CHECK(!pList->setreadmostly(pList, 1));
+
+	pList->destroy(&pList);
+	printf("OK\n");
+
+	return 0;
+}